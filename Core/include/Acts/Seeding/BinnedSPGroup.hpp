@@ -14,7 +14,10 @@
 #include "Acts/Seeding/SeedfinderConfig.hpp"
 #include "Acts/Seeding/SpacePointGrid.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
+#include <numeric>
 #include <vector>
 
 namespace Acts {
@@ -25,35 +28,35 @@ namespace Acts {
 template <typename external_spacepoint_t>
 class NeighborhoodIterator {
  public:
-  using sp_it_t = typename std::vector<std::unique_ptr<
-      const InternalSpacePoint<external_spacepoint_t>>>::const_iterator;
+  using sp_it_t = typename std::vector<
+      const InternalSpacePoint<external_spacepoint_t>*>::const_iterator;
 
   NeighborhoodIterator() = delete;
 
-  NeighborhoodIterator(std::vector<size_t> indices,
+  NeighborhoodIterator(const std::vector<size_t>* indices,
                        const SpacePointGrid<external_spacepoint_t>* spgrid) {
     m_grid = spgrid;
     m_indices = indices;
     m_curInd = 0;
-    if (m_indices.size() > m_curInd) {
-      m_curIt = std::begin(spgrid->at(m_indices[m_curInd]));
-      m_binEnd = std::end(spgrid->at(m_indices[m_curInd]));
+    if (m_indices->size() > m_curInd) {
+      m_curIt = std::begin(spgrid->at((*m_indices)[m_curInd]));
+      m_binEnd = std::end(spgrid->at((*m_indices)[m_curInd]));
     }
   }
 
-  NeighborhoodIterator(std::vector<size_t> indices,
+  NeighborhoodIterator(const std::vector<size_t>* indices,
                        const SpacePointGrid<external_spacepoint_t>* spgrid,
                        size_t curInd, sp_it_t curIt) {
     m_grid = spgrid;
     m_indices = indices;
     m_curInd = curInd;
     m_curIt = curIt;
-    if (m_indices.size() > m_curInd) {
-      m_binEnd = std::end(spgrid->at(m_indices[m_curInd]));
+    if (m_indices->size() > m_curInd) {
+      m_binEnd = std::end(spgrid->at((*m_indices)[m_curInd]));
     }
   }
   static NeighborhoodIterator<external_spacepoint_t> begin(
-      std::vector<size_t> indices,
+      const std::vector<size_t>* indices,
       const SpacePointGrid<external_spacepoint_t>* spgrid) {
     auto nIt = NeighborhoodIterator<external_spacepoint_t>(indices, spgrid);
     // advance until first non-empty bin or last bin
@@ -64,13 +67,7 @@ class NeighborhoodIterator {
   }
 
   NeighborhoodIterator(
-      const NeighborhoodIterator<external_spacepoint_t>& other) {
-    m_grid = other.m_grid;
-    m_indices = other.m_indices;
-    m_curInd = other.m_curInd;
-    m_curIt = other.m_curIt;
-    m_binEnd = other.m_binEnd;
-  }
+      const NeighborhoodIterator<external_spacepoint_t>& other) = default;
 
   void operator++() {
     // if iterator of current Bin not yet at end, increase
@@ -83,15 +80,15 @@ class NeighborhoodIterator {
     }
     // increase bin index m_curInd until you find non-empty bin
     // or until m_curInd >= m_indices.size()-1
-    while (m_curIt == m_binEnd && m_indices.size() - 1 > m_curInd) {
+    while (m_curIt == m_binEnd && m_indices->size() - 1 > m_curInd) {
       m_curInd++;
-      m_curIt = std::begin(m_grid->at(m_indices[m_curInd]));
-      m_binEnd = std::end(m_grid->at(m_indices[m_curInd]));
+      m_curIt = std::begin(m_grid->at((*m_indices)[m_curInd]));
+      m_binEnd = std::end(m_grid->at((*m_indices)[m_curInd]));
     }
   }
 
   const InternalSpacePoint<external_spacepoint_t>* operator*() {
-    return (*m_curIt).get();
+    return *m_curIt;
   }
 
   bool operator!=(const NeighborhoodIterator<external_spacepoint_t>& other) {
@@ -101,8 +98,8 @@ class NeighborhoodIterator {
   // iterators within current bin
   sp_it_t m_curIt;
   sp_it_t m_binEnd;
-  // number of bins
-  std::vector<size_t> m_indices;
+  // number of bins, owned by the BinnedSPGroup
+  const std::vector<size_t>* m_indices;
   // current bin
   size_t m_curInd;
   const Acts::SpacePointGrid<external_spacepoint_t>* m_grid;
@@ -111,11 +108,12 @@ class NeighborhoodIterator {
 /// @c Neighborhood Used to access iterators to access a group of bins
 /// returned by a BinFinder.
 /// Fulfills the range_expression interface
+/// @note The bin indices are not copied and must outlive the neighborhood.
 template <typename external_spacepoint_t>
 class Neighborhood {
  public:
   Neighborhood() = delete;
-  Neighborhood(std::vector<size_t> indices,
+  Neighborhood(const std::vector<size_t>* indices,
                const SpacePointGrid<external_spacepoint_t>* spgrid) {
     m_indices = indices;
     m_spgrid = spgrid;
@@ -126,44 +124,31 @@ class Neighborhood {
   }
   NeighborhoodIterator<external_spacepoint_t> end() {
     return NeighborhoodIterator<external_spacepoint_t>(
-        m_indices, m_spgrid, m_indices.size() - 1,
-        std::end(m_spgrid->at(m_indices.back())));
+        m_indices, m_spgrid, m_indices->size() - 1,
+        std::end(m_spgrid->at(m_indices->back())));
   }
 
  private:
-  std::vector<size_t> m_indices;
+  const std::vector<size_t>* m_indices;
   const SpacePointGrid<external_spacepoint_t>* m_spgrid;
 };
 
+template <typename external_spacepoint_t>
+class BinnedSPGroup;
+
 /// @c BinnedSPGroupIterator Allows to iterate over all groups of bins
-/// a provided BinFinder can generate for each bin of a provided SPGrid
+/// a provided BinFinder can generate for each bin of a provided SPGrid.
+/// The groups are ordered in phi first and in z second.
 template <typename external_spacepoint_t>
 class BinnedSPGroupIterator {
  public:
   BinnedSPGroupIterator& operator++() {
-    if (zIndex < phiZbins[1]) {
-      zIndex++;
-
-    } else {
-      zIndex = 1;
-      phiIndex++;
-    }
-    // set current & neighbor bins only if bin indices valid
-    if (phiIndex <= phiZbins[0] && zIndex <= phiZbins[1]) {
-      currentBin =
-          std::vector<size_t>{grid->globalBinFromLocalBins({phiIndex, zIndex})};
-      bottomBinIndices = m_bottomBinFinder->findBins(phiIndex, zIndex, grid);
-      topBinIndices = m_topBinFinder->findBins(phiIndex, zIndex, grid);
-      outputIndex++;
-      return *this;
-    }
-    phiIndex = phiZbins[0];
-    zIndex = phiZbins[1] + 1;
+    outputIndex++;
     return *this;
   }
 
   bool operator==(const BinnedSPGroupIterator& otherState) {
-    return (zIndex == otherState.zIndex && phiIndex == otherState.phiIndex);
+    return outputIndex == otherState.outputIndex;
   }
 
   bool operator!=(const BinnedSPGroupIterator& otherState) {
@@ -171,62 +156,28 @@ class BinnedSPGroupIterator {
   }
 
   Neighborhood<external_spacepoint_t> middle() {
-    return Neighborhood<external_spacepoint_t>(currentBin, grid);
+    return Neighborhood<external_spacepoint_t>(
+        &m_group->m_middleBinIndices[outputIndex], m_group->m_binnedSP.get());
   }
 
   Neighborhood<external_spacepoint_t> bottom() {
-    return Neighborhood<external_spacepoint_t>(bottomBinIndices, grid);
+    return Neighborhood<external_spacepoint_t>(
+        &m_group->m_bottomBinIndices[outputIndex], m_group->m_binnedSP.get());
   }
 
   Neighborhood<external_spacepoint_t> top() {
-    return Neighborhood<external_spacepoint_t>(topBinIndices, grid);
-  }
-
-  BinnedSPGroupIterator(const SpacePointGrid<external_spacepoint_t>* spgrid,
-                        BinFinder<external_spacepoint_t>* botBinFinder,
-                        BinFinder<external_spacepoint_t>* tBinFinder)
-      : currentBin({spgrid->globalBinFromLocalBins({1, 1})}) {
-    grid = spgrid;
-    m_bottomBinFinder = botBinFinder;
-    m_topBinFinder = tBinFinder;
-    phiZbins = grid->numLocalBins();
-    phiIndex = 1;
-    zIndex = 1;
-    outputIndex = 0;
-    bottomBinIndices = m_bottomBinFinder->findBins(phiIndex, zIndex, grid);
-    topBinIndices = m_topBinFinder->findBins(phiIndex, zIndex, grid);
+    return Neighborhood<external_spacepoint_t>(
+        &m_group->m_topBinIndices[outputIndex], m_group->m_binnedSP.get());
   }
 
-  BinnedSPGroupIterator(const SpacePointGrid<external_spacepoint_t>* spgrid,
-                        BinFinder<external_spacepoint_t>* botBinFinder,
-                        BinFinder<external_spacepoint_t>* tBinFinder,
-                        size_t phiInd, size_t zInd)
-      : currentBin({spgrid->globalBinFromLocalBins({phiInd, zInd})}) {
-    m_bottomBinFinder = botBinFinder;
-    m_topBinFinder = tBinFinder;
-    grid = spgrid;
-    phiIndex = phiInd;
-    zIndex = zInd;
-    phiZbins = grid->numLocalBins();
-    outputIndex = (phiInd - 1) * phiZbins[1] + zInd - 1;
-    if (phiIndex <= phiZbins[0] && zIndex <= phiZbins[1]) {
-      bottomBinIndices = m_bottomBinFinder->findBins(phiIndex, zIndex, grid);
-      topBinIndices = m_topBinFinder->findBins(phiIndex, zIndex, grid);
-    }
-  }
+  BinnedSPGroupIterator(const BinnedSPGroup<external_spacepoint_t>* group,
+                        size_t index)
+      : m_group(group), outputIndex(index) {}
 
  private:
-  // middle spacepoint bin
-  std::vector<size_t> currentBin;
-  std::vector<size_t> bottomBinIndices;
-  std::vector<size_t> topBinIndices;
-  const SpacePointGrid<external_spacepoint_t>* grid;
-  size_t phiIndex = 1;
-  size_t zIndex = 1;
+  const BinnedSPGroup<external_spacepoint_t>* m_group;
+  // position of the middle space point bin in the iteration order
   size_t outputIndex = 0;
-  std::array<long unsigned int, 2ul> phiZbins;
-  BinFinder<external_spacepoint_t>* m_bottomBinFinder;
-  BinFinder<external_spacepoint_t>* m_topBinFinder;
 };
 
 /// @c BinnedSPGroup Provides access to begin and end BinnedSPGroupIterator
@@ -249,26 +200,43 @@ class BinnedSPGroup {
 
   size_t size() { return m_binnedSP.size(); }
 
-  BinnedSPGroupIterator<external_spacepoint_t> begin() {
-    return BinnedSPGroupIterator<external_spacepoint_t>(
-        m_binnedSP.get(), m_bottomBinFinder.get(), m_topBinFinder.get());
+  /// Number of groups, i.e. of bins with middle space points.
+  size_t numGroups() const { return m_middleBinIndices.size(); }
+
+  BinnedSPGroupIterator<external_spacepoint_t> begin() const {
+    return BinnedSPGroupIterator<external_spacepoint_t>(this, 0);
+  }
+
+  BinnedSPGroupIterator<external_spacepoint_t> end() const {
+    return BinnedSPGroupIterator<external_spacepoint_t>(this, numGroups());
   }
 
-  BinnedSPGroupIterator<external_spacepoint_t> end() {
-    auto phiZbins = m_binnedSP->numLocalBins();
-    return BinnedSPGroupIterator<external_spacepoint_t>(
-        m_binnedSP.get(), m_bottomBinFinder.get(), m_topBinFinder.get(),
-        phiZbins[0], phiZbins[1] + 1);
+  /// Access a group by its position in the iteration order, e.g. to process
+  /// the groups in parallel.
+  /// @param index position of the group, smaller than numGroups()
+  BinnedSPGroupIterator<external_spacepoint_t> group(size_t index) const {
+    return BinnedSPGroupIterator<external_spacepoint_t>(this, index);
   }
 
  private:
-  // grid with ownership of all InternalSpacePoint
+  // contiguous storage of all InternalSpacePoint ordered by grid bin and r
+  std::vector<InternalSpacePoint<external_spacepoint_t>> m_spacePoints;
+
+  // grid pointing to the stored InternalSpacePoint
   std::unique_ptr<Acts::SpacePointGrid<external_spacepoint_t>> m_binnedSP;
 
   // BinFinder must return std::vector<Acts::Seeding::Bin> with content of
   // each bin sorted in r (ascending)
   std::shared_ptr<BinFinder<external_spacepoint_t>> m_topBinFinder;
   std::shared_ptr<BinFinder<external_spacepoint_t>> m_bottomBinFinder;
+
+  // global bin indices of each group, computed once per grid such that
+  // iterating the groups does not query the BinFinders again
+  std::vector<std::vector<size_t>> m_middleBinIndices;
+  std::vector<std::vector<size_t>> m_bottomBinIndices;
+  std::vector<std::vector<size_t>> m_topBinIndices;
+
+  friend class BinnedSPGroupIterator<external_spacepoint_t>;
 };
 
 }  // namespace Acts
@@ -29,14 +29,13 @@ Acts::BinnedSPGroup<external_spacepoint_t>::BinnedSPGroup(
   float zMin = config.zMin;
   float zMax = config.zMax;
 
-  // sort by radius
+  // collect the space points in the region of interest
   // add magnitude of beamPos to rMax to avoid excluding measurements
-  // create number of bins equal to number of millimeters rMax
-  // (worst case minR: configured minR + 1mm)
-  size_t numRBins = (config.rMax + config.beamPos.norm());
-  std::vector<std::vector<
-      std::unique_ptr<const InternalSpacePoint<external_spacepoint_t>>>>
-      rBins(numRBins);
+  // (worst case minR: configured minR + 1mm). rounded down to keep the cut of
+  // the former 1mm r bins, which ended at the last full millimeter.
+  float rMax = std::floor(config.rMax + config.beamPos.norm());
+  std::vector<InternalSpacePoint<external_spacepoint_t>> spacePoints;
+  std::vector<size_t> spBins;
   for (spacepoint_iterator_t it = spBegin; it != spEnd; it++) {
     if (*it == nullptr) {
       continue;
@@ -57,30 +56,52 @@ Acts::BinnedSPGroup<external_spacepoint_t>::BinnedSPGroup(
       continue;
     }
 
-    auto isp =
-        std::make_unique<const InternalSpacePoint<external_spacepoint_t>>(
-            sp, spPosition, config.beamPos, variance);
-    // calculate r-Bin index and protect against overflow (underflow not
-    // possible)
-    size_t rIndex = isp->radius();
-    // if index out of bounds, the SP is outside the region of interest
-    if (rIndex >= numRBins) {
+    InternalSpacePoint<external_spacepoint_t> isp(sp, spPosition,
+                                                  config.beamPos, variance);
+    // if radius out of bounds, the SP is outside the region of interest
+    if (isp.radius() >= rMax) {
       continue;
     }
-    rBins[rIndex].push_back(std::move(isp));
+    Acts::Vector2 spLocation(isp.phi(), isp.z());
+    spBins.push_back(grid->globalBinFromPosition(spLocation));
+    spacePoints.push_back(std::move(isp));
   }
-  // fill rbins into grid such that each grid bin is sorted in r
-  // space points with delta r < rbin size can be out of order
-  for (auto& rbin : rBins) {
-    for (auto& isp : rbin) {
-      Acts::Vector2 spLocation(isp->phi(), isp->z());
-      std::vector<
-          std::unique_ptr<const InternalSpacePoint<external_spacepoint_t>>>&
-          bin = grid->atPosition(spLocation);
-      bin.push_back(std::move(isp));
+
+  // order by grid bin and by radius within each bin
+  std::vector<size_t> order(spacePoints.size());
+  std::iota(order.begin(), order.end(), 0u);
+  std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+    if (spBins[lhs] != spBins[rhs]) {
+      return spBins[lhs] < spBins[rhs];
     }
+    return spacePoints[lhs].radius() < spacePoints[rhs].radius();
+  });
+
+  // store the space points contiguously and fill the grid bins in r order.
+  // the storage must not be resized afterwards to keep the pointers valid.
+  m_spacePoints.reserve(spacePoints.size());
+  for (size_t i : order) {
+    m_spacePoints.push_back(spacePoints[i]);
+    grid->at(spBins[i]).push_back(&m_spacePoints.back());
   }
   m_binnedSP = std::move(grid);
   m_bottomBinFinder = botBinFinder;
   m_topBinFinder = tBinFinder;
+
+  // collect the neighbor bins of all groups, in phi first and in z second
+  auto phiZbins = m_binnedSP->numLocalBins();
+  size_t numGroups = phiZbins[0] * phiZbins[1];
+  m_middleBinIndices.reserve(numGroups);
+  m_bottomBinIndices.reserve(numGroups);
+  m_topBinIndices.reserve(numGroups);
+  for (size_t phiIndex = 1; phiIndex <= phiZbins[0]; ++phiIndex) {
+    for (size_t zIndex = 1; zIndex <= phiZbins[1]; ++zIndex) {
+      m_middleBinIndices.push_back(
+          {m_binnedSP->globalBinFromLocalBins({phiIndex, zIndex})});
+      m_bottomBinIndices.push_back(
+          m_bottomBinFinder->findBins(phiIndex, zIndex, m_binnedSP.get()));
+      m_topBinIndices.push_back(
+          m_topBinFinder->findBins(phiIndex, zIndex, m_binnedSP.get()));
+    }
+  }
 }
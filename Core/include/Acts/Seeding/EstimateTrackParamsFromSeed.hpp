@@ -14,9 +14,11 @@
 #include "Acts/Seeding/Seed.hpp"
 #include "Acts/Surfaces/Surface.hpp"
 #include "Acts/Utilities/Logger.hpp"
+#include "Acts/Utilities/UnitVectors.hpp"
 
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <iostream>
 #include <iterator>
 #include <optional>
@@ -305,4 +307,215 @@ std::optional<BoundVector> estimateTrackParamsFromSeed(
   return params;
 }
 
+/// Input of the track parameters estimation for many seeds at once.
+///
+/// The global positions of the bottom, middle and top space points, indexed
+/// with 0, 1 and 2, and the magnetic field at the bottom space point are
+/// stored as one contiguous array per coordinate. All arrays have one entry
+/// per seed.
+struct SeedBatch {
+  std::array<std::vector<ActsScalar>, 3> x;
+  std::array<std::vector<ActsScalar>, 3> y;
+  std::array<std::vector<ActsScalar>, 3> z;
+  std::vector<ActsScalar> bx;
+  std::vector<ActsScalar> by;
+  std::vector<ActsScalar> bz;
+  /// The surface of the bottom space point for each seed
+  std::vector<const Surface*> surfaces;
+
+  /// The number of seeds
+  size_t size() const { return surfaces.size(); }
+
+  /// Remove all seeds, keeping the allocated memory
+  void clear() {
+    for (size_t isp = 0; isp < 3; ++isp) {
+      x[isp].clear();
+      y[isp].clear();
+      z[isp].clear();
+    }
+    bx.clear();
+    by.clear();
+    bz.clear();
+    surfaces.clear();
+  }
+
+  /// Reserve memory for a number of seeds
+  void reserve(size_t n) {
+    for (size_t isp = 0; isp < 3; ++isp) {
+      x[isp].reserve(n);
+      y[isp].reserve(n);
+      z[isp].reserve(n);
+    }
+    bx.reserve(n);
+    by.reserve(n);
+    bz.reserve(n);
+    surfaces.reserve(n);
+  }
+
+  /// Add a seed
+  /// @param spBegin is the begin iterator for the bottom, middle and top
+  /// space point
+  /// @param surface is the surface of the bottom space point
+  /// @param bField is the magnetic field at the bottom space point
+  template <typename spacepoint_iterator_t>
+  void push_back(spacepoint_iterator_t spBegin, const Surface& surface,
+                 const Vector3& bField) {
+    for (size_t isp = 0; isp < 3; ++isp, ++spBegin) {
+      const auto& sp = *spBegin;
+      x[isp].push_back(sp->x());
+      y[isp].push_back(sp->y());
+      z[isp].push_back(sp->z());
+    }
+    bx.push_back(bField.x());
+    by.push_back(bField.y());
+    bz.push_back(bField.z());
+    surfaces.push_back(&surface);
+  }
+};
+
+/// Estimate the full track parameters for many seeds at once
+///
+/// This gives the same result as the estimation for a single seed from three
+/// space points above, but avoids the per seed transforms. The estimation of
+/// the direction and momentum is a single loop over the coordinate arrays of
+/// all seeds; only the transformation of the bottom space points to the local
+/// coordinates of their surfaces is done seed by seed.
+///
+/// @param gctx is the geometry context
+/// @param seeds are the space point positions, fields and surfaces of the seeds
+/// @param bFieldMin is the minimum magnetic field required to trigger the
+/// estimation of q/pt
+/// @param params are the estimated bound parameters for each seed; resized to
+/// the number of seeds
+/// @param valid is set to true for each seed with successfully estimated
+/// parameters; resized to the number of seeds
+/// @param mass is the estimated particle mass
+///
+/// @return the number of seeds with successfully estimated parameters
+inline size_t estimateTrackParamsFromSeeds(
+    const GeometryContext& gctx, const SeedBatch& seeds, ActsScalar bFieldMin,
+    std::vector<BoundVector>& params, std::vector<bool>& valid,
+    ActsScalar mass = 139.57018 * UnitConstants::MeV) {
+  const size_t nSeeds = seeds.size();
+  params.resize(nSeeds);
+  valid.assign(nSeeds, false);
+
+  const ActsScalar massInGeV = mass / UnitConstants::GeV;
+  const ActsScalar* xB = seeds.x[0].data();
+  const ActsScalar* yB = seeds.y[0].data();
+  const ActsScalar* zB = seeds.z[0].data();
+  const ActsScalar* xM = seeds.x[1].data();
+  const ActsScalar* yM = seeds.y[1].data();
+  const ActsScalar* zM = seeds.z[1].data();
+  const ActsScalar* xT = seeds.x[2].data();
+  const ActsScalar* yT = seeds.y[2].data();
+  const ActsScalar* zT = seeds.z[2].data();
+
+  for (size_t i = 0; i < nSeeds; ++i) {
+    // The frame of the single seed estimation: z axis along the magnetic
+    // field, y axis perpendicular to the bottom-middle vector
+    ActsScalar bNorm = std::sqrt(seeds.bx[i] * seeds.bx[i] +
+                                 seeds.by[i] * seeds.by[i] +
+                                 seeds.bz[i] * seeds.bz[i]);
+    ActsScalar zAx = seeds.bx[i] / bNorm;
+    ActsScalar zAy = seeds.by[i] / bNorm;
+    ActsScalar zAz = seeds.bz[i] / bNorm;
+    ActsScalar dx1 = xM[i] - xB[i];
+    ActsScalar dy1 = yM[i] - yB[i];
+    ActsScalar dz1 = zM[i] - zB[i];
+    ActsScalar yAx = zAy * dz1 - zAz * dy1;
+    ActsScalar yAy = zAz * dx1 - zAx * dz1;
+    ActsScalar yAz = zAx * dy1 - zAy * dx1;
+    ActsScalar yNorm = std::sqrt(yAx * yAx + yAy * yAy + yAz * yAz);
+    yAx /= yNorm;
+    yAy /= yNorm;
+    yAz /= yNorm;
+    ActsScalar xAx = yAy * zAz - yAz * zAy;
+    ActsScalar xAy = yAz * zAx - yAx * zAz;
+    ActsScalar xAz = yAx * zAy - yAy * zAx;
+
+    // The middle and top space point in the new frame
+    ActsScalar dx2 = xT[i] - xB[i];
+    ActsScalar dy2 = yT[i] - yB[i];
+    ActsScalar dz2 = zT[i] - zB[i];
+    ActsScalar lx1 = xAx * dx1 + xAy * dy1 + xAz * dz1;
+    ActsScalar ly1 = yAx * dx1 + yAy * dy1 + yAz * dz1;
+    ActsScalar lx2 = xAx * dx2 + xAy * dy2 + xAz * dz2;
+    ActsScalar ly2 = yAx * dx2 + yAy * dy2 + yAz * dz2;
+    ActsScalar lz2 = zAx * dx2 + zAy * dy2 + zAz * dz2;
+
+    // The straight line in the (u, v) space and the curvature
+    ActsScalar den1 = lx1 * lx1 + ly1 * ly1;
+    ActsScalar rn = lx2 * lx2 + ly2 * ly2;
+    ActsScalar u1 = lx1 / den1;
+    ActsScalar v1 = ly1 / den1;
+    ActsScalar u2 = lx2 / rn;
+    ActsScalar v2 = ly2 / rn;
+    ActsScalar A = (v2 - v1) / (u2 - u1);
+    ActsScalar B = v2 - A * u2;
+    ActsScalar hypotA = std::hypot(1., A);
+    ActsScalar rho = -2.0 * B / hypotA;
+    ActsScalar invTanTheta =
+        lz2 * std::sqrt(1. / rn) / (1. + rho * rho * rn);
+
+    // The direction transformed back to the original frame
+    ActsScalar tz = hypotA * invTanTheta;
+    ActsScalar tNorm = std::sqrt(1. + A * A + tz * tz);
+    ActsScalar dirX = (xAx + A * yAx + tz * zAx) / tNorm;
+    ActsScalar dirY = (xAy + A * yAy + tz * zAy) / tNorm;
+    ActsScalar dirZ = (xAz + A * yAz + tz * zAz) / tNorm;
+
+    // The momentum and time as for the single seed estimation
+    ActsScalar bFieldInTesla = bNorm / UnitConstants::T;
+    ActsScalar qOverPt = rho * (UnitConstants::m) / (0.3 * bFieldInTesla);
+    ActsScalar qOverP = qOverPt / std::hypot(1., invTanTheta);
+    ActsScalar pInGeV = std::abs(1.0 / qOverP);
+    ActsScalar pzInGeV = 1.0 / std::abs(qOverPt) * invTanTheta;
+    ActsScalar energy = std::hypot(pInGeV, massInGeV);
+    ActsScalar pathz = xB[i] * zAx + yB[i] * zAy + zB[i] * zAz;
+    ActsScalar time;
+    if (pathz != 0) {
+      time = pathz / (pzInGeV / energy);
+    } else {
+      time = std::sqrt(xB[i] * xB[i] + yB[i] * yB[i] + zB[i] * zB[i]) /
+             (pInGeV / energy);
+    }
+
+    BoundVector& seedParams = params[i];
+    seedParams[eBoundLoc0] = 0.;
+    seedParams[eBoundLoc1] = 0.;
+    seedParams[eBoundPhi] = std::atan2(dirY, dirX);
+    seedParams[eBoundTheta] = std::atan2(std::hypot(dirX, dirY), dirZ);
+    seedParams[eBoundQOverP] = qOverP;
+    seedParams[eBoundTime] = time;
+  }
+
+  // The local positions on the surfaces and the final checks
+  const ActsScalar bFieldMin2 = bFieldMin * bFieldMin;
+  size_t nValid = 0;
+  for (size_t i = 0; i < nSeeds; ++i) {
+    ActsScalar bNorm2 = seeds.bx[i] * seeds.bx[i] +
+                        seeds.by[i] * seeds.by[i] + seeds.bz[i] * seeds.bz[i];
+    if (bNorm2 < bFieldMin2 or seeds.surfaces[i] == nullptr) {
+      continue;
+    }
+    BoundVector& seedParams = params[i];
+    Vector3 position(seeds.x[0][i], seeds.y[0][i], seeds.z[0][i]);
+    Vector3 direction = makeDirectionUnitFromPhiTheta(
+        seedParams[eBoundPhi], seedParams[eBoundTheta]);
+    auto lpResult = seeds.surfaces[i]->globalToLocal(gctx, position, direction);
+    if (not lpResult.ok()) {
+      continue;
+    }
+    seedParams[eBoundLoc0] = lpResult.value().x();
+    seedParams[eBoundLoc1] = lpResult.value().y();
+    if (seedParams.hasNaN()) {
+      continue;
+    }
+    valid[i] = true;
+    ++nValid;
+  }
+  return nValid;
+}
+
 }  // namespace Acts
@@ -0,0 +1,89 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+namespace Acts {
+namespace FlatSeeding {
+
+/// Helper struct describing a spacepoint in a flat array
+struct SpacePoint {
+  float x = 0.0f;       ///< x-coordinate in beam system coordinates
+  float y = 0.0f;       ///< y-coordinate in beam system coordinates
+  float z = 0.0f;       ///< z-coordinate in beam system coordinates
+  float radius = 0.0f;  ///< radius in beam system coordinates
+  float varianceR = 0.0f;
+  float varianceZ = 0.0f;
+};  // struct SpacePoint
+
+/// Helper struct summarising the results of the dublet search
+struct DubletCounts {
+  /// The total number of dublets (M-B and M-T) found
+  unsigned int nDublets = 0;
+  /// The total number of triplet candidates found
+  unsigned int nTriplets = 0;
+  /// The maximal number of middle-bottom dublets
+  unsigned int maxMBDublets = 0;
+  /// The maximal number of middle-top dublets
+  unsigned int maxMTDublets = 0;
+  /// The maximal number of triplets for any middle SP
+  unsigned int maxTriplets = 0;
+};  // struct DubletCounts
+
+/// Helper struct holding the linearly transformed coordinates of spacepoints
+struct LinCircle {
+  float Zo = 0.0f;
+  float cotTheta = 0.0f;
+  float iDeltaR = 0.0f;
+  float Er = 0.0f;
+  float U = 0.0f;
+  float V = 0.0f;
+};  // struct LinCircle
+
+/// Structure describing a triplet by the indices of its spacepoints
+struct Triplet {
+  unsigned int bottomIndex = static_cast<unsigned int>(-1);
+  unsigned int middleIndex = static_cast<unsigned int>(-1);
+  unsigned int topIndex = static_cast<unsigned int>(-1);
+  float impactParameter = 0.0f;
+  float invHelixDiameter = 0.0f;
+  float weight = 0.0f;
+};  // struct Triplet
+
+/// Structure holding pointers to the user defined filter functions
+///
+/// The functions are called on the device by the GPU seed finders and on the
+/// host by @c Acts::SeedfinderFlat, with the same arguments.
+struct TripletFilterConfig {
+  /// Type for the seed weighting functions
+  typedef float (*seedWeightFunc_t)(const SpacePoint&, const SpacePoint&,
+                                    const SpacePoint&);
+
+  /// Pointer to a function assigning weights to seed candidates
+  ///
+  /// The function receives the bottom, middle and top spacepoints (in this
+  /// order), and needs to return a float weight for the combination.
+  ///
+  seedWeightFunc_t seedWeight = nullptr;
+
+  /// Type for the seed filtering functions
+  typedef bool (*singleSeedCutFunc_t)(float, const SpacePoint&,
+                                      const SpacePoint&, const SpacePoint&);
+
+  /// Pointer to a function filtering seed candidates
+  ///
+  /// The function receives a previously assigned "seed weight", and references
+  /// to the bottom, middle and top spacepoints (in this order). It needs to
+  /// return an accept/reject decision for the combination.
+  ///
+  singleSeedCutFunc_t singleSeedCut = nullptr;
+
+};  // struct TripletFilterConfig
+
+}  // namespace FlatSeeding
+}  // namespace Acts
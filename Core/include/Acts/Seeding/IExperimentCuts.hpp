@@ -10,7 +10,8 @@
 
 #include "Acts/Seeding/InternalSeed.hpp"
 
-#include <memory>
+#include <utility>
+#include <vector>
 
 namespace Acts {
 /// @c IExperimentCuts can be used to increase or decrease seed weights
@@ -45,11 +46,8 @@ class IExperimentCuts {
   /// space
   /// point
   /// @return vector of seeds that pass the cut
-  virtual std::vector<
-      std::pair<float, std::unique_ptr<const InternalSeed<SpacePoint>>>>
+  virtual std::vector<std::pair<float, InternalSeed<SpacePoint>>>
   cutPerMiddleSP(
-      std::vector<
-          std::pair<float, std::unique_ptr<const InternalSeed<SpacePoint>>>>
-          seeds) const = 0;
+      std::vector<std::pair<float, InternalSeed<SpacePoint>>> seeds) const = 0;
 };
 }  // namespace Acts
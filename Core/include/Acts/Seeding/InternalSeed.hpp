@@ -11,7 +11,7 @@
 #include "Acts/Seeding/InternalSpacePoint.hpp"
 #include "Acts/Seeding/Seed.hpp"
 
-#include <memory>
+#include <array>
 
 namespace Acts {
 template <typename SpacePoint>
@@ -24,9 +24,8 @@ class InternalSeed {
   InternalSeed(const InternalSpacePoint<SpacePoint>& s0,
                const InternalSpacePoint<SpacePoint>& s1,
                const InternalSpacePoint<SpacePoint>& s2, float z);
-  InternalSeed& operator=(const InternalSeed& seed);
 
-  const std::array<const InternalSpacePoint<SpacePoint>*, 3> sp;
+  std::array<const InternalSpacePoint<SpacePoint>*, 3> sp;
   float z() const { return m_z; }
 
  protected:
@@ -39,14 +38,6 @@ class InternalSeed {
 // Inline methods
 /////////////////////////////////////////////////////////////////////////////////
 
-template <typename SpacePoint>
-inline InternalSeed<SpacePoint>& InternalSeed<SpacePoint>::operator=(
-    const InternalSeed<SpacePoint>& seed) {
-  m_z = seed.m_z;
-  sp = seed.sp;
-  return (*this);
-}
-
 template <typename SpacePoint>
 inline InternalSeed<SpacePoint>::InternalSeed(
     const InternalSpacePoint<SpacePoint>& s0,
@@ -13,6 +13,7 @@
 #include "Acts/Seeding/Seed.hpp"
 #include "Acts/Seeding/SeedFilterConfig.hpp"
 
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -31,8 +32,17 @@ class SeedFilter {
   SeedFilter() = delete;
   virtual ~SeedFilter() = default;
 
+  /// Scratch memory that can be reused for all bottom and middle space points.
+  struct State {
+    // top space points ordered by curvature
+    std::vector<size_t> curvatureOrder;
+    // whether a top space point is in the curvature window of the current one
+    std::vector<uint8_t> isCompatible;
+  };
+
   /// Create InternalSeeds for the all seeds with the same bottom and middle
   /// space point and discard all others.
+  /// @param state scratch memory that is reused between calls
   /// @param bottomSP fixed bottom space point
   /// @param middleSP fixed middle space point
   /// @param topSpVec vector containing all space points that may be compatible
@@ -40,25 +50,38 @@ class SeedFilter {
   /// @param invHelixDiameterVec vector containing 1/(2*r) values where r is the helix radius
   /// @param impactParametersVec vector containing the impact parameters
   /// @param zOrigin on the z axis as defined by bottom and middle space point
-  /// @return vector of pairs containing seed weight and seed for all valid
-  /// created seeds
-  virtual std::vector<std::pair<
-      float, std::unique_ptr<const InternalSeed<external_spacepoint_t>>>>
-  filterSeeds_2SpFixed(
+  /// @param selectedSeeds vector to which pairs containing seed weight and
+  /// seed are appended for all valid created seeds
+  virtual void filterSeeds_2SpFixed(
+      State& state, const InternalSpacePoint<external_spacepoint_t>& bottomSP,
+      const InternalSpacePoint<external_spacepoint_t>& middleSP,
+      std::vector<const InternalSpacePoint<external_spacepoint_t>*>& topSpVec,
+      std::vector<float>& invHelixDiameterVec,
+      std::vector<float>& impactParametersVec, float zOrigin,
+      std::vector<std::pair<float, InternalSeed<external_spacepoint_t>>>&
+          selectedSeeds) const;
+
+  /// Create InternalSeeds with temporary scratch memory.
+  void filterSeeds_2SpFixed(
       const InternalSpacePoint<external_spacepoint_t>& bottomSP,
       const InternalSpacePoint<external_spacepoint_t>& middleSP,
       std::vector<const InternalSpacePoint<external_spacepoint_t>*>& topSpVec,
       std::vector<float>& invHelixDiameterVec,
-      std::vector<float>& impactParametersVec, float zOrigin) const;
+      std::vector<float>& impactParametersVec, float zOrigin,
+      std::vector<std::pair<float, InternalSeed<external_spacepoint_t>>>&
+          selectedSeeds) const {
+    State state;
+    filterSeeds_2SpFixed(state, bottomSP, middleSP, topSpVec,
+                         invHelixDiameterVec, impactParametersVec, zOrigin,
+                         selectedSeeds);
+  }
 
   /// Filter seeds once all seeds for one middle space point have been created
   /// @param seedsPerSpM vector of pairs containing weight and seed for all
-  /// @param outVec output seeds
   /// for all seeds with the same middle space point
-  /// @return vector of all InternalSeeds that not filtered out
+  /// @param outVec output seeds
   virtual void filterSeeds_1SpFixed(
-      std::vector<std::pair<
-          float, std::unique_ptr<const InternalSeed<external_spacepoint_t>>>>&
+      std::vector<std::pair<float, InternalSeed<external_spacepoint_t>>>&
           seedsPerSpM,
       std::vector<Seed<external_spacepoint_t>>& outVec) const;
   const SeedFilterConfig getSeedFilterConfig() const { return m_cfg; }
@@ -6,8 +6,13 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
 #include <utility>
 
+#include <boost/container/small_vector.hpp>
+
 namespace Acts {
 // constructor
 template <typename external_spacepoint_t>
@@ -18,25 +23,39 @@ SeedFilter<external_spacepoint_t>::SeedFilter(
 
 // function to filter seeds based on all seeds with same bottom- and
 // middle-spacepoint.
-// return vector must contain weight of each seed
+// output vector must contain weight of each seed
 template <typename external_spacepoint_t>
-std::vector<std::pair<
-    float, std::unique_ptr<const InternalSeed<external_spacepoint_t>>>>
-SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
-    const InternalSpacePoint<external_spacepoint_t>& bottomSP,
+void SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
+    State& state, const InternalSpacePoint<external_spacepoint_t>& bottomSP,
     const InternalSpacePoint<external_spacepoint_t>& middleSP,
     std::vector<const InternalSpacePoint<external_spacepoint_t>*>& topSpVec,
     std::vector<float>& invHelixDiameterVec,
-    std::vector<float>& impactParametersVec, float zOrigin) const {
-  std::vector<std::pair<
-      float, std::unique_ptr<const InternalSeed<external_spacepoint_t>>>>
-      selectedSeeds;
+    std::vector<float>& impactParametersVec, float zOrigin,
+    std::vector<std::pair<float, InternalSeed<external_spacepoint_t>>>&
+        selectedSeeds) const {
+  // if two compatible seeds with high distance in r are found, compatible
+  // seeds span 5 layers
+  // -> very good seed
+  boost::container::small_vector<float, 8> compatibleSeedR;
+
+  // compatible seeds must have a similar curvature. sort the top space points
+  // by curvature once, such that only those within the curvature window are
+  // visited. a NaN curvature passes every window check and is kept in front.
+  auto& curvatureOrder = state.curvatureOrder;
+  curvatureOrder.resize(topSpVec.size());
+  std::iota(curvatureOrder.begin(), curvatureOrder.end(), 0u);
+  auto nanEnd = std::partition(
+      curvatureOrder.begin(), curvatureOrder.end(),
+      [&](size_t j) { return std::isnan(invHelixDiameterVec[j]); });
+  std::sort(nanEnd, curvatureOrder.end(), [&](size_t lhs, size_t rhs) {
+    return invHelixDiameterVec[lhs] < invHelixDiameterVec[rhs];
+  });
+  // the marks are removed again after every top space point
+  auto& isCompatible = state.isCompatible;
+  isCompatible.assign(topSpVec.size(), 0u);
 
   for (size_t i = 0; i < topSpVec.size(); i++) {
-    // if two compatible seeds with high distance in r are found, compatible
-    // seeds span 5 layers
-    // -> very good seed
-    std::vector<float> compatibleSeedR;
+    compatibleSeedR.clear();
 
     float invHelixDiameter = invHelixDiameterVec[i];
     float lowerLimitCurv = invHelixDiameter - m_cfg.deltaInvHelixDiameter;
@@ -44,9 +63,38 @@ SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
     float currentTop_r = topSpVec[i]->radius();
     float impact = impactParametersVec[i];
 
+    // curvature difference within limits? mark the candidates in the window
+    // and visit them in their original order, since the compatible seed
+    // selection depends on it
+    auto windowBegin = nanEnd;
+    auto windowEnd = curvatureOrder.end();
+    if (not std::isnan(invHelixDiameter)) {
+      windowBegin = std::lower_bound(
+          nanEnd, curvatureOrder.end(), lowerLimitCurv,
+          [&](size_t j, float limit) {
+            return invHelixDiameterVec[j] < limit;
+          });
+      windowEnd = std::upper_bound(
+          windowBegin, curvatureOrder.end(), upperLimitCurv,
+          [&](float limit, size_t j) {
+            return limit < invHelixDiameterVec[j];
+          });
+    }
+    size_t firstCompatible = topSpVec.size();
+    size_t lastCompatible = 0;
+    auto mark = [&](auto begin, auto end, uint8_t value) {
+      for (auto it = begin; it != end; ++it) {
+        isCompatible[*it] = value;
+        firstCompatible = std::min(firstCompatible, *it);
+        lastCompatible = std::max(lastCompatible, *it + 1);
+      }
+    };
+    mark(curvatureOrder.begin(), nanEnd, 1u);
+    mark(windowBegin, windowEnd, 1u);
+
     float weight = -(impact * m_cfg.impactWeightFactor);
-    for (size_t j = 0; j < topSpVec.size(); j++) {
-      if (i == j) {
+    for (size_t j = firstCompatible; j < lastCompatible; ++j) {
+      if (i == j or not isCompatible[j]) {
         continue;
       }
       // compared top SP should have at least deltaRMin distance
@@ -55,15 +103,6 @@ SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
       if (std::abs(deltaR) < m_cfg.deltaRMin) {
         continue;
       }
-      // curvature difference within limits?
-      // TODO: how much slower than sorting all vectors by curvature
-      // and breaking out of loop? i.e. is vector size large (e.g. in jets?)
-      if (invHelixDiameterVec[j] < lowerLimitCurv) {
-        continue;
-      }
-      if (invHelixDiameterVec[j] > upperLimitCurv) {
-        continue;
-      }
       bool newCompSeed = true;
       for (float previousDiameter : compatibleSeedR) {
         // original ATLAS code uses higher min distance for 2nd found compatible
@@ -83,6 +122,8 @@ SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
         break;
       }
     }
+    mark(curvatureOrder.begin(), nanEnd, 0u);
+    mark(windowBegin, windowEnd, 0u);
 
     if (m_experimentCuts != nullptr) {
       // add detector specific considerations on the seed weight
@@ -93,45 +134,47 @@ SeedFilter<external_spacepoint_t>::filterSeeds_2SpFixed(
         continue;
       }
     }
-    selectedSeeds.push_back(std::make_pair(
-        weight, std::make_unique<const InternalSeed<external_spacepoint_t>>(
-                    bottomSP, middleSP, *topSpVec[i], zOrigin)));
+    selectedSeeds.emplace_back(
+        weight, InternalSeed<external_spacepoint_t>(bottomSP, middleSP,
+                                                     *topSpVec[i], zOrigin));
   }
-  return selectedSeeds;
 }
 
 // after creating all seeds with a common middle space point, filter again
 template <typename external_spacepoint_t>
 void SeedFilter<external_spacepoint_t>::filterSeeds_1SpFixed(
-    std::vector<std::pair<
-        float, std::unique_ptr<const InternalSeed<external_spacepoint_t>>>>&
+    std::vector<std::pair<float, InternalSeed<external_spacepoint_t>>>&
         seedsPerSpM,
     std::vector<Seed<external_spacepoint_t>>& outVec) const {
   // sort by weight and iterate only up to configured max number of seeds per
   // middle SP
-  std::sort((seedsPerSpM.begin()), (seedsPerSpM.end()),
-            [](const std::pair<float, std::unique_ptr<const Acts::InternalSeed<
-                                          external_spacepoint_t>>>& i1,
-               const std::pair<float, std::unique_ptr<const Acts::InternalSeed<
-                                          external_spacepoint_t>>>& i2) {
-              if (i1.first != i2.first) {
-                return i1.first > i2.first;
-              } else {
-                // This is for the case when the weights from different seeds
-                // are same. This makes cpu & cuda results same
-                float seed1_sum = 0;
-                float seed2_sum = 0;
-                for (int i = 0; i < 3; i++) {
-                  seed1_sum += pow(i1.second->sp[i]->sp().y(), 2) +
-                               pow(i1.second->sp[i]->sp().z(), 2);
-                  seed2_sum += pow(i2.second->sp[i]->sp().y(), 2) +
-                               pow(i2.second->sp[i]->sp().z(), 2);
-                }
-                return seed1_sum > seed2_sum;
-              }
-            });
+  auto heavierSeed = [](const auto& i1, const auto& i2) {
+    if (i1.first != i2.first) {
+      return i1.first > i2.first;
+    } else {
+      // This is for the case when the weights from different seeds
+      // are same. This makes cpu & cuda results same
+      float seed1_sum = 0;
+      float seed2_sum = 0;
+      for (int i = 0; i < 3; i++) {
+        seed1_sum += pow(i1.second.sp[i]->sp().y(), 2) +
+                     pow(i1.second.sp[i]->sp().z(), 2);
+        seed2_sum += pow(i2.second.sp[i]->sp().y(), 2) +
+                     pow(i2.second.sp[i]->sp().z(), 2);
+      }
+      return seed1_sum > seed2_sum;
+    }
+  };
   if (m_experimentCuts != nullptr) {
+    // the experiment cuts may look at all seeds
+    std::sort(seedsPerSpM.begin(), seedsPerSpM.end(), heavierSeed);
     seedsPerSpM = m_experimentCuts->cutPerMiddleSP(std::move(seedsPerSpM));
+  } else {
+    // only the heaviest seeds are kept; order just those
+    size_t numKept = std::min<size_t>(seedsPerSpM.size(),
+                                      size_t(m_cfg.maxSeedsPerSpM) + 1);
+    std::partial_sort(seedsPerSpM.begin(), seedsPerSpM.begin() + numKept,
+                      seedsPerSpM.end(), heavierSeed);
   }
   unsigned int maxSeeds = seedsPerSpM.size();
 
@@ -145,8 +188,8 @@ void SeedFilter<external_spacepoint_t>::filterSeeds_1SpFixed(
   // weight seeds
   for (; it < itBegin + maxSeeds; ++it) {
     outVec.push_back(Seed<external_spacepoint_t>(
-        (*it).second->sp[0]->sp(), (*it).second->sp[1]->sp(),
-        (*it).second->sp[2]->sp(), (*it).second->z()));
+        (*it).second.sp[0]->sp(), (*it).second.sp[1]->sp(),
+        (*it).second.sp[2]->sp(), (*it).second.z()));
   }
 }
 
@@ -10,9 +10,12 @@
 
 #include "Acts/Seeding/InternalSeed.hpp"
 #include "Acts/Seeding/InternalSpacePoint.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
 #include "Acts/Seeding/SeedfinderConfig.hpp"
 
 #include <array>
+#include <chrono>
+#include <cstdint>
 #include <list>
 #include <map>
 #include <memory>
@@ -30,6 +33,10 @@ struct LinCircle {
   float U;
   float V;
 };
+
+template <typename external_spacepoint_t>
+class SeedfinderOrthogonal;
+
 template <typename external_spacepoint_t, typename platform_t = void*>
 class Seedfinder {
   ///////////////////////////////////////////////////////////////////
@@ -49,6 +56,59 @@ class Seedfinder {
       const Seedfinder<external_spacepoint_t, platform_t>&) = delete;
   //@}
 
+  /// Scratch memory used during the seed creation. The vectors keep their
+  /// capacity, such that reusing one state for many groups and events avoids
+  /// heap allocations once it has grown to the largest group.
+  /// @note Each thread calling the seed finder needs its own state.
+  struct State {
+    // bottom and top candidates of the current group sorted in r
+    std::vector<const InternalSpacePoint<external_spacepoint_t>*> bottomSPVec;
+    std::vector<float> bottomRVec;
+    std::vector<const InternalSpacePoint<external_spacepoint_t>*> topSPVec;
+    std::vector<float> topRVec;
+    // scratch memory for the sorting: the candidates in range order and
+    // their radius and position in the range
+    std::vector<const InternalSpacePoint<external_spacepoint_t>*> rangeSPVec;
+    std::vector<std::pair<float, size_t>> radiusOrder;
+
+    // doublets compatible with the current middle space point
+    std::vector<const InternalSpacePoint<external_spacepoint_t>*>
+        compatBottomSP;
+    std::vector<const InternalSpacePoint<external_spacepoint_t>*> compatTopSP;
+    std::vector<LinCircle> linCircleBottom;
+    std::vector<LinCircle> linCircleTop;
+    std::vector<float> topU;
+    std::vector<float> topV;
+    std::vector<uint8_t> selectedTop;
+
+    // triplets for the current bottom and middle space point
+    std::vector<const InternalSpacePoint<external_spacepoint_t>*> topSpVec;
+    std::vector<float> curvatures;
+    std::vector<float> impactParameters;
+    typename SeedFilter<external_spacepoint_t>::State filterState;
+
+    // weighted seeds for the current middle space point
+    std::vector<std::pair<float, InternalSeed<external_spacepoint_t>>>
+        seedsPerSpM;
+
+    /// Accumulate the time spent in the doublet search, the triplet search
+    /// and the seed filter, e.g. for benchmarks. Off by default.
+    bool measureTime = false;
+    std::chrono::duration<double> doubletTime{0};
+    std::chrono::duration<double> tripletTime{0};
+    std::chrono::duration<double> filterTime{0};
+    std::chrono::steady_clock::time_point lapTime;
+
+    /// Add the time since the previous lap to one of the phases.
+    void lap(std::chrono::duration<double>& phaseTime) {
+      if (measureTime) {
+        auto time = std::chrono::steady_clock::now();
+        phaseTime += time - lapTime;
+        lapTime = time;
+      }
+    }
+  };
+
   /// Create all seeds from the space points in the three iterators.
   /// Can be used to parallelize the seed creation
   /// @param bottomSPs group of space points to be used as innermost SP in a seed.
@@ -61,7 +121,62 @@ class Seedfinder {
   std::vector<Seed<external_spacepoint_t>> createSeedsForGroup(
       sp_range_t bottomSPs, sp_range_t middleSPs, sp_range_t topSPs) const;
 
+  /// Create all seeds from the space points in the three iterators using
+  /// the scratch memory of a caller-owned state.
+  /// @param state scratch memory, reused between calls
+  /// @param outputVec vector to which the seeds of this group are appended
+  /// @param bottomSPs group of space points to be used as innermost SP in a seed.
+  /// @param middleSPs group of space points to be used as middle SP in a seed.
+  /// @param topSPs group of space points to be used as outermost SP in a seed.
+  /// @note Ranges must return pointers.
+  /// @note Ranges must be separate objects for each parallel call.
+  template <typename sp_range_t>
+  void createSeedsForGroup(State& state,
+                           std::vector<Seed<external_spacepoint_t>>& outputVec,
+                           sp_range_t bottomSPs, sp_range_t middleSPs,
+                           sp_range_t topSPs) const;
+
  private:
+  // shares the doublet and triplet search with the grid based finder
+  friend class SeedfinderOrthogonal<external_spacepoint_t>;
+
+  /// Collect the space points of a range sorted in r together with their
+  /// radii in a separate contiguous array.
+  template <typename sp_range_t>
+  void sortByRadius(
+      State& state, sp_range_t& spRange,
+      std::vector<const InternalSpacePoint<external_spacepoint_t>*>& spVec,
+      std::vector<float>& rVec) const;
+
+  /// Collect the bottom or top space points that form a doublet with the
+  /// middle space point.
+  /// @param spM the middle space point
+  /// @param spVec the candidates sorted in r
+  /// @param rVec the radii of the candidates
+  /// @param bottom whether the candidates are bottom or top space points
+  /// @param compatSP the compatible candidates, overwritten
+  void getCompatibleDoublets(
+      const InternalSpacePoint<external_spacepoint_t>& spM,
+      const std::vector<const InternalSpacePoint<external_spacepoint_t>*>&
+          spVec,
+      const std::vector<float>& rVec, bool bottom,
+      std::vector<const InternalSpacePoint<external_spacepoint_t>*>& compatSP)
+      const;
+
+  /// Check the cotTheta and collision region cuts of a doublet.
+  /// @param rM radius of the middle space point
+  /// @param zM z of the middle space point
+  /// @param deltaR radial distance between the inner and outer space point
+  /// @param deltaZ z of the outer minus z of the inner space point
+  bool isCompatibleDoublet(float rM, float zM, float deltaR,
+                           float deltaZ) const;
+
+  /// Create the seeds of one middle space point from the compatible doublets
+  /// in state.compatBottomSP and state.compatTopSP.
+  void createSeedsForMiddle(
+      State& state, const InternalSpacePoint<external_spacepoint_t>& spM,
+      std::vector<Seed<external_spacepoint_t>>& outputVec) const;
+
   void transformCoordinates(
       std::vector<const InternalSpacePoint<external_spacepoint_t>*>& vec,
       const InternalSpacePoint<external_spacepoint_t>& spM, bool bottom,
@@ -7,8 +7,11 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/detail/TripletPreselection.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <numeric>
 #include <type_traits>
 
@@ -39,216 +42,299 @@ template <typename sp_range_t>
 std::vector<Seed<external_spacepoint_t>>
 Seedfinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
     sp_range_t bottomSPs, sp_range_t middleSPs, sp_range_t topSPs) const {
+  State state;
   std::vector<Seed<external_spacepoint_t>> outputVec;
-  for (auto spM : middleSPs) {
-    float rM = spM->radius();
-    float zM = spM->z();
-    float varianceRM = spM->varianceR();
-    float varianceZM = spM->varianceZ();
+  createSeedsForGroup(state, outputVec, std::move(bottomSPs),
+                      std::move(middleSPs), std::move(topSPs));
+  return outputVec;
+}
 
-    // bottom space point
-    std::vector<const InternalSpacePoint<external_spacepoint_t>*>
-        compatBottomSP;
+template <typename external_spacepoint_t, typename platform_t>
+template <typename sp_range_t>
+void Seedfinder<external_spacepoint_t, platform_t>::createSeedsForGroup(
+    State& state, std::vector<Seed<external_spacepoint_t>>& outputVec,
+    sp_range_t bottomSPs, sp_range_t middleSPs, sp_range_t topSPs) const {
+  // nothing to do for groups without middle space points
+  if (!(middleSPs.begin() != middleSPs.end())) {
+    return;
+  }
 
-    for (auto bottomSP : bottomSPs) {
-      float rB = bottomSP->radius();
-      float deltaR = rM - rB;
-      // if r-distance is too big, try next SP in bin
-      if (deltaR > m_config.deltaRMax) {
-        continue;
-      }
-      // if r-distance is too small, continue because bins are NOT r-sorted
-      if (deltaR < m_config.deltaRMin) {
-        continue;
-      }
-      // ratio Z/R (forward angle) of space point duplet
-      float cotTheta = (zM - bottomSP->z()) / deltaR;
-      if (std::fabs(cotTheta) > m_config.cotThetaMax) {
-        continue;
-      }
-      // check if duplet origin on z axis within collision region
-      float zOrigin = zM - rM * cotTheta;
-      if (zOrigin < m_config.collisionRegionMin ||
-          zOrigin > m_config.collisionRegionMax) {
-        continue;
-      }
-      compatBottomSP.push_back(bottomSP);
-    }
+  if (state.measureTime) {
+    state.lapTime = std::chrono::steady_clock::now();
+  }
+
+  // sort the bottom and top candidates in r once per group, such that the
+  // doublet search only visits the allowed deltaR window
+  sortByRadius(state, bottomSPs, state.bottomSPVec, state.bottomRVec);
+  sortByRadius(state, topSPs, state.topSPVec, state.topRVec);
+
+  for (auto spM : middleSPs) {
+    getCompatibleDoublets(*spM, state.bottomSPVec, state.bottomRVec, true,
+                          state.compatBottomSP);
     // no bottom SP found -> try next spM
-    if (compatBottomSP.empty()) {
+    if (state.compatBottomSP.empty()) {
+      state.lap(state.doubletTime);
+      continue;
+    }
+    getCompatibleDoublets(*spM, state.topSPVec, state.topRVec, false,
+                          state.compatTopSP);
+    if (state.compatTopSP.empty()) {
+      state.lap(state.doubletTime);
       continue;
     }
+    createSeedsForMiddle(state, *spM, outputVec);
+  }
+}
 
-    std::vector<const InternalSpacePoint<external_spacepoint_t>*> compatTopSP;
+template <typename external_spacepoint_t, typename platform_t>
+void Seedfinder<external_spacepoint_t, platform_t>::getCompatibleDoublets(
+    const InternalSpacePoint<external_spacepoint_t>& spM,
+    const std::vector<const InternalSpacePoint<external_spacepoint_t>*>& spVec,
+    const std::vector<float>& rVec, bool bottom,
+    std::vector<const InternalSpacePoint<external_spacepoint_t>*>& compatSP)
+    const {
+  float rM = spM.radius();
+  float zM = spM.z();
+  compatSP.clear();
 
-    for (auto topSP : topSPs) {
-      float rT = topSP->radius();
-      float deltaR = rT - rM;
-      // this condition is the opposite of the condition for bottom SP
+  if (bottom) {
+    // skip the SPs with too large r-distance
+    size_t bottomBegin =
+        std::partition_point(
+            rVec.begin(), rVec.end(),
+            [&](float rB) { return rM - rB > m_config.deltaRMax; }) -
+        rVec.begin();
+    for (size_t ib = bottomBegin; ib < rVec.size(); ++ib) {
+      float deltaR = rM - rVec[ib];
+      // if r-distance is too small, all remaining SPs are too close
       if (deltaR < m_config.deltaRMin) {
-        continue;
+        break;
       }
-      if (deltaR > m_config.deltaRMax) {
-        continue;
+      auto bottomSP = spVec[ib];
+      if (isCompatibleDoublet(rM, zM, deltaR, zM - bottomSP->z())) {
+        compatSP.push_back(bottomSP);
       }
+    }
+    return;
+  }
 
-      float cotTheta = (topSP->z() - zM) / deltaR;
-      if (std::fabs(cotTheta) > m_config.cotThetaMax) {
-        continue;
-      }
-      float zOrigin = zM - rM * cotTheta;
-      if (zOrigin < m_config.collisionRegionMin ||
-          zOrigin > m_config.collisionRegionMax) {
-        continue;
-      }
-      compatTopSP.push_back(topSP);
+  // this condition is the opposite of the condition for bottom SP
+  size_t topBegin =
+      std::partition_point(
+          rVec.begin(), rVec.end(),
+          [&](float rT) { return rT - rM < m_config.deltaRMin; }) -
+      rVec.begin();
+  for (size_t it = topBegin; it < rVec.size(); ++it) {
+    float deltaR = rVec[it] - rM;
+    if (deltaR > m_config.deltaRMax) {
+      break;
     }
-    if (compatTopSP.empty()) {
-      continue;
+    auto topSP = spVec[it];
+    if (isCompatibleDoublet(rM, zM, deltaR, topSP->z() - zM)) {
+      compatSP.push_back(topSP);
     }
-    // contains parameters required to calculate circle with linear equation
-    // ...for bottom-middle
-    std::vector<LinCircle> linCircleBottom;
-    // ...for middle-top
-    std::vector<LinCircle> linCircleTop;
-    transformCoordinates(compatBottomSP, *spM, true, linCircleBottom);
-    transformCoordinates(compatTopSP, *spM, false, linCircleTop);
+  }
+}
 
-    // create vectors here to avoid reallocation in each loop
-    std::vector<const InternalSpacePoint<external_spacepoint_t>*> topSpVec;
-    std::vector<float> curvatures;
-    std::vector<float> impactParameters;
+template <typename external_spacepoint_t, typename platform_t>
+bool Seedfinder<external_spacepoint_t, platform_t>::isCompatibleDoublet(
+    float rM, float zM, float deltaR, float deltaZ) const {
+  // ratio Z/R (forward angle) of space point duplet
+  float cotTheta = deltaZ / deltaR;
+  if (std::fabs(cotTheta) > m_config.cotThetaMax) {
+    return false;
+  }
+  // check if duplet origin on z axis within collision region
+  float zOrigin = zM - rM * cotTheta;
+  return !(zOrigin < m_config.collisionRegionMin ||
+           zOrigin > m_config.collisionRegionMax);
+}
 
-    std::vector<std::pair<
-        float, std::unique_ptr<const InternalSeed<external_spacepoint_t>>>>
-        seedsPerSpM;
-    size_t numBotSP = compatBottomSP.size();
-    size_t numTopSP = compatTopSP.size();
+template <typename external_spacepoint_t, typename platform_t>
+void Seedfinder<external_spacepoint_t, platform_t>::createSeedsForMiddle(
+    State& state, const InternalSpacePoint<external_spacepoint_t>& spM,
+    std::vector<Seed<external_spacepoint_t>>& outputVec) const {
+  float rM = spM.radius();
+  float varianceRM = spM.varianceR();
+  float varianceZM = spM.varianceZ();
 
-    for (size_t b = 0; b < numBotSP; b++) {
-      auto lb = linCircleBottom[b];
-      float Zob = lb.Zo;
-      float cotThetaB = lb.cotTheta;
-      float Vb = lb.V;
-      float Ub = lb.U;
-      float ErB = lb.Er;
-      float iDeltaRB = lb.iDeltaR;
+  auto& compatBottomSP = state.compatBottomSP;
+  auto& compatTopSP = state.compatTopSP;
+  // contains parameters required to calculate circle with linear equation
+  // ...for bottom-middle
+  auto& linCircleBottom = state.linCircleBottom;
+  // ...for middle-top
+  auto& linCircleTop = state.linCircleTop;
+  auto& topU = state.topU;
+  auto& topV = state.topV;
+  auto& selectedTop = state.selectedTop;
+  auto& topSpVec = state.topSpVec;
+  auto& curvatures = state.curvatures;
+  auto& impactParameters = state.impactParameters;
+  auto& seedsPerSpM = state.seedsPerSpM;
 
-      // 1+(cot^2(theta)) = 1/sin^2(theta)
-      float iSinTheta2 = (1. + cotThetaB * cotThetaB);
-      // calculate max scattering for min momentum at the seed's theta angle
-      // scaling scatteringAngle^2 by sin^2(theta) to convert pT^2 to p^2
-      // accurate would be taking 1/atan(thetaBottom)-1/atan(thetaTop) <
-      // scattering
-      // but to avoid trig functions we approximate cot by scaling by
-      // 1/sin^4(theta)
-      // resolving with pT to p scaling --> only divide by sin^2(theta)
-      // max approximation error for allowed scattering angles of 0.04 rad at
-      // eta=infinity: ~8.5%
-      float scatteringInRegion2 = m_config.maxScatteringAngle2 * iSinTheta2;
-      // multiply the squared sigma onto the squared scattering
-      scatteringInRegion2 *=
-          m_config.sigmaScattering * m_config.sigmaScattering;
+  linCircleBottom.clear();
+  linCircleTop.clear();
+  transformCoordinates(compatBottomSP, spM, true, linCircleBottom);
+  transformCoordinates(compatTopSP, spM, false, linCircleTop);
+  state.lap(state.doubletTime);
 
-      // clear all vectors used in each inner for loop
-      topSpVec.clear();
-      curvatures.clear();
-      impactParameters.clear();
-      for (size_t t = 0; t < numTopSP; t++) {
-        auto lt = linCircleTop[t];
+  seedsPerSpM.clear();
+  size_t numBotSP = compatBottomSP.size();
+  size_t numTopSP = compatTopSP.size();
 
-        // add errors of spB-spM and spM-spT pairs and add the correlation term
-        // for errors on spM
-        float error2 = lt.Er + ErB +
-                       2 * (cotThetaB * lt.cotTheta * varianceRM + varianceZM) *
-                           iDeltaRB * lt.iDeltaR;
+  // contiguous copies of the top doublet parameters for the vectorized
+  // pre-selection
+  topU.resize(numTopSP);
+  topV.resize(numTopSP);
+  for (size_t t = 0; t < numTopSP; t++) {
+    topU[t] = linCircleTop[t].U;
+    topV[t] = linCircleTop[t].V;
+  }
+  selectedTop.resize(numTopSP);
 
-        float deltaCotTheta = cotThetaB - lt.cotTheta;
-        float deltaCotTheta2 = deltaCotTheta * deltaCotTheta;
-        float error;
-        float dCotThetaMinusError2;
-        // if the error is larger than the difference in theta, no need to
-        // compare with scattering
-        if (deltaCotTheta2 - error2 > 0) {
-          deltaCotTheta = std::abs(deltaCotTheta);
-          // if deltaTheta larger than the scattering for the lower pT cut, skip
-          error = std::sqrt(error2);
-          dCotThetaMinusError2 =
-              deltaCotTheta2 + error2 - 2 * deltaCotTheta * error;
-          // avoid taking root of scatteringInRegion
-          // if left side of ">" is positive, both sides of unequality can be
-          // squared
-          // (scattering is always positive)
+  for (size_t b = 0; b < numBotSP; b++) {
+    auto lb = linCircleBottom[b];
+    float Zob = lb.Zo;
+    float cotThetaB = lb.cotTheta;
+    float Vb = lb.V;
+    float Ub = lb.U;
+    float ErB = lb.Er;
+    float iDeltaRB = lb.iDeltaR;
 
-          if (dCotThetaMinusError2 > scatteringInRegion2) {
-            continue;
-          }
-        }
+    // 1+(cot^2(theta)) = 1/sin^2(theta)
+    float iSinTheta2 = (1. + cotThetaB * cotThetaB);
+    // calculate max scattering for min momentum at the seed's theta angle
+    // scaling scatteringAngle^2 by sin^2(theta) to convert pT^2 to p^2
+    // accurate would be taking 1/atan(thetaBottom)-1/atan(thetaTop) <
+    // scattering
+    // but to avoid trig functions we approximate cot by scaling by
+    // 1/sin^4(theta)
+    // resolving with pT to p scaling --> only divide by sin^2(theta)
+    // max approximation error for allowed scattering angles of 0.04 rad at
+    // eta=infinity: ~8.5%
+    float scatteringInRegion2 = m_config.maxScatteringAngle2 * iSinTheta2;
+    // multiply the squared sigma onto the squared scattering
+    scatteringInRegion2 *= m_config.sigmaScattering * m_config.sigmaScattering;
 
-        // protects against division by 0
-        float dU = lt.U - Ub;
-        if (dU == 0.) {
-          continue;
-        }
-        // A and B are evaluated as a function of the circumference parameters
-        // x_0 and y_0
-        float A = (lt.V - Vb) / dU;
-        float S2 = 1. + A * A;
-        float B = Vb - A * Ub;
-        float B2 = B * B;
-        // sqrt(S2)/B = 2 * helixradius
-        // calculated radius must not be smaller than minimum radius
-        if (S2 < B2 * m_config.minHelixDiameter2) {
-          continue;
-        }
-        // 1/helixradius: (B/sqrt(S2))*2 (we leave everything squared)
-        float iHelixDiameter2 = B2 / S2;
-        // calculate scattering for p(T) calculated from seed curvature
-        float pT2scatter = 4 * iHelixDiameter2 * m_config.pT2perRadius;
-        // if pT > maxPtScattering, calculate allowed scattering angle using
-        // maxPtScattering instead of pt.
-        float pT = m_config.pTPerHelixRadius * std::sqrt(S2 / B2) / 2.;
-        if (pT > m_config.maxPtScattering) {
-          float pTscatter = m_config.highland / m_config.maxPtScattering;
-          pT2scatter = pTscatter * pTscatter;
-        }
-        // convert p(T) to p scaling by sin^2(theta) AND scale by 1/sin^4(theta)
-        // from rad to deltaCotTheta
-        float p2scatter = pT2scatter * iSinTheta2;
-        // if deltaTheta larger than allowed scattering for calculated pT, skip
-        if ((deltaCotTheta2 - error2 > 0) &&
-            (dCotThetaMinusError2 >
-             p2scatter * m_config.sigmaScattering * m_config.sigmaScattering)) {
+    // clear all vectors used in each inner for loop
+    topSpVec.clear();
+    curvatures.clear();
+    impactParameters.clear();
+    detail::preselectTriplets(Ub, Vb, topU.data(), topV.data(), numTopSP, rM,
+                              m_config.minHelixDiameter2, m_config.impactMax,
+                              selectedTop.data());
+    for (size_t t = 0; t < numTopSP; t++) {
+      // helix diameter and impact parameter cuts
+      if (selectedTop[t] == 0) {
+        continue;
+      }
+      auto lt = linCircleTop[t];
+
+      // add errors of spB-spM and spM-spT pairs and add the correlation term
+      // for errors on spM
+      float error2 = lt.Er + ErB +
+                     2 * (cotThetaB * lt.cotTheta * varianceRM + varianceZM) *
+                         iDeltaRB * lt.iDeltaR;
+
+      float deltaCotTheta = cotThetaB - lt.cotTheta;
+      float deltaCotTheta2 = deltaCotTheta * deltaCotTheta;
+      float error;
+      float dCotThetaMinusError2 = 0;
+      // if the error is larger than the difference in theta, no need to
+      // compare with scattering
+      if (deltaCotTheta2 - error2 > 0) {
+        deltaCotTheta = std::abs(deltaCotTheta);
+        // if deltaTheta larger than the scattering for the lower pT cut, skip
+        error = std::sqrt(error2);
+        dCotThetaMinusError2 =
+            deltaCotTheta2 + error2 - 2 * deltaCotTheta * error;
+        // avoid taking root of scatteringInRegion
+        // if left side of ">" is positive, both sides of unequality can be
+        // squared
+        // (scattering is always positive)
+
+        if (dCotThetaMinusError2 > scatteringInRegion2) {
           continue;
         }
-        // A and B allow calculation of impact params in U/V plane with linear
-        // function
-        // (in contrast to having to solve a quadratic function in x/y plane)
-        float Im = std::abs((A - B * rM) * rM);
+      }
 
-        if (Im <= m_config.impactMax) {
-          topSpVec.push_back(compatTopSP[t]);
-          // inverse diameter is signed depending if the curvature is
-          // positive/negative in phi
-          curvatures.push_back(B / std::sqrt(S2));
-          impactParameters.push_back(Im);
-        }
+      // A and B are evaluated as a function of the circumference parameters
+      // x_0 and y_0; dU is non-zero for pre-selected candidates
+      float dU = lt.U - Ub;
+      float A = (lt.V - Vb) / dU;
+      float S2 = 1. + A * A;
+      float B = Vb - A * Ub;
+      float B2 = B * B;
+      // sqrt(S2)/B = 2 * helixradius
+      // 1/helixradius: (B/sqrt(S2))*2 (we leave everything squared)
+      float iHelixDiameter2 = B2 / S2;
+      // calculate scattering for p(T) calculated from seed curvature
+      float pT2scatter = 4 * iHelixDiameter2 * m_config.pT2perRadius;
+      // if pT > maxPtScattering, calculate allowed scattering angle using
+      // maxPtScattering instead of pt.
+      float pT = m_config.pTPerHelixRadius * std::sqrt(S2 / B2) / 2.;
+      if (pT > m_config.maxPtScattering) {
+        float pTscatter = m_config.highland / m_config.maxPtScattering;
+        pT2scatter = pTscatter * pTscatter;
       }
-      if (!topSpVec.empty()) {
-        std::vector<std::pair<
-            float, std::unique_ptr<const InternalSeed<external_spacepoint_t>>>>
-            sameTrackSeeds;
-        sameTrackSeeds = std::move(m_config.seedFilter->filterSeeds_2SpFixed(
-            *compatBottomSP[b], *spM, topSpVec, curvatures, impactParameters,
-            Zob));
-        seedsPerSpM.insert(seedsPerSpM.end(),
-                           std::make_move_iterator(sameTrackSeeds.begin()),
-                           std::make_move_iterator(sameTrackSeeds.end()));
+      // convert p(T) to p scaling by sin^2(theta) AND scale by 1/sin^4(theta)
+      // from rad to deltaCotTheta
+      float p2scatter = pT2scatter * iSinTheta2;
+      // if deltaTheta larger than allowed scattering for calculated pT, skip
+      if ((deltaCotTheta2 - error2 > 0) &&
+          (dCotThetaMinusError2 >
+           p2scatter * m_config.sigmaScattering * m_config.sigmaScattering)) {
+        continue;
       }
+      // A and B allow calculation of impact params in U/V plane with linear
+      // function
+      // (in contrast to having to solve a quadratic function in x/y plane)
+      float Im = std::abs((A - B * rM) * rM);
+
+      topSpVec.push_back(compatTopSP[t]);
+      // inverse diameter is signed depending if the curvature is
+      // positive/negative in phi
+      curvatures.push_back(B / std::sqrt(S2));
+      impactParameters.push_back(Im);
+    }
+    if (!topSpVec.empty()) {
+      state.lap(state.tripletTime);
+      m_config.seedFilter->filterSeeds_2SpFixed(
+          state.filterState, *compatBottomSP[b], spM, topSpVec, curvatures,
+          impactParameters, Zob, seedsPerSpM);
+      state.lap(state.filterTime);
     }
-    m_config.seedFilter->filterSeeds_1SpFixed(seedsPerSpM, outputVec);
   }
-  return outputVec;
+  state.lap(state.tripletTime);
+  m_config.seedFilter->filterSeeds_1SpFixed(seedsPerSpM, outputVec);
+  state.lap(state.filterTime);
+}
+
+template <typename external_spacepoint_t, typename platform_t>
+template <typename sp_range_t>
+void Seedfinder<external_spacepoint_t, platform_t>::sortByRadius(
+    State& state, sp_range_t& spRange,
+    std::vector<const InternalSpacePoint<external_spacepoint_t>*>& spVec,
+    std::vector<float>& rVec) const {
+  auto& rangeSPVec = state.rangeSPVec;
+  auto& radiusOrder = state.radiusOrder;
+  rangeSPVec.clear();
+  radiusOrder.clear();
+  for (auto sp : spRange) {
+    radiusOrder.emplace_back(sp->radius(), rangeSPVec.size());
+    rangeSPVec.push_back(sp);
+  }
+  // the bins are already sorted in r; keep their order for equal radii. the
+  // position breaks the ties, such that this is equivalent to a stable sort
+  // but does not need its temporary buffer.
+  std::sort(radiusOrder.begin(), radiusOrder.end());
+  spVec.clear();
+  rVec.clear();
+  for (const auto& [radius, position] : radiusOrder) {
+    spVec.push_back(rangeSPVec[position]);
+    rVec.push_back(radius);
+  }
 }
 
 template <typename external_spacepoint_t, typename platform_t>
@@ -0,0 +1,132 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Seeding/FlatSeedingTypes.hpp"
+#include "Acts/Seeding/InternalSeed.hpp"
+#include "Acts/Seeding/InternalSpacePoint.hpp"
+#include "Acts/Seeding/Seed.hpp"
+#include "Acts/Seeding/SeedFilterConfig.hpp"
+#include "Acts/Seeding/SeedfinderConfig.hpp"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+/// Host implementation of the seed finding on flat space point arrays.
+///
+/// This runs the same dublet search, triplet search and triplet filter as the
+/// CUDA based @c Acts::Cuda::SeedFinder, on the same data layout and with the
+/// same triplet filter configuration. It can be used on machines without a
+/// GPU and to validate the GPU results. The loops over the candidates of one
+/// middle space point are written without branches where possible, such that
+/// they can be vectorised. Groups can be processed in parallel with one
+/// state per thread.
+///
+/// @note Contrary to @c Acts::Seedfinder, the scattering angle is always
+/// estimated from the seed curvature, as on the GPU, and the candidates are
+/// processed in their input order.
+template <typename external_spacepoint_t>
+class SeedfinderFlat {
+ public:
+  using internal_sp_t = InternalSpacePoint<external_spacepoint_t>;
+
+  /// Scratch memory used during the seed creation, reused between groups.
+  /// @note Each thread calling the seed finder needs its own state.
+  struct State {
+    // the space points of the current group
+    std::vector<const internal_sp_t*> bottomSPVec;
+    std::vector<const internal_sp_t*> middleSPVec;
+    std::vector<const internal_sp_t*> topSPVec;
+    std::vector<FlatSeeding::SpacePoint> bottomSPs;
+    std::vector<FlatSeeding::SpacePoint> middleSPs;
+    std::vector<FlatSeeding::SpacePoint> topSPs;
+
+    // dublets of the current middle space point
+    std::vector<uint8_t> compatible;
+    std::vector<unsigned int> bottomDublets;
+    std::vector<unsigned int> topDublets;
+    std::vector<FlatSeeding::LinCircle> bottomLinCircles;
+    std::vector<FlatSeeding::LinCircle> topLinCircles;
+
+    // triplets of the current middle space point, grouped by bottom dublet
+    std::vector<FlatSeeding::Triplet> triplets;
+    std::vector<unsigned int> tripletOffsets;
+    std::vector<std::pair<float, InternalSeed<external_spacepoint_t>>>
+        seedsPerSpM;
+
+    /// Summary of the dublet search in the last group
+    FlatSeeding::DubletCounts dubletCounts;
+  };
+
+  /// Create a host seed finder object
+  ///
+  /// @param commonConfig Configuration shared with @c Acts::Seedfinder
+  /// @param seedFilterConfig Configuration shared with @c Acts::SeedFilter
+  /// @param tripletFilterConfig Configuration for the triplet filtering. The
+  ///        functions are optional on the host; without them the weight is
+  ///        not changed and all triplets are accepted.
+  SeedfinderFlat(SeedfinderConfig<external_spacepoint_t> commonConfig,
+                 const SeedFilterConfig& seedFilterConfig,
+                 const FlatSeeding::TripletFilterConfig& tripletFilterConfig);
+
+  /// Create all seeds from the space points in the three iterators.
+  /// @param state scratch memory, reused between calls
+  /// @param outputVec vector to which the seeds are appended
+  /// @param bottomSPs group of space points to be used as innermost SP in a seed.
+  /// @param middleSPs group of space points to be used as middle SP in a seed.
+  /// @param topSPs group of space points to be used as outermost SP in a seed.
+  /// Ranges must return pointers.
+  template <typename sp_range_t>
+  void createSeedsForGroup(State& state,
+                           std::vector<Seed<external_spacepoint_t>>& outputVec,
+                           sp_range_t bottomSPs, sp_range_t middleSPs,
+                           sp_range_t topSPs) const;
+
+  /// Create all seeds from the space points in the three iterators.
+  /// @param bottomSPs group of space points to be used as innermost SP in a seed.
+  /// @param middleSPs group of space points to be used as middle SP in a seed.
+  /// @param topSPs group of space points to be used as outermost SP in a seed.
+  /// Ranges must return pointers.
+  /// @return vector in which all found seeds for this group are stored.
+  template <typename sp_range_t>
+  std::vector<Seed<external_spacepoint_t>> createSeedsForGroup(
+      sp_range_t bottomSPs, sp_range_t middleSPs, sp_range_t topSPs) const;
+
+ private:
+  /// Fill the indices of the space points forming a dublet with a middle
+  /// space point.
+  void findDublets(const FlatSeeding::SpacePoint& spM,
+                   const std::vector<FlatSeeding::SpacePoint>& otherSPs,
+                   bool bottom, std::vector<uint8_t>& compatible,
+                   std::vector<unsigned int>& dublets) const;
+
+  /// Transform the dublets of a middle space point to the u/v plane.
+  static void transformCoordinates(
+      const FlatSeeding::SpacePoint& spM,
+      const std::vector<FlatSeeding::SpacePoint>& otherSPs,
+      const std::vector<unsigned int>& dublets, bool bottom,
+      std::vector<FlatSeeding::LinCircle>& linCircles);
+
+  /// Find the triplets of a middle space point and filter them.
+  void findTriplets(State& state, unsigned int middleIndex) const;
+
+  /// Configuration for the seed finder
+  SeedfinderConfig<external_spacepoint_t> m_commonConfig;
+  /// Configuration for the seed filter
+  SeedFilterConfig m_seedFilterConfig;
+  /// Configuration for the triplet filter
+  FlatSeeding::TripletFilterConfig m_tripletFilterConfig;
+};
+
+}  // namespace Acts
+
+#include "Acts/Seeding/SeedfinderFlat.ipp"
@@ -0,0 +1,350 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Seeding/SeedFilter.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <boost/container/small_vector.hpp>
+
+namespace Acts {
+
+template <typename external_spacepoint_t>
+SeedfinderFlat<external_spacepoint_t>::SeedfinderFlat(
+    SeedfinderConfig<external_spacepoint_t> commonConfig,
+    const SeedFilterConfig& seedFilterConfig,
+    const FlatSeeding::TripletFilterConfig& tripletFilterConfig)
+    : m_commonConfig(std::move(commonConfig)),
+      m_seedFilterConfig(seedFilterConfig),
+      m_tripletFilterConfig(tripletFilterConfig) {
+  // calculation of scattering using the highland formula
+  // convert pT to p once theta angle is known
+  m_commonConfig.highland =
+      13.6 * std::sqrt(m_commonConfig.radLengthPerSeed) *
+      (1 + 0.038 * std::log(m_commonConfig.radLengthPerSeed));
+  float maxScatteringAngle = m_commonConfig.highland / m_commonConfig.minPt;
+  m_commonConfig.maxScatteringAngle2 = maxScatteringAngle * maxScatteringAngle;
+
+  // helix radius in homogeneous magnetic field. Units are Kilotesla, MeV and
+  // millimeter, the units of the common configuration
+  m_commonConfig.pTPerHelixRadius = 300. * m_commonConfig.bFieldInZ;
+  m_commonConfig.minHelixDiameter2 =
+      std::pow(m_commonConfig.minPt * 2 / m_commonConfig.pTPerHelixRadius, 2);
+  m_commonConfig.pT2perRadius =
+      std::pow(m_commonConfig.highland / m_commonConfig.pTPerHelixRadius, 2);
+}
+
+template <typename external_spacepoint_t>
+template <typename sp_range_t>
+std::vector<Seed<external_spacepoint_t>>
+SeedfinderFlat<external_spacepoint_t>::createSeedsForGroup(
+    sp_range_t bottomSPs, sp_range_t middleSPs, sp_range_t topSPs) const {
+  State state;
+  std::vector<Seed<external_spacepoint_t>> outputVec;
+  createSeedsForGroup(state, outputVec, std::move(bottomSPs),
+                      std::move(middleSPs), std::move(topSPs));
+  return outputVec;
+}
+
+template <typename external_spacepoint_t>
+template <typename sp_range_t>
+void SeedfinderFlat<external_spacepoint_t>::createSeedsForGroup(
+    State& state, std::vector<Seed<external_spacepoint_t>>& outputVec,
+    sp_range_t bottomSPs, sp_range_t middleSPs, sp_range_t topSPs) const {
+  // flatten the space points of the group into contiguous arrays
+  auto fillSPArray = [](sp_range_t& spRange,
+                        std::vector<const internal_sp_t*>& spVec,
+                        std::vector<FlatSeeding::SpacePoint>& array) {
+    spVec.clear();
+    array.clear();
+    for (auto* sp : spRange) {
+      spVec.push_back(sp);
+      array.push_back({sp->x(), sp->y(), sp->z(), sp->radius(),
+                       sp->varianceR(), sp->varianceZ()});
+    }
+  };
+  fillSPArray(middleSPs, state.middleSPVec, state.middleSPs);
+  state.dubletCounts = FlatSeeding::DubletCounts();
+  if (state.middleSPs.empty()) {
+    return;
+  }
+  fillSPArray(bottomSPs, state.bottomSPVec, state.bottomSPs);
+  fillSPArray(topSPs, state.topSPVec, state.topSPs);
+  if (state.bottomSPs.empty() or state.topSPs.empty()) {
+    return;
+  }
+
+  auto& counts = state.dubletCounts;
+  for (unsigned int middleIndex = 0; middleIndex < state.middleSPs.size();
+       ++middleIndex) {
+    const FlatSeeding::SpacePoint& spM = state.middleSPs[middleIndex];
+    findDublets(spM, state.bottomSPs, true, state.compatible,
+                state.bottomDublets);
+    findDublets(spM, state.topSPs, false, state.compatible, state.topDublets);
+
+    const unsigned int nMB = state.bottomDublets.size();
+    const unsigned int nMT = state.topDublets.size();
+    counts.nDublets += nMB + nMT;
+    counts.nTriplets += nMB * nMT;
+    counts.maxMBDublets = std::max(counts.maxMBDublets, nMB);
+    counts.maxMTDublets = std::max(counts.maxMTDublets, nMT);
+    counts.maxTriplets = std::max(counts.maxTriplets, nMB * nMT);
+    if (nMB == 0 or nMT == 0) {
+      continue;
+    }
+
+    transformCoordinates(spM, state.bottomSPs, state.bottomDublets, true,
+                         state.bottomLinCircles);
+    transformCoordinates(spM, state.topSPs, state.topDublets, false,
+                         state.topLinCircles);
+    findTriplets(state, middleIndex);
+    m_commonConfig.seedFilter->filterSeeds_1SpFixed(state.seedsPerSpM,
+                                                    outputVec);
+  }
+}
+
+template <typename external_spacepoint_t>
+void SeedfinderFlat<external_spacepoint_t>::findDublets(
+    const FlatSeeding::SpacePoint& spM,
+    const std::vector<FlatSeeding::SpacePoint>& otherSPs, bool bottom,
+    std::vector<uint8_t>& compatible,
+    std::vector<unsigned int>& dublets) const {
+  const float deltaRMin = m_commonConfig.deltaRMin;
+  const float deltaRMax = m_commonConfig.deltaRMax;
+  const float cotThetaMax = m_commonConfig.cotThetaMax;
+  const float collisionRegionMin = m_commonConfig.collisionRegionMin;
+  const float collisionRegionMax = m_commonConfig.collisionRegionMax;
+  const float sign = bottom ? -1.f : 1.f;
+  const std::size_t nOtherSPs = otherSPs.size();
+
+  // flag the compatible space points in a loop without branches
+  compatible.resize(nOtherSPs);
+  for (std::size_t i = 0; i < nOtherSPs; ++i) {
+    const float deltaR = sign * (otherSPs[i].radius - spM.radius);
+    const float cotTheta = sign * (otherSPs[i].z - spM.z) / deltaR;
+    const float zOrigin = spM.z - spM.radius * cotTheta;
+    compatible[i] = (deltaR >= deltaRMin) & (deltaR <= deltaRMax) &
+                    (std::abs(cotTheta) <= cotThetaMax) &
+                    (zOrigin >= collisionRegionMin) &
+                    (zOrigin <= collisionRegionMax);
+  }
+
+  dublets.clear();
+  for (std::size_t i = 0; i < nOtherSPs; ++i) {
+    if (compatible[i] != 0) {
+      dublets.push_back(i);
+    }
+  }
+}
+
+template <typename external_spacepoint_t>
+void SeedfinderFlat<external_spacepoint_t>::transformCoordinates(
+    const FlatSeeding::SpacePoint& spM,
+    const std::vector<FlatSeeding::SpacePoint>& otherSPs,
+    const std::vector<unsigned int>& dublets, bool bottom,
+    std::vector<FlatSeeding::LinCircle>& linCircles) {
+  // Parameters of the middle spacepoint.
+  const float cosPhiM = spM.x / spM.radius;
+  const float sinPhiM = spM.y / spM.radius;
+  const float bottomFactor = bottom ? -1.f : 1.f;
+
+  linCircles.resize(dublets.size());
+  for (std::size_t i = 0; i < dublets.size(); ++i) {
+    const FlatSeeding::SpacePoint& sp = otherSPs[dublets[i]];
+    // (Relative) Parameters of the spacepoint being transformed.
+    const float deltaX = sp.x - spM.x;
+    const float deltaY = sp.y - spM.y;
+    const float deltaZ = sp.z - spM.z;
+    // projection fractions of spM->sp along and orthogonal to origin->spM
+    const float x = deltaX * cosPhiM + deltaY * sinPhiM;
+    const float y = deltaY * cosPhiM - deltaX * sinPhiM;
+    // 1/(length of M -> SP)
+    const float iDeltaR2 = 1. / (deltaX * deltaX + deltaY * deltaY);
+    const float iDeltaR = std::sqrt(iDeltaR2);
+    // cot_theta = (deltaZ/deltaR)
+    const float cotTheta = deltaZ * iDeltaR * bottomFactor;
+
+    FlatSeeding::LinCircle& l = linCircles[i];
+    l.cotTheta = cotTheta;
+    // location on z-axis of this SP-duplet
+    l.Zo = spM.z - spM.radius * cotTheta;
+    l.iDeltaR = iDeltaR;
+    // transformation of circle equation (x,y) into linear equation (u,v)
+    l.U = x * iDeltaR2;
+    l.V = y * iDeltaR2;
+    // error term for sp-pair without correlation of middle space point
+    l.Er = ((spM.varianceZ + sp.varianceZ) +
+            (cotTheta * cotTheta) * (spM.varianceR + sp.varianceR)) *
+           iDeltaR2;
+  }
+}
+
+template <typename external_spacepoint_t>
+void SeedfinderFlat<external_spacepoint_t>::findTriplets(
+    State& state, unsigned int middleIndex) const {
+  const FlatSeeding::SpacePoint& spM = state.middleSPs[middleIndex];
+  const float sigmaScattering2 =
+      m_commonConfig.sigmaScattering * m_commonConfig.sigmaScattering;
+
+  auto& triplets = state.triplets;
+  auto& tripletOffsets = state.tripletOffsets;
+  triplets.clear();
+  tripletOffsets.assign(1, 0u);
+
+  // find the triplets of each bottom dublet
+  for (unsigned int b = 0; b < state.bottomDublets.size(); ++b) {
+    const FlatSeeding::LinCircle& lb = state.bottomLinCircles[b];
+    // 1+(cot^2(theta)) = 1/sin^2(theta)
+    const float iSinTheta2 = (1. + lb.cotTheta * lb.cotTheta);
+    // max scattering for min momentum at the seed's theta angle
+    const float scatteringInRegion2 =
+        m_commonConfig.maxScatteringAngle2 * iSinTheta2 * sigmaScattering2;
+
+    for (unsigned int t = 0; t < state.topDublets.size(); ++t) {
+      const FlatSeeding::LinCircle& lt = state.topLinCircles[t];
+
+      // add errors of spB-spM and spM-spT pairs and add the correlation term
+      // for errors on spM
+      const float error2 =
+          lt.Er + lb.Er +
+          2 * (lb.cotTheta * lt.cotTheta * spM.varianceR + spM.varianceZ) *
+              lb.iDeltaR * lt.iDeltaR;
+
+      float deltaCotTheta = lb.cotTheta - lt.cotTheta;
+      const float deltaCotTheta2 = deltaCotTheta * deltaCotTheta;
+      float dCotThetaMinusError2 = 0.0f;
+
+      // if the error is larger than the difference in theta, no need to
+      // compare with scattering
+      if (deltaCotTheta2 - error2 > 0) {
+        deltaCotTheta = std::abs(deltaCotTheta);
+        const float error = std::sqrt(error2);
+        dCotThetaMinusError2 =
+            deltaCotTheta2 + error2 - 2 * deltaCotTheta * error;
+        if (dCotThetaMinusError2 > scatteringInRegion2) {
+          continue;
+        }
+      }
+
+      // protects against division by 0
+      const float dU = lt.U - lb.U;
+      if (dU == 0.) {
+        continue;
+      }
+      // A and B are evaluated as a function of the circumference parameters
+      // x_0 and y_0
+      const float A = (lt.V - lb.V) / dU;
+      const float S2 = 1. + A * A;
+      const float B = lb.V - A * lb.U;
+      const float B2 = B * B;
+      // calculated radius must not be smaller than minimum radius
+      if (S2 < B2 * m_commonConfig.minHelixDiameter2) {
+        continue;
+      }
+      // 1/helixradius: (B/sqrt(S2))/2 (we leave everything squared)
+      const float iHelixDiameter2 = B2 / S2;
+      // calculate scattering for p(T) calculated from seed curvature
+      const float pT2scatter =
+          4 * iHelixDiameter2 * m_commonConfig.pT2perRadius;
+      // convert p(T) to p scaling by sin^2(theta) AND scale by 1/sin^4(theta)
+      // from rad to deltaCotTheta
+      const float p2scatter = pT2scatter * iSinTheta2;
+      // if deltaTheta larger than allowed scattering for calculated pT, skip
+      if ((deltaCotTheta2 - error2 > 0) &&
+          (dCotThetaMinusError2 > p2scatter * sigmaScattering2)) {
+        continue;
+      }
+      // impact parameter in the u/v plane
+      const float Im = std::abs((A - B * spM.radius) * spM.radius);
+      if (Im > m_commonConfig.impactMax) {
+        continue;
+      }
+
+      triplets.push_back({state.bottomDublets[b], middleIndex,
+                          state.topDublets[t], Im, B / std::sqrt(S2),
+                          -(Im * m_seedFilterConfig.impactWeightFactor)});
+    }
+    tripletOffsets.push_back(triplets.size());
+  }
+
+  // filter the triplets sharing a bottom dublet and create the seeds
+  auto& seedsPerSpM = state.seedsPerSpM;
+  seedsPerSpM.clear();
+  boost::container::small_vector<float, 8> compatibleSeedR;
+  const internal_sp_t& middleSP = *state.middleSPVec[middleIndex];
+  for (unsigned int b = 0; b < state.bottomDublets.size(); ++b) {
+    const unsigned int begin = tripletOffsets[b];
+    const unsigned int end = tripletOffsets[b + 1];
+    for (unsigned int i = begin; i < end; ++i) {
+      FlatSeeding::Triplet triplet1 = triplets[i];
+      const float lowerLimitCurv =
+          triplet1.invHelixDiameter - m_seedFilterConfig.deltaInvHelixDiameter;
+      const float upperLimitCurv =
+          triplet1.invHelixDiameter + m_seedFilterConfig.deltaInvHelixDiameter;
+      const float currentTop_r = state.topSPs[triplet1.topIndex].radius;
+
+      compatibleSeedR.clear();
+      for (unsigned int j = begin; j < end; ++j) {
+        if (j == i) {
+          continue;
+        }
+        const FlatSeeding::Triplet& triplet2 = triplets[j];
+        // compared top SP should have at least deltaRMin distance
+        const float otherTop_r = state.topSPs[triplet2.topIndex].radius;
+        if (std::abs(currentTop_r - otherTop_r) <
+            m_seedFilterConfig.deltaRMin) {
+          continue;
+        }
+        // curvature difference within limits?
+        if (triplet2.invHelixDiameter < lowerLimitCurv or
+            triplet2.invHelixDiameter > upperLimitCurv) {
+          continue;
+        }
+        bool newCompSeed = true;
+        for (float previousR : compatibleSeedR) {
+          // add new compatible seed only if distance larger than rmin to all
+          // other compatible seeds
+          if (std::abs(previousR - otherTop_r) < m_seedFilterConfig.deltaRMin) {
+            newCompSeed = false;
+            break;
+          }
+        }
+        if (newCompSeed) {
+          compatibleSeedR.push_back(otherTop_r);
+          triplet1.weight += m_seedFilterConfig.compatSeedWeight;
+        }
+        if (compatibleSeedR.size() >= m_seedFilterConfig.compatSeedLimit) {
+          break;
+        }
+      }
+
+      // apply the user defined weight and cut
+      const FlatSeeding::SpacePoint& bottom =
+          state.bottomSPs[triplet1.bottomIndex];
+      const FlatSeeding::SpacePoint& top = state.topSPs[triplet1.topIndex];
+      if (m_tripletFilterConfig.seedWeight != nullptr) {
+        triplet1.weight += m_tripletFilterConfig.seedWeight(bottom, spM, top);
+      }
+      if (m_tripletFilterConfig.singleSeedCut != nullptr and
+          not m_tripletFilterConfig.singleSeedCut(triplet1.weight, bottom, spM,
+                                                  top)) {
+        continue;
+      }
+
+      seedsPerSpM.emplace_back(
+          triplet1.weight,
+          InternalSeed<external_spacepoint_t>(
+              *state.bottomSPVec[triplet1.bottomIndex], middleSP,
+              *state.topSPVec[triplet1.topIndex],
+              state.bottomLinCircles[b].Zo));
+    }
+  }
+}
+
+}  // namespace Acts
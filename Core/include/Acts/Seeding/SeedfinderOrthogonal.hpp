@@ -0,0 +1,114 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Seeding/InternalSpacePoint.hpp"
+#include "Acts/Seeding/Seed.hpp"
+#include "Acts/Seeding/Seedfinder.hpp"
+#include "Acts/Seeding/SeedfinderConfig.hpp"
+#include "Acts/Utilities/KDTree.hpp"
+
+#include <chrono>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+/// Seed finder using orthogonal range searches instead of the phi-z grid.
+///
+/// All space points of an event are indexed in a k-d tree over (phi, r, z).
+/// For each middle space point, the bottom and top candidates are found
+/// with range queries whose bounds follow from the deltaR, cotTheta,
+/// collision region, minimum pT and impact parameter cuts of the
+/// configuration. The doublet and triplet selection and the seed filter are
+/// shared with the grid based Seedfinder.
+template <typename external_spacepoint_t>
+class SeedfinderOrthogonal {
+ public:
+  using internal_sp_t = InternalSpacePoint<external_spacepoint_t>;
+  using tree_t = KDTree<3, const internal_sp_t*, float>;
+  /// Radius and space point of a bottom or top doublet candidate
+  using candidate_t = std::pair<float, const internal_sp_t*>;
+
+  /// Scratch memory used during the seed creation, reused between events.
+  /// @note Each thread calling the seed finder needs its own state.
+  struct State {
+    // space points of the current event in the beam system
+    std::vector<internal_sp_t> spacePoints;
+    // doublets found by the current range query
+    std::vector<candidate_t> candidates;
+    // doublet, triplet and filter scratch memory and phase times
+    typename Seedfinder<external_spacepoint_t>::State finderState;
+    /// Time spent building the tree, if finderState.measureTime is set.
+    std::chrono::duration<double> treeTime{0};
+  };
+
+  /// The only constructor. Requires a config object.
+  /// @param config the configuration for the Seedfinder
+  SeedfinderOrthogonal(Acts::SeedfinderConfig<external_spacepoint_t> config);
+  ~SeedfinderOrthogonal() = default;
+  SeedfinderOrthogonal() = delete;
+  SeedfinderOrthogonal(const SeedfinderOrthogonal<external_spacepoint_t>&) =
+      delete;
+  SeedfinderOrthogonal<external_spacepoint_t>& operator=(
+      const SeedfinderOrthogonal<external_spacepoint_t>&) = delete;
+
+  /// Create all seeds from a set of space points.
+  /// @param state scratch memory, reused between calls
+  /// @param spBegin begin of the space point pointers
+  /// @param spEnd end of the space point pointers
+  /// @param globTool returns the global position and variance in r and z
+  /// of a space point, as for the BinnedSPGroup
+  /// @param outputVec vector to which the seeds are appended
+  template <typename spacepoint_iterator_t>
+  void createSeeds(State& state, spacepoint_iterator_t spBegin,
+                   spacepoint_iterator_t spEnd,
+                   std::function<std::pair<Acts::Vector3, Acts::Vector2>(
+                       const external_spacepoint_t&, float, float, float)>
+                       globTool,
+                   std::vector<Seed<external_spacepoint_t>>& outputVec) const;
+
+  /// Create all seeds from a set of space points.
+  /// @param spBegin begin of the space point pointers
+  /// @param spEnd end of the space point pointers
+  /// @param globTool returns the global position and variance in r and z
+  /// of a space point, as for the BinnedSPGroup
+  /// @return vector in which all found seeds are stored.
+  template <typename spacepoint_iterator_t>
+  std::vector<Seed<external_spacepoint_t>> createSeeds(
+      spacepoint_iterator_t spBegin, spacepoint_iterator_t spEnd,
+      std::function<std::pair<Acts::Vector3, Acts::Vector2>(
+          const external_spacepoint_t&, float, float, float)>
+          globTool) const;
+
+ private:
+  /// Maximum azimuthal distance between two space points of a seed at
+  /// radii rInner < rOuter.
+  float deltaPhiMax(float rInner, float rOuter) const;
+
+  /// Call a function for the space points inside a window around phi,
+  /// taking the periodicity in phi into account.
+  template <typename callable_t>
+  void rangeSearch(const tree_t& tree, float phi, float deltaPhi, float rMin,
+                   float rMax, float zMin, float zMax, callable_t&& func) const;
+
+  /// Find the bottom (or top) candidates of a middle space point and keep
+  /// the ones forming a doublet with it in the finder state.
+  void findDoublets(State& state, const tree_t& tree, const internal_sp_t& spM,
+                    float rMinAll, bool bottom) const;
+
+  Acts::SeedfinderConfig<external_spacepoint_t> m_config;
+  Seedfinder<external_spacepoint_t> m_seedfinder;
+};
+
+}  // namespace Acts
+
+#include "Acts/Seeding/SeedfinderOrthogonal.ipp"
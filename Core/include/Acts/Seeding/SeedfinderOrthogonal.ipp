@@ -0,0 +1,230 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+namespace Acts {
+
+template <typename external_spacepoint_t>
+SeedfinderOrthogonal<external_spacepoint_t>::SeedfinderOrthogonal(
+    Acts::SeedfinderConfig<external_spacepoint_t> config)
+    : m_config(config), m_seedfinder(std::move(config)) {}
+
+template <typename external_spacepoint_t>
+template <typename spacepoint_iterator_t>
+std::vector<Seed<external_spacepoint_t>>
+SeedfinderOrthogonal<external_spacepoint_t>::createSeeds(
+    spacepoint_iterator_t spBegin, spacepoint_iterator_t spEnd,
+    std::function<std::pair<Acts::Vector3, Acts::Vector2>(
+        const external_spacepoint_t&, float, float, float)>
+        globTool) const {
+  State state;
+  std::vector<Seed<external_spacepoint_t>> outputVec;
+  createSeeds(state, spBegin, spEnd, std::move(globTool), outputVec);
+  return outputVec;
+}
+
+template <typename external_spacepoint_t>
+template <typename spacepoint_iterator_t>
+void SeedfinderOrthogonal<external_spacepoint_t>::createSeeds(
+    State& state, spacepoint_iterator_t spBegin, spacepoint_iterator_t spEnd,
+    std::function<std::pair<Acts::Vector3, Acts::Vector2>(
+        const external_spacepoint_t&, float, float, float)>
+        globTool,
+    std::vector<Seed<external_spacepoint_t>>& outputVec) const {
+  static_assert(
+      std::is_same<
+          typename std::iterator_traits<spacepoint_iterator_t>::value_type,
+          const external_spacepoint_t*>::value,
+      "Iterator does not contain type this class was templated with");
+
+  auto& finderState = state.finderState;
+  if (finderState.measureTime) {
+    finderState.lapTime = std::chrono::steady_clock::now();
+  }
+
+  // collect the space points in the region of interest. add magnitude of
+  // beamPos to rMax to avoid excluding measurements
+  float rMax = m_config.rMax + m_config.beamPos.norm();
+  auto& spacePoints = state.spacePoints;
+  spacePoints.clear();
+  for (spacepoint_iterator_t it = spBegin; it != spEnd; it++) {
+    if (*it == nullptr) {
+      continue;
+    }
+    const external_spacepoint_t& sp = **it;
+    const auto& [spPosition, variance] =
+        globTool(sp, m_config.zAlign, m_config.rAlign, m_config.sigmaError);
+    if (spPosition[2] > m_config.zMax || spPosition[2] < m_config.zMin) {
+      continue;
+    }
+    float spPhi = std::atan2(spPosition[1], spPosition[0]);
+    if (spPhi > m_config.phiMax || spPhi < m_config.phiMin) {
+      continue;
+    }
+    internal_sp_t isp(sp, spPosition, m_config.beamPos, variance);
+    if (isp.radius() >= rMax) {
+      continue;
+    }
+    spacePoints.push_back(std::move(isp));
+  }
+  if (spacePoints.empty()) {
+    return;
+  }
+
+  // the storage must not be resized after the tree has been filled
+  std::vector<typename tree_t::pair_t> elements;
+  elements.reserve(spacePoints.size());
+  float rMinAll = std::numeric_limits<float>::max();
+  for (const auto& sp : spacePoints) {
+    elements.push_back({{sp.phi(), sp.radius(), sp.z()}, &sp});
+    rMinAll = std::min(rMinAll, sp.radius());
+  }
+  tree_t tree(std::move(elements));
+  finderState.lap(state.treeTime);
+
+  for (const auto& spM : spacePoints) {
+    findDoublets(state, tree, spM, rMinAll, true);
+    // no bottom SP found -> try next spM
+    if (finderState.compatBottomSP.empty()) {
+      finderState.lap(finderState.doubletTime);
+      continue;
+    }
+    findDoublets(state, tree, spM, rMinAll, false);
+    if (finderState.compatTopSP.empty()) {
+      finderState.lap(finderState.doubletTime);
+      continue;
+    }
+    m_seedfinder.createSeedsForMiddle(finderState, spM, outputVec);
+  }
+}
+
+template <typename external_spacepoint_t>
+float SeedfinderOrthogonal<external_spacepoint_t>::deltaPhiMax(
+    float rInner, float rOuter) const {
+  // without magnetic field or close to the beam line every direction is
+  // allowed
+  if (m_config.bFieldInZ == 0 or rInner <= m_config.impactMax) {
+    return M_PI;
+  }
+  // bending between the two radii of the tightest allowed helix plus the
+  // largest change of the azimuth shift from the impact parameter, which is
+  // asin(d0 / r) to first order
+  float minHelixDiameter =
+      2 * m_config.minPt / (300. * std::abs(m_config.bFieldInZ));
+  float bending = std::asin(std::min(1.f, rOuter / minHelixDiameter)) -
+                  std::asin(std::min(1.f, rInner / minHelixDiameter));
+  float impactShift = std::asin(m_config.impactMax / rInner) -
+                      std::asin(m_config.impactMax / rOuter);
+  return std::abs(bending) + impactShift;
+}
+
+template <typename external_spacepoint_t>
+template <typename callable_t>
+void SeedfinderOrthogonal<external_spacepoint_t>::rangeSearch(
+    const tree_t& tree, float phi, float deltaPhi, float rMin, float rMax,
+    float zMin, float zMax, callable_t&& func) const {
+  constexpr float inf = std::numeric_limits<float>::infinity();
+  constexpr float twoPi = 2 * M_PI;
+  if (deltaPhi >= M_PI) {
+    tree.rangeSearchMap({{{-inf, inf}, {rMin, rMax}, {zMin, zMax}}}, func);
+    return;
+  }
+  float phiLow = phi - deltaPhi;
+  float phiHigh = phi + deltaPhi;
+  tree.rangeSearchMap({{{phiLow, phiHigh}, {rMin, rMax}, {zMin, zMax}}},
+                      func);
+  // the window wraps around at most on one side
+  if (phiLow < -M_PI) {
+    tree.rangeSearchMap({{{phiLow + twoPi, inf}, {rMin, rMax}, {zMin, zMax}}},
+                        func);
+  } else if (phiHigh > M_PI) {
+    tree.rangeSearchMap({{{-inf, phiHigh - twoPi}, {rMin, rMax}, {zMin, zMax}}},
+                        func);
+  }
+}
+
+template <typename external_spacepoint_t>
+void SeedfinderOrthogonal<external_spacepoint_t>::findDoublets(
+    State& state, const tree_t& tree, const internal_sp_t& spM, float rMinAll,
+    bool bottom) const {
+  float rM = spM.radius();
+  float zM = spM.z();
+
+  // radial window of the other space point
+  float rLow = bottom ? rM - m_config.deltaRMax : rM + m_config.deltaRMin;
+  float rHigh = bottom ? rM - m_config.deltaRMin : rM + m_config.deltaRMax;
+
+  // the cotTheta cut limits the z distance at the largest deltaR ...
+  float deltaZMax = m_config.cotThetaMax * m_config.deltaRMax;
+  float zLow = zM - deltaZMax;
+  float zHigh = zM + deltaZMax;
+  // ... and the line through the middle space point and the collision
+  // region, z(r) = zOrigin + (zM - zOrigin) * r / rM, is bilinear in r and
+  // zOrigin such that its extremes are at the corners of the window
+  if (rM > 0) {
+    float zCornerMin = std::numeric_limits<float>::max();
+    float zCornerMax = std::numeric_limits<float>::lowest();
+    for (float r : {std::max(rLow, 0.f), rHigh}) {
+      for (float zOrigin :
+           {m_config.collisionRegionMin, m_config.collisionRegionMax}) {
+        float z = zOrigin + (zM - zOrigin) * r / rM;
+        zCornerMin = std::min(zCornerMin, z);
+        zCornerMax = std::max(zCornerMax, z);
+      }
+    }
+    zLow = std::max(zLow, zCornerMin);
+    zHigh = std::min(zHigh, zCornerMax);
+  }
+
+  // widen the window slightly against rounding differences with respect to
+  // the exact doublet cuts applied to the candidates
+  auto margin = [](float value) { return 1e-4f * (1.f + std::abs(value)); };
+  rLow -= margin(rLow);
+  rHigh += margin(rHigh);
+  zLow -= margin(zLow);
+  zHigh += margin(zHigh);
+
+  float deltaPhi = bottom ? deltaPhiMax(std::max(rLow, rMinAll), rM)
+                          : deltaPhiMax(rM, rHigh);
+
+  auto& candidates = state.candidates;
+  candidates.clear();
+  if (rLow <= rHigh and zLow <= zHigh) {
+    // apply the doublet cuts directly, as done by the grid based search
+    rangeSearch(tree, spM.phi(), deltaPhi, rLow, rHigh, zLow, zHigh,
+                [&](const typename tree_t::coordinate_t& point,
+                    const internal_sp_t* sp) {
+                  float deltaR = bottom ? rM - point[1] : point[1] - rM;
+                  if (deltaR < m_config.deltaRMin or
+                      deltaR > m_config.deltaRMax) {
+                    return;
+                  }
+                  float deltaZ = bottom ? zM - point[2] : point[2] - zM;
+                  if (m_seedfinder.isCompatibleDoublet(rM, zM, deltaR,
+                                                       deltaZ)) {
+                    candidates.emplace_back(point[1], sp);
+                  }
+                });
+  }
+
+  // the triplet search expects the doublets sorted in r
+  std::sort(candidates.begin(), candidates.end());
+  auto& compatSP = bottom ? state.finderState.compatBottomSP
+                          : state.finderState.compatTopSP;
+  compatSP.clear();
+  for (const auto& candidate : candidates) {
+    compatSP.push_back(candidate.second);
+  }
+}
+
+}  // namespace Acts
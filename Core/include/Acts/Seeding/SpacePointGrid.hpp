@@ -36,10 +36,13 @@ struct SpacePointGridConfig {
   // maximum forward direction expressed as cot(theta)
   float cotThetaMax;
 };
+/// Grid of space points binned in phi and z.
+///
+/// The bins do not own the space points; they point into the contiguous
+/// storage of the @c BinnedSPGroup and are sorted in r (ascending).
 template <typename external_spacepoint_t>
 using SpacePointGrid =
-    detail::Grid<std::vector<std::unique_ptr<
-                     const InternalSpacePoint<external_spacepoint_t>>>,
+    detail::Grid<std::vector<const InternalSpacePoint<external_spacepoint_t>*>,
                  detail::Axis<detail::AxisType::Equidistant,
                               detail::AxisBoundaryType::Closed>,
                  detail::Axis<detail::AxisType::Equidistant,
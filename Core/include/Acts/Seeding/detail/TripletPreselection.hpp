@@ -0,0 +1,61 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace Acts {
+namespace detail {
+
+/// Pre-select the top doublets that can form a triplet with a bottom doublet.
+///
+/// @param Ub U parameter of the bottom doublet in the linear circle frame
+/// @param Vb V parameter of the bottom doublet in the linear circle frame
+/// @param topU U parameters of all top doublets
+/// @param topV V parameters of all top doublets
+/// @param numTop Number of top doublets
+/// @param rM Radius of the middle space point
+/// @param minHelixDiameter2 Squared minimum helix diameter
+/// @param impactMax Maximum impact parameter
+/// @param[out] selected Non-zero for the top doublets that pass
+///
+/// Evaluates the helix diameter and impact parameter cuts of the triplet
+/// selection. The loop runs over contiguous arrays without branches or
+/// square roots and is thus vectorized by the compiler. All operations are
+/// identical to the scalar selection, i.e. the selected candidates do not
+/// depend on the vector width. The scattering cuts require square roots and
+/// are only evaluated for the selected candidates.
+inline void preselectTriplets(float Ub, float Vb, const float* topU,
+                              const float* topV, size_t numTop, float rM,
+                              float minHelixDiameter2, float impactMax,
+                              uint8_t* selected) {
+  for (size_t t = 0; t < numTop; ++t) {
+    // protects against division by 0
+    float dU = topU[t] - Ub;
+    // A and B are evaluated as a function of the circumference parameters
+    // x_0 and y_0
+    float A = (topV[t] - Vb) / dU;
+    // 1.f instead of 1. gives the identical float result, but avoids the
+    // conversion to double
+    float S2 = 1.f + A * A;
+    float B = Vb - A * Ub;
+    float B2 = B * B;
+    // A and B allow calculation of impact params in U/V plane with linear
+    // function
+    float Im = std::abs((A - B * rM) * rM);
+    // calculated radius must not be smaller than minimum radius
+    selected[t] = (dU != 0.f) & !(S2 < B2 * minHelixDiameter2) &
+                  (Im <= impactMax);
+  }
+}
+
+}  // namespace detail
+}  // namespace Acts
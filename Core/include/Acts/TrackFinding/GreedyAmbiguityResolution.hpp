@@ -0,0 +1,125 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/EventData/MultiTrajectory.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace Acts {
+
+/// Greedy shared-hit ambiguity resolution for track candidates.
+///
+/// Track candidates are ranked by their number of measurements and their
+/// summed chi2; ties are broken by the input (seed) order. Candidates are
+/// then accepted in rank order as long as they do not share more than the
+/// allowed number of measurements with the already accepted candidates.
+///
+/// Measurement usage is recorded in flat per-measurement counters that are
+/// indexed by a user-provided measurement index, e.g. the index of an index
+/// source link. Apart from the initial ranking, the resolution runs in time
+/// linear in the total number of measurements on all candidates.
+class GreedyAmbiguityResolution {
+ public:
+  struct Config {
+    /// Maximum number of measurements shared with accepted candidates.
+    size_t maximumSharedHits = 1;
+    /// Minimum number of measurements required for a candidate.
+    size_t nMeasurementsMin = 7;
+  };
+
+  /// A track candidate identified by its tip in a multi trajectory.
+  ///
+  /// @tparam source_link_t Source link type of the multi trajectory
+  template <typename source_link_t>
+  struct Candidate {
+    const MultiTrajectory<source_link_t>* multiTrajectory = nullptr;
+    size_t tip = SIZE_MAX;
+  };
+
+  /// Construct with the given configuration.
+  ///
+  /// @param config Resolution cuts
+  GreedyAmbiguityResolution(const Config& config) : m_cfg(config) {}
+
+  /// Select the candidates that survive the ambiguity resolution.
+  ///
+  /// @tparam source_link_t Source link type of the multi trajectories
+  /// @tparam measurement_index_t Callable that maps a source link to its index
+  ///
+  /// @param candidates Input track candidates
+  /// @param numMeasurements Total number of measurements, i.e. the exclusive
+  ///   upper bound of the measurement indices
+  /// @param measurementIndex Returns the measurement index of a source link
+  /// @return Indices of the accepted candidates in ascending order
+  template <typename source_link_t, typename measurement_index_t>
+  std::vector<size_t> solve(
+      const std::vector<Candidate<source_link_t>>& candidates,
+      size_t numMeasurements, measurement_index_t&& measurementIndex) const {
+    // Flatten the measurement indices of all candidates. The measurements of
+    // candidate i are stored in [offsets[i], offsets[i + 1]).
+    std::vector<size_t> offsets;
+    std::vector<size_t> measurements;
+    std::vector<double> chi2Sums(candidates.size(), 0.);
+    offsets.reserve(candidates.size() + 1u);
+    offsets.push_back(0u);
+    for (size_t i = 0; i < candidates.size(); ++i) {
+      const auto& candidate = candidates[i];
+      candidate.multiTrajectory->visitBackwards(
+          candidate.tip, [&](const auto& state) {
+            if (state.typeFlags().test(TrackStateFlag::MeasurementFlag)) {
+              measurements.push_back(measurementIndex(state.uncalibrated()));
+              chi2Sums[i] += state.chi2();
+            }
+          });
+      offsets.push_back(measurements.size());
+    }
+    auto nMeasurements = [&](size_t i) {
+      return offsets[i + 1u] - offsets[i];
+    };
+
+    // Rank the candidates; more measurements first, then lower chi2
+    std::vector<size_t> order(candidates.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+      if (nMeasurements(lhs) != nMeasurements(rhs)) {
+        return nMeasurements(lhs) > nMeasurements(rhs);
+      }
+      return chi2Sums[lhs] < chi2Sums[rhs];
+    });
+
+    // Accept candidates greedily and record the used measurements
+    std::vector<uint32_t> usage(numMeasurements, 0u);
+    std::vector<size_t> accepted;
+    for (size_t i : order) {
+      if (nMeasurements(i) < m_cfg.nMeasurementsMin) {
+        continue;
+      }
+      auto begin = measurements.begin() + offsets[i];
+      auto end = measurements.begin() + offsets[i + 1u];
+      size_t nShared = std::count_if(
+          begin, end, [&](size_t imeas) { return 0u < usage[imeas]; });
+      if (m_cfg.maximumSharedHits < nShared) {
+        continue;
+      }
+      std::for_each(begin, end, [&](size_t imeas) { ++usage[imeas]; });
+      accepted.push_back(i);
+    }
+    std::sort(accepted.begin(), accepted.end());
+    return accepted;
+  }
+
+ private:
+  Config m_cfg;
+};
+
+}  // namespace Acts
@@ -12,11 +12,13 @@
 #include "Acts/EventData/TrackParameters.hpp"
 #include "Acts/Geometry/GeometryHierarchyMap.hpp"
 #include "Acts/TrackFinding/CombinatorialKalmanFilterError.hpp"
+#include "Acts/TrackFinding/detail/MeasurementChi2Batch.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
 #include "Acts/Utilities/TypeTraits.hpp"
 
 #include <limits>
+#include <type_traits>
 
 namespace Acts {
 
@@ -110,41 +112,80 @@ class MeasurementSelector {
     measChi2.resize(measurements.size());
     double minChi2 = std::numeric_limits<double>::max();
     size_t minIndex = 0;
-    size_t index = 0;
     size_t nInitialCandidates = 0;
-    // Loop over all measurements to select the compatible measurements
+    // Record the chi2 of a single measurement candidate
+    auto record = [&](size_t index, double chi2) {
+      ACTS_VERBOSE("Chi2: " << chi2);
+      // Push the measurement index and chi2 if satisfying the criteria
+      if (chi2 < chi2CutOff) {
+        measChi2[nInitialCandidates] = {index, chi2};
+        nInitialCandidates++;
+      }
+      // Search for the measurement with the min chi2
+      if (chi2 < minChi2) {
+        minChi2 = chi2;
+        minIndex = index;
+      }
+    };
+
+    // Take the parameter covariance
+    const auto& predictedCovariance = *predictedParams.covariance();
+    // The common 1d (strip) and 2d (pixel) measurements are collected into
+    // structure-of-arrays batches and their chi2 is evaluated all at once.
+    // The projection onto the measured subspace is a plain lookup of the
+    // measured indices; there is no need for the full projection matrix.
+    // The batches are kept per thread such that their storage is reused for
+    // all surfaces instead of being allocated on every call.
+    thread_local detail::MeasurementChi2Batch<1u> batch1;
+    thread_local detail::MeasurementChi2Batch<2u> batch2;
+    batch1.reset(measurements.size());
+    batch2.reset(measurements.size());
+    size_t index = 0;
+    // Loop over all measurements to compute the residuals and covariances
     for (const auto& measurement : measurements) {
       std::visit(
           [&](const auto& meas) {
-            // Take the projector (measurement mapping function)
-            const auto& H = meas.projector();
-            // Take the parameter covariance
-            const auto& predictedCovariance = *predictedParams.covariance();
+            constexpr size_t kSize = std::decay_t<decltype(meas)>::size();
             // Get the residuals
             const auto& res = meas.residuals(predictedParams.parameters());
-            // Get the chi2
-            double chi2 =
-                (res.transpose() *
-                 ((meas.covariance() + H * predictedCovariance * H.transpose()))
-                     .inverse() *
-                 res)
-                    .eval()(0, 0);
-
-            ACTS_VERBOSE("Chi2: " << chi2);
-            // Push the measurement index and chi2 if satisfying the criteria
-            if (chi2 < chi2CutOff) {
-              measChi2.at(nInitialCandidates) = {index, chi2};
-              nInitialCandidates++;
-            }
-            // Search for the measurement with the min chi2
-            if (chi2 < minChi2) {
-              minChi2 = chi2;
-              minIndex = index;
+            if constexpr ((kSize == 1u) or (kSize == 2u)) {
+              const auto& idx = meas.indices();
+              ActsSymMatrix<kSize> cov = meas.covariance();
+              for (size_t i = 0; i < kSize; ++i) {
+                for (size_t j = 0; j < kSize; ++j) {
+                  cov(i, j) += predictedCovariance(idx[i], idx[j]);
+                }
+              }
+              if constexpr (kSize == 1u) {
+                batch1.push_back(index, res, cov);
+              } else {
+                batch2.push_back(index, res, cov);
+              }
+            } else {
+              // Take the projector (measurement mapping function)
+              const auto& H = meas.projector();
+              // Get the chi2
+              double chi2 = (res.transpose() *
+                             ((meas.covariance() +
+                               H * predictedCovariance * H.transpose()))
+                                 .inverse() *
+                             res)
+                                .eval()(0, 0);
+              record(index, chi2);
             }
           },
           measurement);
       index++;
     }
+    // Evaluate the batched chi2 and collect the results
+    batch1.computeChi2();
+    for (size_t i = 0; i < batch1.size(); ++i) {
+      record(batch1.index(i), batch1.chi2(i));
+    }
+    batch2.computeChi2();
+    for (size_t i = 0; i < batch2.size(); ++i) {
+      record(batch2.index(i), batch2.chi2(i));
+    }
 
     // Get the number of measurement candidates with provided constraint
     // considered
@@ -163,21 +204,14 @@ class MeasurementSelector {
 
     ACTS_VERBOSE("Number of measurement candidates: " << nFinalCandidates);
     measCandidateIndices.resize(nFinalCandidates);
-    // Sort the initial measurement candidates based on chi2 in ascending order
-    std::sort(measChi2.begin(), measChi2.begin() + nInitialCandidates,
-              [](const std::pair<size_t, double>& lchi2,
-                 const std::pair<size_t, double>& rchi2) {
-                return lchi2.second < rchi2.second;
-              });
-    // Get only allowed number of measurement candidates, i.e. nFinalCandidates,
-    // from the front and reset the values in the container
-    size_t nRecorded = 0;
-    for (const auto& [id, chi2] : measChi2) {
-      if (nRecorded >= nFinalCandidates) {
-        break;
-      }
-      measCandidateIndices.at(nRecorded) = id;
-      nRecorded++;
+    // Only the allowed number of measurement candidates, i.e. nFinalCandidates,
+    // with the smallest chi2 are needed. Move them to the front in ascending
+    // chi2 order without sorting all initial candidates.
+    detail::selectSmallestChi2(measChi2.begin(),
+                               measChi2.begin() + nInitialCandidates,
+                               nFinalCandidates);
+    for (size_t i = 0; i < nFinalCandidates; ++i) {
+      measCandidateIndices[i] = measChi2[i].first;
     }
     isOutlier = false;
     return Result<void>::success();
@@ -0,0 +1,142 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/Algebra.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+namespace detail {
+
+/// Structure-of-arrays batch of fixed-size measurement candidates.
+///
+/// @tparam kSize Measurement dimension; only 1d (strip) and 2d (pixel)
+///   measurements are supported.
+///
+/// Each candidate is described by its residual and the (symmetric) residual
+/// covariance, i.e. the sum of the measurement covariance and the projected
+/// predicted covariance. Every component is stored in its own contiguous
+/// column so that the chi2 evaluation for all candidates on a surface runs as
+/// a single branch-free loop that the compiler can vectorize. The inverse of
+/// the residual covariance is computed in closed form.
+template <size_t kSize>
+class MeasurementChi2Batch {
+  static_assert((kSize == 1u) or (kSize == 2u),
+                "Only 1d and 2d measurements can be batched");
+
+  // unique entries of the symmetric residual covariance
+  static constexpr size_t kNumCovariances = (kSize * (kSize + 1u)) / 2u;
+  // residuals, covariance entries, and the computed chi2
+  static constexpr size_t kNumColumns = kSize + kNumCovariances + 1u;
+  static constexpr size_t kChi2Column = kNumColumns - 1u;
+
+ public:
+  /// Remove all candidates and prepare storage for the given number.
+  ///
+  /// @param capacity Maximum number of candidates that will be added
+  ///
+  /// Allocated memory is kept if it is large enough already, i.e. a batch
+  /// can be reused across surfaces without further allocations.
+  void reset(size_t capacity) {
+    m_size = 0u;
+    m_capacity = capacity;
+    m_columns.resize(kNumColumns * capacity);
+    m_indices.resize(capacity);
+  }
+
+  /// Add a measurement candidate.
+  ///
+  /// @param index Index of the candidate in the input measurement container
+  /// @param residual Residual in the measured subspace
+  /// @param covariance Residual covariance in the measured subspace
+  template <typename residual_t, typename covariance_t>
+  void push_back(size_t index, const Eigen::MatrixBase<residual_t>& residual,
+                 const Eigen::MatrixBase<covariance_t>& covariance) {
+    assert((m_size < m_capacity) and "Measurement batch capacity exceeded");
+    m_indices[m_size] = index;
+    size_t icol = 0u;
+    for (size_t i = 0u; i < kSize; ++i) {
+      column(icol++)[m_size] = residual(i);
+    }
+    for (size_t i = 0u; i < kSize; ++i) {
+      for (size_t j = i; j < kSize; ++j) {
+        column(icol++)[m_size] = covariance(i, j);
+      }
+    }
+    ++m_size;
+  }
+
+  /// Evaluate the chi2 for all candidates at once.
+  void computeChi2() {
+    double* chi2 = column(kChi2Column);
+    if constexpr (kSize == 1u) {
+      const double* r = column(0u);
+      const double* c = column(1u);
+      for (size_t i = 0u; i < m_size; ++i) {
+        chi2[i] = (r[i] * r[i]) / c[i];
+      }
+    } else {
+      const double* r0 = column(0u);
+      const double* r1 = column(1u);
+      const double* c00 = column(2u);
+      const double* c01 = column(3u);
+      const double* c11 = column(4u);
+      for (size_t i = 0u; i < m_size; ++i) {
+        const double det = c00[i] * c11[i] - c01[i] * c01[i];
+        chi2[i] = (r0[i] * r0[i] * c11[i] - 2 * r0[i] * r1[i] * c01[i] +
+                   r1[i] * r1[i] * c00[i]) /
+                  det;
+      }
+    }
+  }
+
+  /// Number of candidates in the batch.
+  size_t size() const { return m_size; }
+  /// Index of the i-th candidate in the input measurement container.
+  size_t index(size_t i) const { return m_indices[i]; }
+  /// Chi2 of the i-th candidate; only valid after `computeChi2()`.
+  double chi2(size_t i) const { return column(kChi2Column)[i]; }
+
+ private:
+  double* column(size_t icol) { return m_columns.data() + icol * m_capacity; }
+  const double* column(size_t icol) const {
+    return m_columns.data() + icol * m_capacity;
+  }
+
+  size_t m_size = 0u;
+  size_t m_capacity = 0u;
+  std::vector<double> m_columns;
+  std::vector<size_t> m_indices;
+};
+
+/// Move the `k` candidates with the smallest chi2 to the front.
+///
+/// @param begin Iterator to the first (index, chi2) candidate
+/// @param end Iterator past the last (index, chi2) candidate
+/// @param k Number of candidates to select
+///
+/// The selected candidates are sorted by ascending chi2. The remaining
+/// candidates are left in unspecified order, i.e. the full range is not sorted.
+template <typename iterator_t>
+void selectSmallestChi2(iterator_t begin, iterator_t end, size_t k) {
+  auto byChi2 = [](const auto& lhs, const auto& rhs) {
+    return lhs.second < rhs.second;
+  };
+  auto kth = begin + std::min<size_t>(k, std::distance(begin, end));
+  std::partial_sort(begin, kth, end, byChi2);
+}
+
+}  // namespace detail
+}  // namespace Acts
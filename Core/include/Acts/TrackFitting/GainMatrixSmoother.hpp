@@ -12,6 +12,7 @@
 #include "Acts/EventData/detail/covariance_helper.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/TrackFitting/KalmanFitterError.hpp"
+#include "Acts/TrackFitting/detail/GainMatrixKernels.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
 
@@ -76,46 +77,36 @@ class GainMatrixSmoother {
                    << prev_ts.predictedCovariance() << "\n, inverse: \n"
                    << prev_ts.predictedCovariance().inverse());
 
-      // Gain smoothing matrix
+      // Run the smoothing on contiguous copies of the strided trajectory
+      // storage.
       // NB: The jacobian stored in a state is the jacobian from previous
       // state to this state in forward propagation
-      BoundMatrix G = ts.filteredCovariance() * prev_ts.jacobian().transpose() *
-                      prev_ts.predictedCovariance().inverse();
-
-      if (G.hasNaN()) {
+      BoundVector smoothed;
+      BoundSymMatrix smoothedCov;
+      if (not detail::gainMatrixSmooth(
+              ts.filtered(), ts.filteredCovariance(), prev_ts.jacobian(),
+              prev_ts.predicted(), prev_ts.predictedCovariance(),
+              prev_ts.smoothed(), prev_ts.smoothedCovariance(), smoothed,
+              smoothedCov)) {
         error = KalmanFitterError::SmoothFailed;  // set to error
         return false;                             // abort execution
       }
 
-      ACTS_VERBOSE("Gain smoothing matrix G:\n" << G);
-
-      ACTS_VERBOSE("Calculate smoothed parameters:");
       ACTS_VERBOSE("Filtered parameters: " << ts.filtered().transpose());
       ACTS_VERBOSE(
           "Prev. smoothed parameters: " << prev_ts.smoothed().transpose());
       ACTS_VERBOSE(
           "Prev. predicted parameters: " << prev_ts.predicted().transpose());
-
-      // Calculate the smoothed parameters
-      ts.smoothed() =
-          ts.filtered() + G * (prev_ts.smoothed() - prev_ts.predicted());
-
-      ACTS_VERBOSE("Smoothed parameters are: " << ts.smoothed().transpose());
-      ACTS_VERBOSE("Calculate smoothed covariance:");
+      ACTS_VERBOSE("Smoothed parameters are: " << smoothed.transpose());
       ACTS_VERBOSE("Prev. smoothed covariance:\n"
                    << prev_ts.smoothedCovariance());
 
-      // And the smoothed covariance
-      ts.smoothedCovariance() =
-          ts.filteredCovariance() -
-          G * (prev_ts.predictedCovariance() - prev_ts.smoothedCovariance()) *
-              G.transpose();
+      ts.smoothed() = smoothed;
 
       // Check if the covariance matrix is semi-positive definite.
       // If not, make one (could do more) attempt to replace it with the
       // nearest semi-positive def matrix,
       // but it could still be non semi-positive
-      BoundSymMatrix smoothedCov = ts.smoothedCovariance();
       if (not detail::covariance_helper<BoundSymMatrix>::validate(
               smoothedCov)) {
         ACTS_DEBUG(
@@ -13,9 +13,14 @@
 #include "Acts/EventData/MultiTrajectory.hpp"
 #include "Acts/Geometry/GeometryContext.hpp"
 #include "Acts/TrackFitting/KalmanFitterError.hpp"
+#include "Acts/TrackFitting/detail/GainMatrixKernels.hpp"
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
 namespace Acts {
 
 /// Kalman update step using the gain matrix formalism.
@@ -48,18 +53,13 @@ class GainMatrixUpdater {
     // filtering should not have happened yet, but is allocated, therefore set
     assert(trackState.hasFiltered());
 
-    // read-only handles. Types are eigen maps to backing storage
-    const auto predicted = trackState.predicted();
-    const auto predictedCovariance = trackState.predictedCovariance();
+    // copy the predicted state out of the strided trajectory storage
+    const BoundVector predicted = trackState.predicted();
+    const BoundSymMatrix predictedCovariance = trackState.predictedCovariance();
 
     ACTS_VERBOSE("Predicted parameters: " << predicted.transpose());
     ACTS_VERBOSE("Predicted covariance:\n" << predictedCovariance);
 
-    // read-write handles. Types are eigen maps into backing storage.
-    // This writes directly into the trajectory storage
-    auto filtered = trackState.filtered();
-    auto filteredCovariance = trackState.filteredCovariance();
-
     // default-constructed error represents success, i.e. an invalid error code
     std::error_code error;
     visit_measurement(
@@ -68,67 +68,124 @@ class GainMatrixUpdater {
         [&](const auto calibrated, const auto calibratedCovariance) {
           constexpr size_t kMeasurementSize =
               decltype(calibrated)::RowsAtCompileTime;
-          using ParametersVector = ActsVector<kMeasurementSize>;
-          using CovarianceMatrix = ActsSymMatrix<kMeasurementSize>;
-
-          ACTS_VERBOSE("Measurement dimension: " << kMeasurementSize);
-          ACTS_VERBOSE("Calibrated measurement: " << calibrated.transpose());
-          ACTS_VERBOSE("Calibrated measurement covariance:\n"
-                       << calibratedCovariance);
-
-          const auto H =
-              trackState.projector()
-                  .template topLeftCorner<kMeasurementSize, eBoundSize>()
-                  .eval();
-
-          ACTS_VERBOSE("Measurement projector H:\n" << H);
-
-          const auto K =
-              (predictedCovariance * H.transpose() *
-               (H * predictedCovariance * H.transpose() + calibratedCovariance)
-                   .inverse())
-                  .eval();
-
-          ACTS_VERBOSE("Gain Matrix K:\n" << K);
-
-          if (K.hasNaN()) {
+          if (not update<kMeasurementSize>(
+                  predicted, predictedCovariance, calibrated,
+                  calibratedCovariance, trackState, logger)) {
             error =
                 (direction == forward)
                     ? KalmanFitterError::ForwardUpdateFailed
                     : KalmanFitterError::BackwardUpdateFailed;  // set to error
             return false;  // abort execution
           }
-
-          filtered = predicted + K * (calibrated - H * predicted);
-          filteredCovariance =
-              (BoundSymMatrix::Identity() - K * H) * predictedCovariance;
-          ACTS_VERBOSE("Filtered parameters: " << filtered.transpose());
-          ACTS_VERBOSE("Filtered covariance:\n" << filteredCovariance);
-
-          // calculate filtered residual
-          //
-          // FIXME: Without separate residual construction and assignment, we
-          //        currently take a +0.7GB build memory consumption hit in the
-          //        EventDataView unit tests. Revisit this once Measurement
-          //        overhead problems (Acts issue #350) are sorted out.
-          //
-          ParametersVector residual;
-          residual = calibrated - H * filtered;
-          ACTS_VERBOSE("Residual: " << residual.transpose());
-
-          trackState.chi2() =
-              (residual.transpose() *
-               ((CovarianceMatrix::Identity() - H * K) * calibratedCovariance)
-                   .inverse() *
-               residual)
-                  .value();
-
-          ACTS_VERBOSE("Chi2: " << trackState.chi2());
           return true;  // continue execution
         });
 
     return error ? Result<void>::failure(error) : Result<void>::success();
   }
+
+  /// Run the Kalman update step for multiple trajectory states at once.
+  ///
+  /// @tparam source_link_t The type of source link
+  /// @tparam kMeasurementSizeMax
+  /// @param[in] gctx The current geometry context object, e.g. alignment
+  /// @param[in,out] trackStates The track states, e.g. the states on the
+  ///   current surface of many tracks that are fitted in lockstep
+  /// @param[in] direction The navigation direction
+  /// @param[in] logger Where to write logging information to
+  /// @return The update result for each track state
+  ///
+  /// The states are processed grouped by measurement dimension. The common
+  /// 1d and 2d measurements run through tight loops of the fixed-size kernel
+  /// without a per-state dimension dispatch; all other dimensions are
+  /// updated one by one.
+  template <typename source_link_t, size_t kMeasurementSizeMax>
+  std::vector<Result<void>> operator()(
+      const GeometryContext& gctx,
+      std::vector<detail_lt::TrackStateProxy<source_link_t,
+                                             kMeasurementSizeMax, false>>&
+          trackStates,
+      const NavigationDirection& direction = forward,
+      LoggerWrapper logger = getDummyLogger()) const {
+    std::vector<Result<void>> results(trackStates.size(),
+                                      Result<void>::success());
+    std::error_code error = (direction == forward)
+                                ? KalmanFitterError::ForwardUpdateFailed
+                                : KalmanFitterError::BackwardUpdateFailed;
+
+    auto updateFixed = [&](auto size) {
+      constexpr size_t kMeasurementSize = decltype(size)::value;
+      for (size_t i = 0; i < trackStates.size(); ++i) {
+        auto& trackState = trackStates[i];
+        if (trackState.calibratedSize() != kMeasurementSize) {
+          continue;
+        }
+        const BoundVector predicted = trackState.predicted();
+        const BoundSymMatrix predictedCovariance =
+            trackState.predictedCovariance();
+        const ActsVector<kMeasurementSize> calibrated =
+            trackState.calibrated().template head<kMeasurementSize>();
+        const ActsSymMatrix<kMeasurementSize> calibratedCovariance =
+            trackState.calibratedCovariance()
+                .template topLeftCorner<kMeasurementSize, kMeasurementSize>();
+        if (not update<kMeasurementSize>(predicted, predictedCovariance,
+                                         calibrated, calibratedCovariance,
+                                         trackState, logger)) {
+          results[i] = Result<void>::failure(error);
+        }
+      }
+    };
+    updateFixed(std::integral_constant<size_t, 1u>());
+    updateFixed(std::integral_constant<size_t, 2u>());
+
+    for (size_t i = 0; i < trackStates.size(); ++i) {
+      auto size = trackStates[i].calibratedSize();
+      if ((size != 1u) and (size != 2u)) {
+        results[i] = (*this)(gctx, trackStates[i], direction, logger);
+      }
+    }
+    return results;
+  }
+
+ private:
+  /// Fixed-size update of a single state from already extracted inputs.
+  template <size_t kMeasurementSize, typename calibrated_t,
+            typename calibrated_covariance_t, typename track_state_t>
+  bool update(const BoundVector& predicted,
+              const BoundSymMatrix& predictedCovariance,
+              const Eigen::MatrixBase<calibrated_t>& calibrated,
+              const Eigen::MatrixBase<calibrated_covariance_t>&
+                  calibratedCovariance,
+              track_state_t& trackState, LoggerWrapper logger) const {
+    ACTS_VERBOSE("Measurement dimension: " << kMeasurementSize);
+    ACTS_VERBOSE("Calibrated measurement: " << calibrated.transpose());
+    ACTS_VERBOSE("Calibrated measurement covariance:\n"
+                 << calibratedCovariance);
+
+    const ActsMatrix<kMeasurementSize, eBoundSize> H =
+        trackState.projector()
+            .template topLeftCorner<kMeasurementSize, eBoundSize>();
+
+    ACTS_VERBOSE("Measurement projector H:\n" << H);
+
+    BoundVector filtered;
+    BoundSymMatrix filteredCovariance;
+    double chi2 = 0;
+    if (not detail::gainMatrixUpdate<kMeasurementSize>(
+            predicted, predictedCovariance, calibrated, calibratedCovariance,
+            H, filtered, filteredCovariance, chi2)) {
+      ACTS_VERBOSE("Gain matrix could not be computed");
+      return false;
+    }
+
+    // write directly into the trajectory storage
+    trackState.filtered() = filtered;
+    trackState.filteredCovariance() = filteredCovariance;
+    trackState.chi2() = chi2;
+    ACTS_VERBOSE("Filtered parameters: " << filtered.transpose());
+    ACTS_VERBOSE("Filtered covariance:\n" << filteredCovariance);
+    ACTS_VERBOSE("Chi2: " << chi2);
+    return true;
+  }
 };
 
 }  // namespace Acts
@@ -34,9 +34,11 @@
 #include "Acts/Utilities/Logger.hpp"
 #include "Acts/Utilities/Result.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <map>
 #include <memory>
+#include <vector>
 
 namespace Acts {
 
@@ -114,6 +116,11 @@ struct KalmanFitterOptions {
   /// Whether to run filtering in reversed direction
   bool reversedFiltering = false;
 
+  /// Maximum chi2 distance between refitted and previously filtered
+  /// parameters for which a refit reuses the stored transport jacobians
+  /// instead of propagating the track again. Zero disables the reuse.
+  double refitLinearizationChi2Max = 0.;
+
   /// Logger
   LoggerWrapper logger;
 };
@@ -1199,6 +1206,228 @@ class KalmanFitter {
     // Return the converted Track
     return kalmanResult;
   }
+
+  /// Refit a track along the surfaces of a previous fit
+  ///
+  /// @tparam source_link_t Type of the source link
+  /// @tparam start_parameters_t Type of the initial parameters
+  /// @tparam calibrator_t Type of the source link calibrator
+  /// @tparam outlier_finder_t Type of the outlier finder
+  /// @tparam parameters_t Type of parameters used for local parameters
+  ///
+  /// @param sourcelinks The fittable uncalibrated measurements
+  /// @param sParameters The initial track parameters; ignored by the
+  ///        linearized refit, see below
+  /// @param kfOptions KalmanOptions steering the fit
+  /// @param trajectory The multi trajectory holding the previous fit
+  /// @param tip The index of the last track state of the previous fit
+  ///
+  /// The surfaces of the previous track states are used as the surface
+  /// sequence of the DirectNavigator, i.e. the refit does not navigate. This
+  /// is intended for iterative refits, e.g. after outlier removal or
+  /// re-calibration. Surfaces before the first measurement of the previous
+  /// fit are not recorded and are thus not visited again.
+  ///
+  /// If @c kfOptions.refitLinearizationChi2Max is positive, the refit first
+  /// linearizes the prediction around the previous fit using the stored
+  /// predicted parameters and transport jacobians and does not propagate at
+  /// all. This is only done for smoothed fits without a reference surface. As
+  /// soon as the refitted parameters deviate from the previous ones by more
+  /// than the allowed chi2, the track is propagated again.
+  ///
+  /// @note The linearized refit starts from the first predicted parameters of
+  ///       the previous fit and does not use @p sParameters. Callers that
+  ///       change the initial parameters between the fits must set
+  ///       @c kfOptions.refitLinearizationChi2Max to zero.
+  ///
+  /// @return the output as an output track
+  template <typename source_link_t, typename start_parameters_t,
+            typename calibrator_t, typename outlier_finder_t,
+            typename parameters_t = BoundTrackParameters>
+  auto refit(
+      const std::vector<source_link_t>& sourcelinks,
+      const start_parameters_t& sParameters,
+      const KalmanFitterOptions<calibrator_t, outlier_finder_t>& kfOptions,
+      const MultiTrajectory<source_link_t>& trajectory, size_t tip) const
+      -> std::enable_if_t<isDirectNavigator,
+                          Result<KalmanFitterResult<source_link_t>>> {
+    const auto& logger = kfOptions.logger;
+
+    // Collect the previous track states in forward order
+    std::vector<size_t> indices;
+    trajectory.visitBackwards(
+        tip, [&](const auto& state) { indices.push_back(state.index()); });
+    std::reverse(indices.begin(), indices.end());
+
+    if (0 < kfOptions.refitLinearizationChi2Max and
+        kfOptions.referenceSurface == nullptr and
+        not kfOptions.reversedFiltering) {
+      auto result =
+          linearizedRefit(sourcelinks, kfOptions, trajectory, indices);
+      if (result.ok()) {
+        return result;
+      }
+      ACTS_DEBUG("Linearized refit failed: " << result.error()
+                                             << ", propagate the track");
+    }
+
+    std::vector<const Surface*> sSequence;
+    sSequence.reserve(indices.size());
+    for (size_t index : indices) {
+      sSequence.push_back(&trajectory.getTrackState(index).referenceSurface());
+    }
+    return fit<source_link_t, start_parameters_t, calibrator_t,
+               outlier_finder_t, parameters_t>(sourcelinks, sParameters,
+                                               kfOptions, sSequence);
+  }
+
+ private:
+  /// Refit without propagation around the linearization of a previous fit
+  ///
+  /// @param sourcelinks The fittable uncalibrated measurements
+  /// @param kfOptions KalmanOptions steering the fit
+  /// @param trajectory The multi trajectory holding the previous fit
+  /// @param indices The previous track state indices in forward order
+  ///
+  /// The predicted parameters are the previous predicted parameters shifted
+  /// by the transported change of the filtered parameters. The predicted
+  /// covariance is corrected likewise, which keeps the process noise from
+  /// material effects of the previous propagation.
+  template <typename source_link_t, typename calibrator_t,
+            typename outlier_finder_t>
+  Result<KalmanFitterResult<source_link_t>> linearizedRefit(
+      const std::vector<source_link_t>& sourcelinks,
+      const KalmanFitterOptions<calibrator_t, outlier_finder_t>& kfOptions,
+      const MultiTrajectory<source_link_t>& trajectory,
+      const std::vector<size_t>& indices) const {
+    const auto& logger = kfOptions.logger;
+
+    std::map<GeometryIdentifier, source_link_t> inputMeasurements;
+    for (const auto& sl : sourcelinks) {
+      inputMeasurements.emplace(sl.geometryId(), sl);
+    }
+
+    updater_t updater;
+    smoother_t smoother;
+    KalmanFitterResult<source_link_t> result;
+
+    // Change of the filtered parameters and covariance w.r.t. the previous
+    // fit on the last visited state
+    BoundVector deltaFiltered = BoundVector::Zero();
+    BoundSymMatrix deltaFilteredCovariance = BoundSymMatrix::Zero();
+    for (size_t i = 0; i < indices.size(); ++i) {
+      const auto previous = trajectory.getTrackState(indices[i]);
+      if (not previous.hasPredicted() or not previous.hasJacobian()) {
+        return KalmanFitterError::RefitLinearizationInvalid;
+      }
+      const Surface& surface = previous.referenceSurface();
+
+      // The first state keeps its prediction since the initial parameters
+      // are unchanged
+      const BoundMatrix& jacobian = previous.jacobian();
+      BoundVector predicted = previous.predicted() + jacobian * deltaFiltered;
+      BoundSymMatrix predictedCovariance =
+          previous.predictedCovariance() +
+          jacobian * deltaFilteredCovariance * jacobian.transpose();
+
+      BoundVector filtered = predicted;
+      BoundSymMatrix filteredCovariance = predictedCovariance;
+      auto sourcelink_it = inputMeasurements.find(surface.geometryId());
+      if (sourcelink_it != inputMeasurements.end()) {
+        result.lastTrackIndex = result.fittedStates.addTrackState(
+            TrackStatePropMask::All, result.lastTrackIndex);
+        auto trackStateProxy =
+            result.fittedStates.getTrackState(result.lastTrackIndex);
+        trackStateProxy.setReferenceSurface(surface.getSharedPtr());
+        trackStateProxy.uncalibrated() = sourcelink_it->second;
+        trackStateProxy.predicted() = predicted;
+        trackStateProxy.predictedCovariance() = predictedCovariance;
+        trackStateProxy.jacobian() = jacobian;
+        trackStateProxy.pathLength() = previous.pathLength();
+        std::visit(
+            [&](const auto& calibrated) {
+              trackStateProxy.setCalibrated(calibrated);
+            },
+            kfOptions.calibrator(trackStateProxy.uncalibrated(),
+                                 trackStateProxy.predicted()));
+
+        auto& typeFlags = trackStateProxy.typeFlags();
+        typeFlags.set(TrackStateFlag::ParameterFlag);
+        if (surface.surfaceMaterial() != nullptr) {
+          typeFlags.set(TrackStateFlag::MaterialFlag);
+        }
+        if (not kfOptions.outlierFinder(trackStateProxy)) {
+          auto updateRes =
+              updater(kfOptions.geoContext, trackStateProxy, forward, logger);
+          if (!updateRes.ok()) {
+            // not an error, the caller propagates the track instead
+            ACTS_DEBUG("Update step failed: " << updateRes.error());
+            return updateRes.error();
+          }
+          typeFlags.set(TrackStateFlag::MeasurementFlag);
+          filtered = trackStateProxy.filtered();
+          filteredCovariance = trackStateProxy.filteredCovariance();
+          ++result.measurementStates;
+        } else {
+          typeFlags.set(TrackStateFlag::OutlierFlag);
+          trackStateProxy.data().ifiltered = trackStateProxy.data().ipredicted;
+        }
+        ++result.processedStates;
+        result.measurementHoles = result.missedActiveSurfaces.size();
+        result.lastMeasurementIndex = result.lastTrackIndex;
+      } else if (result.measurementStates > 0) {
+        // Same state content as for holes and passive material in the filter
+        result.lastTrackIndex = result.fittedStates.addTrackState(
+            ~(TrackStatePropMask::Uncalibrated |
+              TrackStatePropMask::Calibrated | TrackStatePropMask::Filtered),
+            result.lastTrackIndex);
+        auto trackStateProxy =
+            result.fittedStates.getTrackState(result.lastTrackIndex);
+        trackStateProxy.setReferenceSurface(surface.getSharedPtr());
+        trackStateProxy.predicted() = predicted;
+        trackStateProxy.predictedCovariance() = predictedCovariance;
+        trackStateProxy.jacobian() = jacobian;
+        trackStateProxy.pathLength() = previous.pathLength();
+        trackStateProxy.data().ifiltered = trackStateProxy.data().ipredicted;
+
+        auto& typeFlags = trackStateProxy.typeFlags();
+        typeFlags.set(TrackStateFlag::ParameterFlag);
+        if (surface.surfaceMaterial() != nullptr) {
+          typeFlags.set(TrackStateFlag::MaterialFlag);
+        }
+        if (surface.associatedDetectorElement() != nullptr) {
+          typeFlags.set(TrackStateFlag::HoleFlag);
+          result.missedActiveSurfaces.push_back(&surface);
+        }
+        ++result.processedStates;
+      }
+
+      // The linearization is only valid close to the previous fit
+      deltaFiltered = filtered - previous.filtered();
+      deltaFilteredCovariance =
+          filteredCovariance - previous.filteredCovariance();
+      double chi2 = deltaFiltered.dot(
+          previous.filteredCovariance().inverse() * deltaFiltered);
+      if (kfOptions.refitLinearizationChi2Max < chi2) {
+        ACTS_VERBOSE("Refitted parameters on surface "
+                     << surface.geometryId() << " deviate with chi2 " << chi2);
+        return KalmanFitterError::RefitLinearizationInvalid;
+      }
+    }
+
+    if (result.measurementStates == 0) {
+      return KalmanFitterError::NoMeasurementFound;
+    }
+    auto smoothRes = smoother(kfOptions.geoContext, result.fittedStates,
+                              result.lastMeasurementIndex, logger);
+    if (!smoothRes.ok()) {
+      ACTS_DEBUG("Smoothing step failed: " << smoothRes.error());
+      return smoothRes.error();
+    }
+    result.smoothed = true;
+    result.finished = true;
+    return result;
+  }
 };
 
 }  // namespace Acts
@@ -20,6 +20,7 @@ enum class KalmanFitterError {
   OutputConversionFailed,
   NoMeasurementFound,
   ReverseNavigationFailed,
+  RefitLinearizationInvalid,
 };
 
 std::error_code make_error_code(Acts::KalmanFitterError e);
@@ -0,0 +1,96 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+
+#include <cstddef>
+
+namespace Acts {
+namespace detail {
+
+/// Fixed-size Kalman filter update in the gain matrix formalism.
+///
+/// @tparam kSize Measurement dimension
+/// @param predicted Predicted parameters
+/// @param predictedCovariance Predicted covariance
+/// @param calibrated Calibrated measurement
+/// @param calibratedCovariance Calibrated measurement covariance
+/// @param H Projection from the bound parameters onto the measurement
+/// @param[out] filtered Filtered parameters
+/// @param[out] filteredCovariance Filtered covariance
+/// @param[out] chi2 Chi2 of the filtered residual
+/// @return false if the gain matrix could not be computed
+///
+/// All inputs and outputs are plain fixed-size matrices, i.e. callers must
+/// copy from/to the (strided) trajectory storage. This keeps all operations
+/// on small, contiguous objects where Eigen can fully unroll the products and
+/// use the closed-form inverses for small matrices. The product of the
+/// predicted covariance and the transposed projector is computed only once
+/// and is reused for the gain matrix and the covariance update.
+template <size_t kSize>
+inline bool gainMatrixUpdate(
+    const BoundVector& predicted, const BoundSymMatrix& predictedCovariance,
+    const ActsVector<kSize>& calibrated,
+    const ActsSymMatrix<kSize>& calibratedCovariance,
+    const ActsMatrix<kSize, eBoundSize>& H, BoundVector& filtered,
+    BoundSymMatrix& filteredCovariance, double& chi2) {
+  const ActsMatrix<eBoundSize, kSize> PHt = predictedCovariance * H.transpose();
+  const ActsSymMatrix<kSize> S = H * PHt + calibratedCovariance;
+  const ActsMatrix<eBoundSize, kSize> K = PHt * S.inverse();
+  if (K.hasNaN()) {
+    return false;
+  }
+
+  filtered = predicted + K * (calibrated - H * predicted);
+  // equivalent to (1 - K * H) * P but avoids the full bound matrix product
+  filteredCovariance = predictedCovariance - K * PHt.transpose();
+
+  const ActsVector<kSize> residual = calibrated - H * filtered;
+  const ActsSymMatrix<kSize> residualCovariance =
+      (ActsSymMatrix<kSize>::Identity() - H * K) * calibratedCovariance;
+  chi2 = residual.dot(residualCovariance.inverse() * residual);
+  return true;
+}
+
+/// Fixed-size Kalman smoothing step in the gain matrix formalism.
+///
+/// @param filtered Filtered parameters on this state
+/// @param filteredCovariance Filtered covariance on this state
+/// @param nextJacobian Jacobian from this state to the next state
+/// @param nextPredicted Predicted parameters on the next state
+/// @param nextPredictedCovariance Predicted covariance on the next state
+/// @param nextSmoothed Smoothed parameters on the next state
+/// @param nextSmoothedCovariance Smoothed covariance on the next state
+/// @param[out] smoothed Smoothed parameters on this state
+/// @param[out] smoothedCovariance Smoothed covariance on this state
+/// @return false if the smoothing gain matrix could not be computed
+inline bool gainMatrixSmooth(const BoundVector& filtered,
+                             const BoundSymMatrix& filteredCovariance,
+                             const BoundMatrix& nextJacobian,
+                             const BoundVector& nextPredicted,
+                             const BoundSymMatrix& nextPredictedCovariance,
+                             const BoundVector& nextSmoothed,
+                             const BoundSymMatrix& nextSmoothedCovariance,
+                             BoundVector& smoothed,
+                             BoundSymMatrix& smoothedCovariance) {
+  const BoundMatrix G = filteredCovariance * nextJacobian.transpose() *
+                        nextPredictedCovariance.inverse();
+  if (G.hasNaN()) {
+    return false;
+  }
+  smoothed = filtered + G * (nextSmoothed - nextPredicted);
+  smoothedCovariance =
+      filteredCovariance -
+      G * (nextPredictedCovariance - nextSmoothedCovariance) * G.transpose();
+  return true;
+}
+
+}  // namespace detail
+}  // namespace Acts
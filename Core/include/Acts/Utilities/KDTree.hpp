@@ -0,0 +1,166 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Acts {
+
+/// Static k-d tree for orthogonal range searches.
+///
+/// The tree is built once from a set of points with associated values and
+/// cannot be modified afterwards. Nodes are split at the median of one
+/// dimension, cycling through the dimensions with the depth, until they
+/// contain at most @p leaf_size elements. This does not depend on the scale
+/// of the coordinates, e.g. angles and lengths. Nodes and elements are
+/// stored contiguously.
+///
+/// @tparam DIM The number of dimensions
+/// @tparam value_t The type of the values associated with the points
+/// @tparam scalar_t The type of the coordinates
+/// @tparam leaf_size The maximum number of elements in a leaf node
+template <std::size_t DIM, typename value_t, typename scalar_t = double,
+          std::size_t leaf_size = 4>
+class KDTree {
+ public:
+  /// Point in the indexed space
+  using coordinate_t = std::array<scalar_t, DIM>;
+  /// Point together with its value
+  using pair_t = std::pair<coordinate_t, value_t>;
+  /// Closed interval [min, max] in every dimension
+  using range_t = std::array<std::pair<scalar_t, scalar_t>, DIM>;
+
+  /// Construct the tree from a set of points and values
+  /// @param elements The points and their values; consumed by the tree
+  KDTree(std::vector<pair_t>&& elements) : m_elements(std::move(elements)) {
+    if (not m_elements.empty()) {
+      // leaves hold at least leaf_size / 2 elements after a median split
+      m_nodes.reserve(4 * m_elements.size() / leaf_size + 1);
+      m_nodes.resize(1);
+      build(0, 0, m_elements.size(), 0);
+    }
+  }
+
+  /// The number of indexed elements
+  std::size_t size() const { return m_elements.size(); }
+
+  /// Call a function for every element inside an orthogonal range
+  /// @param range The closed interval in every dimension
+  /// @param func Callable as func(const coordinate_t&, const value_t&)
+  template <typename callable_t>
+  void rangeSearchMap(const range_t& range, callable_t&& func) const {
+    if (not m_nodes.empty()) {
+      rangeSearchNode(0, range, func);
+    }
+  }
+
+  /// Append the values of all elements inside an orthogonal range
+  /// @param range The closed interval in every dimension
+  /// @param values The vector to which the values are appended
+  void rangeSearch(const range_t& range, std::vector<value_t>& values) const {
+    rangeSearchMap(range, [&](const coordinate_t&, const value_t& value) {
+      values.push_back(value);
+    });
+  }
+
+  /// Check whether a point is inside an orthogonal range
+  static bool contains(const range_t& range, const coordinate_t& point) {
+    for (std::size_t d = 0; d < DIM; ++d) {
+      if (point[d] < range[d].first or range[d].second < point[d]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+ private:
+  struct Node {
+    // elements of this node are [begin, end)
+    std::size_t begin;
+    std::size_t end;
+    // children are stored at left and left + 1; zero for leaves
+    std::size_t left;
+    // bounding box of the elements
+    range_t bounds;
+  };
+
+  void build(std::size_t index, std::size_t begin, std::size_t end,
+             std::size_t dim) {
+    range_t bounds;
+    for (std::size_t d = 0; d < DIM; ++d) {
+      bounds[d] = {std::numeric_limits<scalar_t>::max(),
+                   std::numeric_limits<scalar_t>::lowest()};
+    }
+    for (std::size_t i = begin; i < end; ++i) {
+      for (std::size_t d = 0; d < DIM; ++d) {
+        bounds[d].first = std::min(bounds[d].first, m_elements[i].first[d]);
+        bounds[d].second = std::max(bounds[d].second, m_elements[i].first[d]);
+      }
+    }
+    m_nodes[index] = {begin, end, 0, bounds};
+
+    if (end - begin <= leaf_size) {
+      return;
+    }
+
+    // split at the median, cycling through the dimensions with the depth
+    std::size_t mid = begin + (end - begin) / 2;
+    std::nth_element(m_elements.begin() + begin, m_elements.begin() + mid,
+                     m_elements.begin() + end,
+                     [dim](const pair_t& lhs, const pair_t& rhs) {
+                       return lhs.first[dim] < rhs.first[dim];
+                     });
+
+    // both children are allocated next to each other
+    std::size_t left = m_nodes.size();
+    m_nodes.resize(left + 2);
+    m_nodes[index].left = left;
+    build(left, begin, mid, (dim + 1) % DIM);
+    build(left + 1, mid, end, (dim + 1) % DIM);
+  }
+
+  template <typename callable_t>
+  void rangeSearchNode(std::size_t index, const range_t& range,
+                       callable_t& func) const {
+    const Node& node = m_nodes[index];
+    bool inside = true;
+    for (std::size_t d = 0; d < DIM; ++d) {
+      if (node.bounds[d].second < range[d].first or
+          range[d].second < node.bounds[d].first) {
+        return;
+      }
+      inside = inside and range[d].first <= node.bounds[d].first and
+               node.bounds[d].second <= range[d].second;
+    }
+    if (inside) {
+      for (std::size_t i = node.begin; i < node.end; ++i) {
+        func(m_elements[i].first, m_elements[i].second);
+      }
+    } else if (node.left == 0) {
+      for (std::size_t i = node.begin; i < node.end; ++i) {
+        if (contains(range, m_elements[i].first)) {
+          func(m_elements[i].first, m_elements[i].second);
+        }
+      }
+    } else {
+      rangeSearchNode(node.left, range, func);
+      rangeSearchNode(node.left + 1, range, func);
+    }
+  }
+
+  std::vector<pair_t> m_elements;
+  std::vector<Node> m_nodes;
+};
+
+}  // namespace Acts
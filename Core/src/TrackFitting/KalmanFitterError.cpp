@@ -30,6 +30,8 @@ class KalmanFitterErrorCategory : public std::error_category {
         return "Kalman output conversion failed";
       case KalmanFitterError::NoMeasurementFound:
         return "No measurement detected during the propagation";
+      case KalmanFitterError::RefitLinearizationInvalid:
+        return "Refit deviates too much from the previous linearization";
       default:
         return "unknown";
     }
@@ -56,6 +56,13 @@ ActsExamples::DigitizationAlgorithm::DigitizationAlgorithm(
     throw std::invalid_argument("Missing digitization configuration");
   }
 
+  declareInput(m_cfg.inputSimHits);
+  declareOutput(m_cfg.outputMeasurements);
+  declareOutput(m_cfg.outputClusters);
+  declareOutput(m_cfg.outputSourceLinks);
+  declareOutput(m_cfg.outputMeasurementParticlesMap);
+  declareOutput(m_cfg.outputMeasurementSimHitsMap);
+
   // Create the digitizers from the configuration
   std::vector<std::pair<Acts::GeometryIdentifier, Digitizer>> digitizerInput;
 
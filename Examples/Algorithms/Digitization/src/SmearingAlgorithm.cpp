@@ -51,6 +51,13 @@ ActsExamples::SmearingAlgorithm::SmearingAlgorithm(DigitizationConfig cfg,
   if (m_cfg.digitizationConfigs.empty()) {
     throw std::invalid_argument("Missing smearers configuration");
   }
+
+  declareInput(m_cfg.inputSimHits);
+  declareOutput(m_cfg.outputMeasurements);
+  declareOutput(m_cfg.outputSourceLinks);
+  declareOutput(m_cfg.outputMeasurementParticlesMap);
+  declareOutput(m_cfg.outputMeasurementSimHitsMap);
+
   // create the smearers from the configuration
   std::vector<std::pair<Acts::GeometryIdentifier, Smearer>> smearersInput;
   for (size_t i = 0; i < m_cfg.digitizationConfigs.size(); ++i) {
@@ -195,21 +195,32 @@ ActsExamples::ProcessCode ActsExamples::FatrasAlgorithm::execute(
   simHitsUnordered.reserve(inputParticles.size() *
                            m_cfg.averageHitsPerParticle);
 
-  // run the simulation w/ a local random generator
-  auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
-  auto ret = m_sim->simulate(ctx.geoContext, ctx.magFieldContext, rng,
-                             inputParticles, particlesInitialUnordered,
-                             particlesFinalUnordered, simHitsUnordered);
-  // fatal error leads to panic
-  if (not ret.ok()) {
-    ACTS_FATAL("event " << ctx.eventNumber << " simulation failed with error "
-                        << ret.error());
-    return ProcessCode::ABORT;
+  // run the simulation for each input particle w/ its own random generator.
+  // a particle, its secondaries, and its hits thus do not depend on the
+  // other particles in the event.
+  std::vector<ActsFatras::FailedParticle> failedParticles;
+  SimParticleContainer singleParticle;
+  for (const auto &particle : inputParticles) {
+    singleParticle.clear();
+    singleParticle.insert(particle);
+    auto rng = m_cfg.randomNumbers->spawnGenerator(
+        ctx, particle.particleId().value());
+    auto ret = m_sim->simulate(ctx.geoContext, ctx.magFieldContext, rng,
+                               singleParticle, particlesInitialUnordered,
+                               particlesFinalUnordered, simHitsUnordered);
+    // fatal error leads to panic
+    if (not ret.ok()) {
+      ACTS_FATAL("event " << ctx.eventNumber
+                          << " simulation failed with error " << ret.error());
+      return ProcessCode::ABORT;
+    }
+    failedParticles.insert(failedParticles.end(), ret.value().begin(),
+                           ret.value().end());
   }
   // failed particles are just logged. assumes that failed particles are due
   // to edge-cases representing a tiny fraction of the event; not due to a
   // fundamental issue.
-  for (const auto &failed : ret.value()) {
+  for (const auto &failed : failedParticles) {
     ACTS_ERROR("event " << ctx.eventNumber << " particle " << failed.particle
                         << " failed to simulate with error " << failed.error
                         << ": " << failed.error.message());
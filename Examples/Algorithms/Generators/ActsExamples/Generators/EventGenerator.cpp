@@ -32,6 +32,11 @@ std::string ActsExamples::EventGenerator::name() const {
   return "EventGenerator";
 }
 
+std::optional<ActsExamples::DataDependencies>
+ActsExamples::EventGenerator::dataDependencies() const {
+  return DataDependencies{{}, {m_cfg.outputParticles}};
+}
+
 std::pair<size_t, size_t> ActsExamples::EventGenerator::availableEvents()
     const {
   return {0u, SIZE_MAX};
@@ -70,6 +70,8 @@ class EventGenerator final : public ActsExamples::IReader {
   std::pair<size_t, size_t> availableEvents() const final;
   /// Generate an event.
   ProcessCode read(const AlgorithmContext& context) final;
+  /// The generated particles collection.
+  std::optional<DataDependencies> dataDependencies() const final;
 
  private:
   const Acts::Logger& logger() const { return *m_logger; }
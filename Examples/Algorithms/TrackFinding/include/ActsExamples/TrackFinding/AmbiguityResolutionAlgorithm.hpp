@@ -0,0 +1,66 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "Acts/TrackFinding/GreedyAmbiguityResolution.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/Trajectories.hpp"
+#include "ActsExamples/Framework/BareAlgorithm.hpp"
+
+#include <string>
+
+namespace ActsExamples {
+
+/// Remove duplicated track candidates with a greedy shared-hit resolution.
+///
+/// All trajectories, i.e. all tips of all multi trajectories, in the input
+/// collection are resolved together. The output collection has the same size
+/// as the input collection; multi trajectories without any accepted tip are
+/// replaced by an empty entry.
+class AmbiguityResolutionAlgorithm final : public BareAlgorithm {
+ public:
+  struct Config {
+    /// Input measurements collection.
+    std::string inputMeasurements;
+    /// Input trajectories collection.
+    std::string inputTrajectories;
+    /// Output trajectories collection.
+    std::string outputTrajectories;
+    /// Maximum number of measurements shared with accepted trajectories.
+    size_t maximumSharedHits = 1;
+    /// Minimum number of measurements required for a trajectory.
+    size_t nMeasurementsMin = 7;
+  };
+
+  /// Construct the ambiguity resolution algorithm.
+  ///
+  /// @param cfg is the algorithm configuration
+  /// @param lvl is the logging level
+  AmbiguityResolutionAlgorithm(Config cfg, Acts::Logging::Level lvl);
+
+  /// Run the ambiguity resolution.
+  ///
+  /// @param ctx is the algorithm context with event information
+  /// @return a process code indication success or failure
+  ProcessCode execute(const AlgorithmContext& ctx) const final;
+
+  /// Const access to the config
+  const Config& config() const { return m_cfg; }
+
+ private:
+  Config m_cfg;
+
+  ReadDataHandle<MeasurementContainer> m_inputMeasurements;
+  ReadDataHandle<TrajectoriesContainer> m_inputTrajectories;
+  WriteDataHandle<TrajectoriesContainer> m_outputTrajectories;
+
+  Acts::GreedyAmbiguityResolution m_resolution;
+};
+
+}  // namespace ActsExamples
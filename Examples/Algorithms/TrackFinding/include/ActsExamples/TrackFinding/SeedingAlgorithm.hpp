@@ -49,6 +49,9 @@ class SeedingAlgorithm final : public BareAlgorithm {
     float beamPosX = 0;
     float beamPosY = 0;
     float impactMax = 3.;
+    /// Number of phi-z groups processed together by one task; groups are
+    /// processed serially if zero. The seeds do not depend on this setting.
+    size_t groupChunkSize = 0;
   };
 
   /// Construct the seeding algorithm.
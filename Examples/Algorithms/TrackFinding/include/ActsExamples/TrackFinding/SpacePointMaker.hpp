@@ -9,6 +9,9 @@
 #pragma once
 
 #include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/SimSpacePoint.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
 
 #include <memory>
@@ -31,6 +34,8 @@ namespace ActsExamples {
 /// input. The source link container is geometry-sorted and each element is
 /// small compared to a measurement. The geometry selection is therefore much
 /// easier to perform on the source links than on the unsorted measurements.
+/// The source links are processed module by module, such that each surface
+/// and, for planar modules, its transform is looked up only once.
 ///
 /// There are no explicit requirements on the content of the input measurements.
 /// If no local positions are measured, the transformed global positions will
@@ -70,6 +75,10 @@ class SpacePointMaker final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+
+  ReadDataHandle<IndexSourceLinkContainer> m_inputSourceLinks;
+  ReadDataHandle<MeasurementContainer> m_inputMeasurements;
+  WriteDataHandle<SimSpacePointContainer> m_outputSpacePoints;
 };
 
 }  // namespace ActsExamples
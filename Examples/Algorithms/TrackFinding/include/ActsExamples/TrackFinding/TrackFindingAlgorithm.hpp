@@ -11,8 +11,10 @@
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/TrackFinding/CombinatorialKalmanFilter.hpp"
 #include "Acts/TrackFinding/MeasurementSelector.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
 #include "ActsExamples/EventData/Measurement.hpp"
 #include "ActsExamples/EventData/Track.hpp"
+#include "ActsExamples/EventData/Trajectories.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
 #include "ActsExamples/MagneticField/MagneticField.hpp"
 
@@ -56,6 +58,9 @@ class TrackFindingAlgorithm final : public BareAlgorithm {
     TrackFinderFunction findTracks;
     /// CKF measurement selector config
     Acts::MeasurementSelector::Config measurementSelectorCfg;
+    /// Number of seeds processed together by one task; seeds are processed
+    /// serially in a single call if zero.
+    size_t seedChunkSize = 0;
   };
 
   /// Constructor of the track finding algorithm
@@ -73,6 +78,11 @@ class TrackFindingAlgorithm final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+
+  ReadDataHandle<MeasurementContainer> m_inputMeasurements;
+  ReadDataHandle<IndexSourceLinkContainer> m_inputSourceLinks;
+  ReadDataHandle<TrackParametersContainer> m_inputInitialTrackParameters;
+  WriteDataHandle<TrajectoriesContainer> m_outputTrajectories;
 };
 
 }  // namespace ActsExamples
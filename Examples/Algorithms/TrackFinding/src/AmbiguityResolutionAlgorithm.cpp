@@ -0,0 +1,96 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/TrackFinding/AmbiguityResolutionAlgorithm.hpp"
+
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/Trajectories.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+Acts::GreedyAmbiguityResolution::Config makeResolutionConfig(
+    const ActsExamples::AmbiguityResolutionAlgorithm::Config& cfg) {
+  Acts::GreedyAmbiguityResolution::Config resolutionCfg;
+  resolutionCfg.maximumSharedHits = cfg.maximumSharedHits;
+  resolutionCfg.nMeasurementsMin = cfg.nMeasurementsMin;
+  return resolutionCfg;
+}
+
+}  // namespace
+
+ActsExamples::AmbiguityResolutionAlgorithm::AmbiguityResolutionAlgorithm(
+    Config cfg, Acts::Logging::Level lvl)
+    : ActsExamples::BareAlgorithm("AmbiguityResolutionAlgorithm", lvl),
+      m_cfg(std::move(cfg)),
+      m_resolution(makeResolutionConfig(m_cfg)) {
+  if (m_cfg.inputMeasurements.empty()) {
+    throw std::invalid_argument("Missing measurements input collection");
+  }
+  if (m_cfg.inputTrajectories.empty()) {
+    throw std::invalid_argument("Missing trajectories input collection");
+  }
+  if (m_cfg.outputTrajectories.empty()) {
+    throw std::invalid_argument("Missing trajectories output collection");
+  }
+
+  declareInput(m_inputMeasurements, m_cfg.inputMeasurements);
+  declareInput(m_inputTrajectories, m_cfg.inputTrajectories);
+  declareOutput(m_outputTrajectories, m_cfg.outputTrajectories);
+}
+
+ActsExamples::ProcessCode ActsExamples::AmbiguityResolutionAlgorithm::execute(
+    const ActsExamples::AlgorithmContext& ctx) const {
+  using Candidate = Acts::GreedyAmbiguityResolution::Candidate<IndexSourceLink>;
+
+  const auto& measurements = m_inputMeasurements(ctx.eventStore);
+  const auto& trajectories = m_inputTrajectories(ctx.eventStore);
+
+  // Collect all trajectories in seed order and remember where they are from
+  std::vector<Candidate> candidates;
+  std::vector<size_t> candidateTrajectories;
+  for (size_t itraj = 0; itraj < trajectories.size(); ++itraj) {
+    const auto& traj = trajectories[itraj];
+    for (auto tip : traj.tips()) {
+      candidates.push_back({&traj.multiTrajectory(), tip});
+      candidateTrajectories.push_back(itraj);
+    }
+  }
+
+  auto accepted = m_resolution.solve(
+      candidates, measurements.size(),
+      [](const IndexSourceLink& sl) { return sl.index(); });
+  ACTS_DEBUG("Accepted " << accepted.size() << " out of " << candidates.size()
+                         << " track candidates");
+
+  // Rebuild the trajectories with only the accepted tips. Accepted candidates
+  // are sorted and thus grouped by their input trajectories.
+  TrajectoriesContainer resolved(trajectories.size());
+  for (auto it = accepted.begin(); it != accepted.end();) {
+    const size_t itraj = candidateTrajectories[*it];
+    const auto& traj = trajectories[itraj];
+    std::vector<size_t> tips;
+    Trajectories::IndexedParameters parameters;
+    for (; (it != accepted.end()) and (candidateTrajectories[*it] == itraj);
+         ++it) {
+      const size_t tip = candidates[*it].tip;
+      tips.push_back(tip);
+      if (traj.hasTrackParameters(tip)) {
+        parameters.emplace(tip, traj.trackParameters(tip));
+      }
+    }
+    resolved[itraj] = Trajectories(traj.multiTrajectory(), tips, parameters);
+  }
+
+  m_outputTrajectories(ctx.eventStore, std::move(resolved));
+  return ActsExamples::ProcessCode::SUCCESS;
+}
@@ -18,8 +18,14 @@
 #include "ActsExamples/EventData/SimSeed.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <stdexcept>
 
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+
 ActsExamples::SeedingAlgorithm::SeedingAlgorithm(
     ActsExamples::SeedingAlgorithm::Config cfg, Acts::Logging::Level lvl)
     : ActsExamples::BareAlgorithm("SeedingAlgorithm", lvl),
@@ -39,6 +45,12 @@ ActsExamples::SeedingAlgorithm::SeedingAlgorithm(
     throw std::invalid_argument("Missing seeds output collection");
   }
 
+  for (const auto& i : m_cfg.inputSpacePoints) {
+    declareInput(i);
+  }
+  declareOutput(m_cfg.outputSeeds);
+  declareOutput(m_cfg.outputProtoTracks);
+
   m_gridCfg.bFieldInZ = m_cfg.bFieldInZ;
   m_gridCfg.minPt = m_cfg.minPt;
   m_gridCfg.rMax = m_cfg.rMax;
@@ -112,12 +124,51 @@ ActsExamples::ProcessCode ActsExamples::SeedingAlgorithm::execute(
 
   // run the seeding
   SimSeedContainer seeds;
-  auto group = spacePointsGrouping.begin();
-  auto groupEnd = spacePointsGrouping.end();
-  for (; !(group == groupEnd); ++group) {
-    const auto& groupSeeds =
-        finder.createSeedsForGroup(group.bottom(), group.middle(), group.top());
-    std::copy(groupSeeds.begin(), groupSeeds.end(), std::back_inserter(seeds));
+  if (m_cfg.groupChunkSize == 0) {
+    // the scratch memory is shared by all groups and kept by each worker for
+    // the following events
+    auto& state = ctx.localState<Acts::Seedfinder<SimSpacePoint>::State>();
+    auto group = spacePointsGrouping.begin();
+    auto groupEnd = spacePointsGrouping.end();
+    for (; !(group == groupEnd); ++group) {
+      finder.createSeedsForGroup(state, seeds, group.bottom(), group.middle(),
+                                 group.top());
+    }
+  } else {
+    // Groups are independent and only read the space point grid. Each thread
+    // has its own scratch memory and each chunk writes into its own output
+    // container so the output order does not depend on scheduling.
+    const size_t nGroups = spacePointsGrouping.numGroups();
+    const size_t nChunks =
+        (nGroups + m_cfg.groupChunkSize - 1) / m_cfg.groupChunkSize;
+    std::vector<SimSeedContainer> chunkSeeds(nChunks);
+    tbb::enumerable_thread_specific<Acts::Seedfinder<SimSpacePoint>::State>
+        states;
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, nChunks),
+        [&](const tbb::blocked_range<size_t>& r) {
+          auto& state = states.local();
+          for (size_t ichunk = r.begin(); ichunk != r.end(); ++ichunk) {
+            const size_t first = ichunk * m_cfg.groupChunkSize;
+            const size_t last =
+                std::min(first + m_cfg.groupChunkSize, nGroups);
+            for (size_t igroup = first; igroup < last; ++igroup) {
+              auto group = spacePointsGrouping.group(igroup);
+              finder.createSeedsForGroup(state, chunkSeeds[ichunk],
+                                         group.bottom(), group.middle(),
+                                         group.top());
+            }
+          }
+        });
+    // Merge the chunks in group order
+    size_t nChunkSeeds = 0;
+    for (const auto& chunk : chunkSeeds) {
+      nChunkSeeds += chunk.size();
+    }
+    seeds.reserve(nChunkSeeds);
+    for (auto& chunk : chunkSeeds) {
+      std::move(chunk.begin(), chunk.end(), std::back_inserter(seeds));
+    }
   }
 
   // extract proto tracks, i.e. groups of measurement indices, from tracks seeds
@@ -39,6 +39,11 @@ ActsExamples::SpacePointMaker::SpacePointMaker(Config cfg,
   if (m_cfg.geometrySelection.empty()) {
     throw std::invalid_argument("Missing space point maker geometry selection");
   }
+
+  declareInput(m_inputSourceLinks, m_cfg.inputSourceLinks);
+  declareInput(m_inputMeasurements, m_cfg.inputMeasurements);
+  declareOutput(m_outputSpacePoints, m_cfg.outputSpacePoints);
+
   // ensure geometry selection contains only valid inputs
   for (const auto& geoId : m_cfg.geometrySelection) {
     if ((geoId.approach() != 0u) or (geoId.boundary() != 0u) or
@@ -85,10 +90,8 @@ ActsExamples::SpacePointMaker::SpacePointMaker(Config cfg,
 
 ActsExamples::ProcessCode ActsExamples::SpacePointMaker::execute(
     const AlgorithmContext& ctx) const {
-  const auto& sourceLinks =
-      ctx.eventStore.get<IndexSourceLinkContainer>(m_cfg.inputSourceLinks);
-  const auto& measurements =
-      ctx.eventStore.get<MeasurementContainer>(m_cfg.inputMeasurements);
+  const auto& sourceLinks = m_inputSourceLinks(ctx.eventStore);
+  const auto& measurements = m_inputMeasurements(ctx.eventStore);
 
   SimSpacePointContainer spacePoints;
   spacePoints.reserve(sourceLinks.size());
@@ -108,6 +111,12 @@ ActsExamples::ProcessCode ActsExamples::SpacePointMaker::execute(
         ACTS_ERROR("Could not find surface " << moduleGeoId);
         return ProcessCode::ABORT;
       }
+      // the local-to-global transform of planar modules does not depend on
+      // the local position. look it up once and apply it directly to all
+      // measurements on the module instead of going through the surface.
+      const bool isPlanar = (surface->type() == Acts::Surface::Plane);
+      const Acts::Transform3& moduleTransform =
+          surface->transform(ctx.geoContext);
 
       for (auto sourceLink : moduleSourceLinks) {
         // extract a local position/covariance independent from the concrecte
@@ -132,11 +141,19 @@ ActsExamples::ProcessCode ActsExamples::SpacePointMaker::execute(
             measurements[sourceLink.index()]);
 
         // transform local position to global coordinates
-        Acts::Vector3 globalFakeMom(1, 1, 1);
-        Acts::Vector3 globalPos =
-            surface->localToGlobal(ctx.geoContext, localPos, globalFakeMom);
-        Acts::RotationMatrix3 rotLocalToGlobal =
-            surface->referenceFrame(ctx.geoContext, globalPos, globalFakeMom);
+        Acts::Vector3 globalPos;
+        Acts::RotationMatrix3 rotLocalToGlobal;
+        if (isPlanar) {
+          globalPos =
+              moduleTransform * Acts::Vector3(localPos.x(), localPos.y(), 0);
+          rotLocalToGlobal = moduleTransform.linear();
+        } else {
+          Acts::Vector3 globalFakeMom(1, 1, 1);
+          globalPos =
+              surface->localToGlobal(ctx.geoContext, localPos, globalFakeMom);
+          rotLocalToGlobal = surface->referenceFrame(ctx.geoContext, globalPos,
+                                                     globalFakeMom);
+        }
 
         // the space point requires only the variance of the transverse and
         // longitudinal position. reduce computations by transforming the
@@ -171,7 +188,7 @@ ActsExamples::ProcessCode ActsExamples::SpacePointMaker::execute(
   spacePoints.shrink_to_fit();
 
   ACTS_DEBUG("Created " << spacePoints.size() << " space points");
-  ctx.eventStore.add(m_cfg.outputSpacePoints, std::move(spacePoints));
+  m_outputSpacePoints(ctx.eventStore, std::move(spacePoints));
 
   return ActsExamples::ProcessCode::SUCCESS;
 }
@@ -13,8 +13,13 @@
 #include "ActsExamples/EventData/Trajectories.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <stdexcept>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 ActsExamples::TrackFindingAlgorithm::TrackFindingAlgorithm(
     Config cfg, Acts::Logging::Level level)
     : ActsExamples::BareAlgorithm("TrackFindingAlgorithm", level),
@@ -32,17 +37,20 @@ ActsExamples::TrackFindingAlgorithm::TrackFindingAlgorithm(
   if (m_cfg.outputTrajectories.empty()) {
     throw std::invalid_argument("Missing trajectories output collection");
   }
+
+  declareInput(m_inputMeasurements, m_cfg.inputMeasurements);
+  declareInput(m_inputSourceLinks, m_cfg.inputSourceLinks);
+  declareInput(m_inputInitialTrackParameters,
+               m_cfg.inputInitialTrackParameters);
+  declareOutput(m_outputTrajectories, m_cfg.outputTrajectories);
 }
 
 ActsExamples::ProcessCode ActsExamples::TrackFindingAlgorithm::execute(
     const ActsExamples::AlgorithmContext& ctx) const {
   // Read input data
-  const auto& measurements =
-      ctx.eventStore.get<MeasurementContainer>(m_cfg.inputMeasurements);
-  const auto& sourceLinks =
-      ctx.eventStore.get<IndexSourceLinkContainer>(m_cfg.inputSourceLinks);
-  const auto& initialParameters = ctx.eventStore.get<TrackParametersContainer>(
-      m_cfg.inputInitialTrackParameters);
+  const auto& measurements = m_inputMeasurements(ctx.eventStore);
+  const auto& sourceLinks = m_inputSourceLinks(ctx.eventStore);
+  const auto& initialParameters = m_inputInitialTrackParameters(ctx.eventStore);
 
   // Prepare the output data with MultiTrajectory
   TrajectoriesContainer trajectories;
@@ -65,7 +73,38 @@ ActsExamples::ProcessCode ActsExamples::TrackFindingAlgorithm::execute(
   // Perform the track finding for all initial parameters
   ACTS_DEBUG("Invoke track finding with " << initialParameters.size()
                                           << " seeds.");
-  auto results = m_cfg.findTracks(sourceLinks, initialParameters, options);
+  TrackFinderResult results;
+  if (m_cfg.seedChunkSize == 0) {
+    results = m_cfg.findTracks(sourceLinks, initialParameters, options);
+  } else {
+    // Seeds are independent; every result owns its own MultiTrajectory and
+    // the inputs are only read. Each chunk writes into its own range of the
+    // result container so the output order does not depend on scheduling.
+    const size_t nSeeds = initialParameters.size();
+    const size_t nChunks =
+        (nSeeds + m_cfg.seedChunkSize - 1) / m_cfg.seedChunkSize;
+    std::vector<TrackFinderResult> chunkResults(nChunks);
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, nChunks),
+        [&](const tbb::blocked_range<size_t>& r) {
+          TrackParametersContainer chunkParameters;
+          for (size_t ichunk = r.begin(); ichunk != r.end(); ++ichunk) {
+            auto first =
+                initialParameters.begin() + ichunk * m_cfg.seedChunkSize;
+            auto last = initialParameters.begin() +
+                        std::min((ichunk + 1) * m_cfg.seedChunkSize, nSeeds);
+            chunkParameters.assign(first, last);
+            chunkResults[ichunk] =
+                m_cfg.findTracks(sourceLinks, chunkParameters, options);
+          }
+        });
+    // Merge the chunks in seed order
+    results.reserve(nSeeds);
+    for (auto& chunk : chunkResults) {
+      std::move(chunk.begin(), chunk.end(), std::back_inserter(results));
+    }
+  }
+
   // Loop over the track finding results for all initial parameters
   for (std::size_t iseed = 0; iseed < initialParameters.size(); ++iseed) {
     // The result for this seed
@@ -90,6 +129,6 @@ ActsExamples::ProcessCode ActsExamples::TrackFindingAlgorithm::execute(
   ACTS_DEBUG("Finalized track finding with " << trajectories.size()
                                              << " track candidates.");
 
-  ctx.eventStore.add(m_cfg.outputTrajectories, std::move(trajectories));
+  m_outputTrajectories(ctx.eventStore, std::move(trajectories));
   return ActsExamples::ProcessCode::SUCCESS;
 }
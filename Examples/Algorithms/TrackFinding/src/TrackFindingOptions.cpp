@@ -29,6 +29,9 @@ void ActsExamples::Options::addTrackFindingOptions(
       value<Reals<6>>()->default_value({{1., 1., 1., 1., 1., 1.}}),
       "Inflation factor for the initial variances in the CKF search, must be "
       "of form i:j:k:l:m:n.");
+  opt("ckf-seed-chunk-size", value<size_t>()->default_value(0),
+      "Number of seeds processed together by one parallel CKF task within an "
+      "event, 0 to process all seeds of an event serially.");
 }
 
 ActsExamples::TrackFindingAlgorithm::Config
@@ -42,5 +45,6 @@ ActsExamples::Options::readTrackFindingConfig(
   cfg.measurementSelectorCfg = {
       {Acts::GeometryIdentifier(), {chi2Max, nMax}},
   };
+  cfg.seedChunkSize = variables["ckf-seed-chunk-size"].template as<size_t>();
   return cfg;
 }
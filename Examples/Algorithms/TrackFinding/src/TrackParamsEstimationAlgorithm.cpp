@@ -16,6 +16,7 @@
 
 #include <map>
 #include <stdexcept>
+#include <vector>
 
 ActsExamples::TrackParamsEstimationAlgorithm::TrackParamsEstimationAlgorithm(
     ActsExamples::TrackParamsEstimationAlgorithm::Config cfg,
@@ -49,6 +50,18 @@ ActsExamples::TrackParamsEstimationAlgorithm::TrackParamsEstimationAlgorithm(
     throw std::invalid_argument("Missing tracking geometry");
   }
 
+  declareInput(m_cfg.inputSourceLinks);
+  if (not m_cfg.inputSeeds.empty()) {
+    declareInput(m_cfg.inputSeeds);
+  } else {
+    declareInput(m_cfg.inputProtoTracks);
+    for (const auto& i : m_cfg.inputSpacePoints) {
+      declareInput(i);
+    }
+  }
+  declareOutput(m_cfg.outputTrackParameters);
+  declareOutput(m_cfg.outputProtoTracks);
+
   // Set up the track parameters covariance (the same for all tracks)
   m_covariance(Acts::eBoundLoc0, Acts::eBoundLoc0) =
       m_cfg.initialVarInflation[Acts::eBoundLoc0] * cfg.sigmaLoc0 *
@@ -170,7 +183,11 @@ ActsExamples::ProcessCode ActsExamples::TrackParamsEstimationAlgorithm::execute(
 
   auto bCache = m_cfg.magneticField->makeCache(ctx.magFieldContext);
 
-  // Loop over all found seeds to estimate track parameters
+  // Collect the positions, surfaces and fields of all seeds
+  Acts::SeedBatch batch;
+  batch.reserve(seeds.size());
+  std::vector<size_t> seedIndices;
+  seedIndices.reserve(seeds.size());
   for (size_t iseed = 0; iseed < seeds.size(); ++iseed) {
     const auto& seed = seeds[iseed];
     // Get the bottom space point and its reference surface
@@ -192,29 +209,35 @@ ActsExamples::ProcessCode ActsExamples::TrackParamsEstimationAlgorithm::execute(
       ACTS_ERROR("Field lookup error: " << fieldRes.error());
       return ProcessCode::ABORT;
     }
-    Acts::Vector3 field = *fieldRes;
 
-    // Estimate the track parameters from seed
-    auto optParams = Acts::estimateTrackParamsFromSeed(
-        ctx.geoContext, seed.sp().begin(), seed.sp().end(), *surface, field,
-        m_cfg.bFieldMin);
-    if (not optParams.has_value()) {
+    batch.push_back(seed.sp().begin(), *surface, *fieldRes);
+    seedIndices.push_back(iseed);
+  }
+
+  // Estimate the track parameters of all seeds at once
+  std::vector<Acts::BoundVector> estimatedParams;
+  std::vector<bool> valid;
+  Acts::estimateTrackParamsFromSeeds(ctx.geoContext, batch, m_cfg.bFieldMin,
+                                     estimatedParams, valid);
+
+  for (size_t i = 0; i < batch.size(); ++i) {
+    size_t iseed = seedIndices[i];
+    if (not valid[i]) {
       ACTS_WARNING("Estimation of track parameters for seed " << iseed
                                                               << " failed.");
       continue;
-    } else {
-      const auto& params = optParams.value();
-      double charge = std::copysign(1, params[Acts::eBoundQOverP]);
-      trackParameters.emplace_back(surface->getSharedPtr(), params, charge,
-                                   m_covariance);
-      // Create a proto track for this seed
-      ProtoTrack track;
-      track.reserve(3);
-      for (const auto& sp : seed.sp()) {
-        track.push_back(sp->measurementIndex());
-      }
-      tracks.emplace_back(track);
     }
+    const auto& params = estimatedParams[i];
+    double charge = std::copysign(1, params[Acts::eBoundQOverP]);
+    trackParameters.emplace_back(batch.surfaces[i]->getSharedPtr(), params,
+                                 charge, m_covariance);
+    // Create a proto track for this seed
+    ProtoTrack track;
+    track.reserve(3);
+    for (const auto& sp : seeds[iseed].sp()) {
+      track.push_back(sp->measurementIndex());
+    }
+    tracks.emplace_back(track);
   }
 
   ctx.eventStore.add(m_cfg.outputTrackParameters, std::move(trackParameters));
@@ -38,6 +38,12 @@ ActsExamples::TrackFittingAlgorithm::TrackFittingAlgorithm(
   if (m_cfg.outputTrajectories.empty()) {
     throw std::invalid_argument("Missing output trajectories collection");
   }
+
+  declareInput(m_cfg.inputMeasurements);
+  declareInput(m_cfg.inputSourceLinks);
+  declareInput(m_cfg.inputProtoTracks);
+  declareInput(m_cfg.inputInitialTrackParameters);
+  declareOutput(m_cfg.outputTrajectories);
 }
 
 ActsExamples::ProcessCode ActsExamples::TrackFittingAlgorithm::execute(
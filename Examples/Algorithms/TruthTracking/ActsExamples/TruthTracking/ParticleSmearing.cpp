@@ -27,18 +27,20 @@ ActsExamples::ParticleSmearing::ParticleSmearing(const Config& cfg,
   if (m_cfg.outputTrackParameters.empty()) {
     throw std::invalid_argument("Missing output tracks parameters collection");
   }
+
+  declareInput(m_inputParticles, m_cfg.inputParticles);
+  declareOutput(m_outputTrackParameters, m_cfg.outputTrackParameters);
 }
 
 ActsExamples::ProcessCode ActsExamples::ParticleSmearing::execute(
     const AlgorithmContext& ctx) const {
   // setup input and output containers
   const auto& particles =
-      ctx.eventStore.get<SimParticleContainer>(m_cfg.inputParticles);
+      m_inputParticles(ctx.eventStore);
   TrackParametersContainer parameters;
   parameters.reserve(particles.size());
 
-  // setup random number generator and standard gaussian
-  auto rng = m_cfg.randomNumbers->spawnGenerator(ctx);
+  // standard gaussian, the generators are spawned for each particle
   std::normal_distribution<double> stdNormal(0.0, 1.0);
 
   for (auto&& [vtxId, vtxParticles] : groupBySecondaryVertex(particles)) {
@@ -49,6 +51,11 @@ ActsExamples::ProcessCode ActsExamples::ParticleSmearing::execute(
         vtxParticles.begin()->position());
 
     for (const auto& particle : vtxParticles) {
+      // smearing of a particle does not depend on the other particles
+      auto rng = m_cfg.randomNumbers->spawnGenerator(
+          ctx, particle.particleId().value());
+      stdNormal.reset();
+
       const auto time = particle.time();
       const auto phi = Acts::VectorHelpers::phi(particle.unitDirection());
       const auto theta = Acts::VectorHelpers::theta(particle.unitDirection());
@@ -106,6 +113,6 @@ ActsExamples::ProcessCode ActsExamples::ParticleSmearing::execute(
     }
   }
 
-  ctx.eventStore.add(m_cfg.outputTrackParameters, std::move(parameters));
+  m_outputTrackParameters(ctx.eventStore, std::move(parameters));
   return ProcessCode::SUCCESS;
 }
@@ -9,6 +9,8 @@
 #pragma once
 
 #include "Acts/Definitions/Units.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/EventData/Track.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
 #include "ActsExamples/Framework/RandomNumbers.hpp"
 
@@ -61,6 +63,9 @@ class ParticleSmearing final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+
+  ReadDataHandle<SimParticleContainer> m_inputParticles;
+  WriteDataHandle<TrackParametersContainer> m_outputTrackParameters;
 };
 
 }  // namespace ActsExamples
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "ActsExamples/EventData/ProtoVertex.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
 
 #include <string>
@@ -34,6 +36,9 @@ class TruthVertexFinder final : public BareAlgorithm {
 
  private:
   Config m_cfg;
+
+  ReadDataHandle<SimParticleContainer> m_inputParticles;
+  WriteDataHandle<ProtoVertexContainer> m_outputProtoVertices;
 };
 
 }  // namespace ActsExamples
@@ -50,6 +50,11 @@ ActsExamples::AdaptiveMultiVertexFinderAlgorithm::
   if (m_cfg.outputTime.empty()) {
     throw std::invalid_argument("Missing output reconstruction time");
   }
+
+  declareInput(m_cfg.inputTrackParameters);
+  declareOutput(m_cfg.outputProtoVertices);
+  declareOutput(m_cfg.outputVertices);
+  declareOutput(m_cfg.outputTime);
 }
 
 ActsExamples::ProcessCode
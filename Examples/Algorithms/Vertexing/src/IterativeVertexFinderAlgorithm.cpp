@@ -51,6 +51,11 @@ ActsExamples::IterativeVertexFinderAlgorithm::IterativeVertexFinderAlgorithm(
   if (m_cfg.outputTime.empty()) {
     throw std::invalid_argument("Missing output reconstruction time");
   }
+
+  declareInput(m_cfg.inputTrackParameters);
+  declareOutput(m_cfg.outputProtoVertices);
+  declareOutput(m_cfg.outputVertices);
+  declareOutput(m_cfg.outputTime);
 }
 
 ActsExamples::ProcessCode ActsExamples::IterativeVertexFinderAlgorithm::execute(
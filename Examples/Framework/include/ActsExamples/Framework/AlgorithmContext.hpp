@@ -8,11 +8,13 @@
 
 #pragma once
 
+#include "ActsExamples/Framework/AlgorithmState.hpp"
 #include <Acts/Geometry/GeometryContext.hpp>
 #include <Acts/MagneticField/MagneticFieldContext.hpp>
 #include <Acts/Utilities/CalibrationContext.hpp>
 
 #include <memory>
+#include <stdexcept>
 
 namespace ActsExamples {
 
@@ -37,6 +39,18 @@ struct AlgorithmContext {
     return (*this);
   }
 
+  /// @brief Access the state the algorithm keeps on the current worker
+  ///
+  /// @tparam T default-constructible type of the state
+  /// @throws std::logic_error if the algorithm was not given a state
+  template <typename T>
+  T& localState() const {
+    if (algorithmState == nullptr) {
+      throw std::logic_error("No algorithm state available");
+    }
+    return algorithmState->get<T>();
+  }
+
   size_t algorithmNumber;            ///< Unique algorithm identifier
   size_t eventNumber;                ///< Unique event identifier
   WhiteBoard& eventStore;            ///< Per-event data store
@@ -44,6 +58,8 @@ struct AlgorithmContext {
   Acts::MagneticFieldContext
       magFieldContext;                    ///< Per-event magnetic Field context
   Acts::CalibrationContext calibContext;  ///< Per-event calbiration context
+  /// Worker-local state of the executed algorithm, set by the sequencer
+  AlgorithmState* algorithmState = nullptr;
 };
 
 }  // namespace ActsExamples
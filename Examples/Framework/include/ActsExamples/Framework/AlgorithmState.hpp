@@ -0,0 +1,108 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <memory>
+#include <stdexcept>
+#include <typeinfo>
+#include <vector>
+
+#include <tbb/enumerable_thread_specific.h>
+
+namespace ActsExamples {
+
+/// Mutable state of one algorithm that is kept across events.
+///
+/// The sequencer keeps one state per algorithm and worker thread and hands it
+/// to the algorithm through the `AlgorithmContext`. It is never used by two
+/// executions at the same time, such that an algorithm can use it without
+/// synchronization, e.g. to keep scratch buffers or caches allocated for the
+/// whole run. The stored object must not contain any event data since the
+/// next event processed by the same worker is arbitrary.
+class AlgorithmState {
+ public:
+  AlgorithmState() = default;
+  AlgorithmState(const AlgorithmState&) = delete;
+  AlgorithmState(AlgorithmState&&) = default;
+  AlgorithmState& operator=(const AlgorithmState&) = delete;
+  AlgorithmState& operator=(AlgorithmState&&) = default;
+
+  /// Get the stored object, default-constructed on first use.
+  ///
+  /// @throws std::logic_error if an object of a different type is stored
+  template <typename T>
+  T& get() {
+    if (not m_object) {
+      m_object = Object(new T(), [](void* object) {
+        delete static_cast<T*>(object);
+      });
+      m_type = &typeid(T);
+    }
+    if (*m_type != typeid(T)) {
+      throw std::logic_error("Algorithm state has a different type");
+    }
+    return *static_cast<T*>(m_object.get());
+  }
+
+ private:
+  using Object = std::unique_ptr<void, void (*)(void*)>;
+
+  Object m_object = Object(nullptr, [](void*) {});
+  const std::type_info* m_type = nullptr;
+};
+
+/// Algorithm states of all worker threads, kept for the whole run.
+class WorkerStates {
+  struct Slot {
+    AlgorithmState state;
+    bool inUse = false;
+  };
+
+ public:
+  /// Exclusive use of one algorithm state while the algorithm is executed.
+  class Lease {
+   public:
+    Lease(WorkerStates& states, size_t algorithm) {
+      auto& slot = states.m_slots.local()[algorithm];
+      if (slot.inUse) {
+        // the worker started another event while waiting inside the same
+        // algorithm, e.g. for a nested parallel loop. the state is in use and
+        // a temporary one is provided instead.
+        m_temporary = std::make_unique<AlgorithmState>();
+        m_state = m_temporary.get();
+        return;
+      }
+      slot.inUse = true;
+      m_slot = &slot;
+      m_state = &slot.state;
+    }
+    Lease(const Lease&) = delete;
+    Lease& operator=(const Lease&) = delete;
+    ~Lease() {
+      if (m_slot != nullptr) {
+        m_slot->inUse = false;
+      }
+    }
+
+    AlgorithmState* get() const { return m_state; }
+
+   private:
+    Slot* m_slot = nullptr;
+    std::unique_ptr<AlgorithmState> m_temporary;
+    AlgorithmState* m_state = nullptr;
+  };
+
+  WorkerStates(size_t numAlgorithms)
+      : m_slots([=]() { return std::vector<Slot>(numAlgorithms); }) {}
+
+ private:
+  tbb::enumerable_thread_specific<std::vector<Slot>> m_slots;
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,99 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsExamples/Framework/IWriter.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include <Acts/Utilities/Logger.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <tbb/concurrent_queue.h>
+
+namespace ActsExamples {
+
+/// Run a writer on a dedicated I/O thread, decoupled from the event loop.
+///
+/// Calling `write` only shares the event data with the queue of pending
+/// events, without copying it, and returns immediately. The wrapped writer
+/// is then run for each queued event, in the order they were queued, by the
+/// I/O thread. Since the wrapped writer is only ever called from that
+/// thread, its internal locking is uncontended.
+///
+/// The number of queued events is bounded. Once the limit is reached,
+/// `write` blocks until the I/O thread has caught up, which also limits the
+/// memory held by the queued event data.
+class AsyncWriter final : public IWriter {
+ public:
+  struct Config {
+    /// The writer to run on the I/O thread.
+    std::shared_ptr<IWriter> writer;
+    /// Maximum number of events waiting to be written.
+    size_t maxQueuedEvents = 8;
+  };
+
+  /// Construct the writer and start the I/O thread.
+  ///
+  /// @throws std::invalid_argument on missing writer or zero queue size
+  AsyncWriter(const Config& cfg, Acts::Logging::Level level);
+  /// Write the remaining queued events if `endRun` was not called.
+  ~AsyncWriter() override;
+
+  /// The name of the wrapped writer.
+  std::string name() const final override;
+
+  /// Queue the event for writing.
+  ///
+  /// @returns ProcessCode::ABORT if writing a previous event failed
+  ProcessCode write(const AlgorithmContext& context) final override;
+
+  /// Write all queued events and end the run of the wrapped writer.
+  ProcessCode endRun() final override;
+
+  /// The white board objects read by the wrapped writer.
+  std::optional<DataDependencies> dataDependencies() const final override;
+
+ private:
+  // an event waiting to be written
+  struct Job {
+    std::unique_ptr<WhiteBoard> store;
+    AlgorithmContext context;
+
+    Job(const AlgorithmContext& ctx, std::unique_ptr<WhiteBoard> s);
+  };
+
+  /// Write queued events until the end-of-queue marker is found.
+  void run();
+  /// Queue the end-of-queue marker and wait for the I/O thread.
+  void stop();
+  /// Take an empty store, reusing a previously released one if possible.
+  std::unique_ptr<WhiteBoard> acquireStore();
+  /// Clear the store and keep it for reuse.
+  void releaseStore(std::unique_ptr<WhiteBoard> store);
+
+  Config m_cfg;
+  std::unique_ptr<const Acts::Logger> m_logger;
+  // nullptr marks the end of the queue
+  tbb::concurrent_bounded_queue<Job*> m_queue;
+  std::atomic<bool> m_failed = false;
+  // empty stores for reuse, such that they are not created for every event
+  std::mutex m_storesMutex;
+  std::vector<std::unique_ptr<WhiteBoard>> m_stores;
+  std::thread m_thread;
+
+  const Acts::Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace ActsExamples
@@ -14,11 +14,13 @@
 
 #pragma once
 
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/IAlgorithm.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 #include <Acts/Utilities/Logger.hpp>
 
 #include <memory>
+#include <optional>
 #include <string>
 
 namespace ActsExamples {
@@ -46,12 +48,37 @@ class BareAlgorithm : public IAlgorithm {
   virtual ProcessCode execute(
       const AlgorithmContext& context) const override = 0;
 
+  /// The declared white board inputs and outputs, if any.
+  std::optional<DataDependencies> dataDependencies() const override;
+
  protected:
   const Acts::Logger& logger() const { return *m_logger; }
 
+  /// Declare that the algorithm reads an object from the white board.
+  ///
+  /// Subclasses should declare all their inputs and outputs in the
+  /// constructor, such that the sequencer can schedule them concurrently.
+  void declareInput(std::string name);
+  /// Declare that the algorithm adds an object to the white board.
+  void declareOutput(std::string name);
+
+  /// Configure a handle to read an object and declare it as input.
+  template <typename T>
+  void declareInput(ReadDataHandle<T>& handle, const std::string& name) {
+    declareInput(name);
+    handle.initialize(name);
+  }
+  /// Configure a handle to add an object and declare it as output.
+  template <typename T>
+  void declareOutput(WriteDataHandle<T>& handle, const std::string& name) {
+    declareOutput(name);
+    handle.initialize(name);
+  }
+
  private:
   std::string m_name;
   std::unique_ptr<const Acts::Logger> m_logger;
+  std::optional<DataDependencies> m_dataDependencies;
 };
 
 }  // namespace ActsExamples
@@ -0,0 +1,27 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace ActsExamples {
+
+/// Names of the white board objects accessed by a reader, algorithm or writer.
+///
+/// The sequencer uses them to validate the configured sequence and to run
+/// independent algorithms of the same event concurrently.
+struct DataDependencies {
+  /// Objects that are read and must have been added before
+  std::vector<std::string> inputs;
+  /// Objects that are added to the white board
+  std::vector<std::string> outputs;
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,88 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace ActsExamples {
+
+/// Typed read access to one white board object.
+///
+/// The handle is configured once with the object name, which assigns it the
+/// white board slot of that name. Reading the object is then an array access.
+template <typename T>
+class ReadDataHandle {
+ public:
+  /// Assign the object name; must be called before the handle is used.
+  ///
+  /// @throws std::invalid_argument on empty name
+  void initialize(const std::string& key) {
+    m_slot = WhiteBoard::registerSlot(key);
+    m_key = key;
+  }
+
+  /// Whether the handle has been configured with an object name.
+  bool isInitialized() const { return m_slot != SIZE_MAX; }
+
+  /// The configured object name.
+  const std::string& key() const { return m_key; }
+
+  /// Get access to the object of the current event.
+  ///
+  /// @throws std::out_of_range if the object does not exist or has a
+  ///         different type
+  const T& operator()(const WhiteBoard& store) const {
+    return store.getFromSlot<T>(m_slot, m_key);
+  }
+
+ private:
+  std::string m_key;
+  size_t m_slot = SIZE_MAX;
+};
+
+/// Typed write access to one white board object.
+///
+/// @see ReadDataHandle
+template <typename T>
+class WriteDataHandle {
+ public:
+  /// Assign the object name; must be called before the handle is used.
+  ///
+  /// @throws std::invalid_argument on empty name
+  void initialize(const std::string& key) {
+    m_slot = WhiteBoard::registerSlot(key);
+    m_key = key;
+  }
+
+  /// Whether the handle has been configured with an object name.
+  bool isInitialized() const { return m_slot != SIZE_MAX; }
+
+  /// The configured object name.
+  const std::string& key() const { return m_key; }
+
+  /// Store the object for the current event and transfer ownership.
+  ///
+  /// @throws std::invalid_argument if the object already exists
+  void operator()(WhiteBoard& store, T&& object) const {
+    if (not isInitialized()) {
+      throw std::invalid_argument("Data handle has not been initialized");
+    }
+    store.addToSlot(m_slot, m_key, std::move(object));
+  }
+
+ private:
+  std::string m_key;
+  size_t m_slot = SIZE_MAX;
+};
+
+}  // namespace ActsExamples
@@ -9,8 +9,10 @@
 #pragma once
 
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/DataDependencies.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 
+#include <optional>
 #include <string>
 
 namespace ActsExamples {
@@ -28,6 +30,14 @@ class IAlgorithm {
 
   /// Execute the algorithm for one event.
   virtual ProcessCode execute(const AlgorithmContext& context) const = 0;
+
+  /// The white board objects read and written by the algorithm.
+  ///
+  /// Algorithms that do not declare them are never run concurrently with
+  /// other algorithms of the same event.
+  virtual std::optional<DataDependencies> dataDependencies() const {
+    return std::nullopt;
+  }
 };
 
 }  // namespace ActsExamples
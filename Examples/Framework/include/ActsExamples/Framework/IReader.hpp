@@ -9,8 +9,10 @@
 #pragma once
 
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/DataDependencies.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -39,6 +41,13 @@ class IReader {
   /// will most likely not be called in order. Implementations must use the
   /// event number provided to select the proper data to be read.
   virtual ProcessCode read(const AlgorithmContext& context) = 0;
+
+  /// The white board objects added by the reader.
+  ///
+  /// Only used to validate the inputs of the following algorithms.
+  virtual std::optional<DataDependencies> dataDependencies() const {
+    return std::nullopt;
+  }
 };
 
 }  // namespace ActsExamples
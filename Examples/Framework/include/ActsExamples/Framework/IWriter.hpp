@@ -13,8 +13,10 @@
 #pragma once
 
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/DataDependencies.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
 
+#include <optional>
 #include <string>
 
 namespace ActsExamples {
@@ -36,6 +38,15 @@ class IWriter {
 
   /// End the run (e.g. aggregate statistics, write down output, close files).
   virtual ProcessCode endRun() = 0;
+
+  /// The white board objects read by the writer.
+  ///
+  /// Writers that do not declare them are run after all algorithms.
+  /// The declared inputs must be complete since algorithms whose outputs are
+  /// not read by any element can be skipped.
+  virtual std::optional<DataDependencies> dataDependencies() const {
+    return std::nullopt;
+  }
 };
 
 }  // namespace ActsExamples
@@ -0,0 +1,119 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace ActsExamples {
+
+/// Counter-based random number engine using the Philox4x32-10 function.
+///
+/// Each output block is computed from a key and a counter alone, see
+/// Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC 2011.
+/// The counter consists of the block index and a fixed stream identifier.
+/// Different streams are statistically independent, such that the numbers
+/// drawn for one stream do not depend on the use of any other stream.
+/// Construction only stores the key and the stream and is therefore cheap
+/// compared to seeding a state-based engine.
+///
+/// The engine satisfies the uniform random bit generator requirements and can
+/// be used with all standard distributions. Each stream provides 2^33 values
+/// before it repeats.
+class PhiloxEngine {
+ public:
+  using result_type = uint64_t;
+
+  /// @param key Selects the family of streams, e.g. derived from a seed
+  /// @param stream Identifies the stream within the family
+  /// @param subStream Further identifies the stream within the family
+  explicit PhiloxEngine(uint64_t key = 0u, uint64_t stream = 0u,
+                        uint32_t subStream = 0u)
+      : m_key{static_cast<uint32_t>(key), static_cast<uint32_t>(key >> 32)},
+        m_counter{0u, subStream, static_cast<uint32_t>(stream),
+                  static_cast<uint32_t>(stream >> 32)} {}
+
+  static constexpr result_type min() { return 0u; }
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  /// Generate the next value of the stream.
+  result_type operator()() {
+    if (m_next == m_block.size()) {
+      m_block = generateBlock(m_key, m_counter);
+      ++m_counter[0];
+      m_next = 0u;
+    }
+    return m_block[m_next++];
+  }
+
+  /// Skip the next values without generating them.
+  void discard(unsigned long long n) {
+    // values left in the current block
+    unsigned long long available = m_block.size() - m_next;
+    if (n <= available) {
+      m_next += n;
+      return;
+    }
+    n -= available;
+    m_counter[0] += static_cast<uint32_t>(n / m_block.size());
+    m_next = m_block.size();
+    if ((n % m_block.size()) != 0u) {
+      (*this)();
+      m_next = n % m_block.size();
+    }
+  }
+
+  /// The raw Philox4x32-10 output block for a key and a counter.
+  static std::array<uint32_t, 4> philox(std::array<uint32_t, 2> key,
+                                        std::array<uint32_t, 4> counter) {
+    for (unsigned round = 0; round < 10; ++round) {
+      const uint64_t product0 = uint64_t(0xD2511F53u) * counter[0];
+      const uint64_t product1 = uint64_t(0xCD9E8D57u) * counter[2];
+      counter = {static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+                 static_cast<uint32_t>(product1),
+                 static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+                 static_cast<uint32_t>(product0)};
+      key[0] += 0x9E3779B9u;
+      key[1] += 0xBB67AE85u;
+    }
+    return counter;
+  }
+
+  friend bool operator==(const PhiloxEngine& lhs, const PhiloxEngine& rhs) {
+    // the block is fully determined by the key and the counter
+    return (lhs.m_key == rhs.m_key) and (lhs.m_counter == rhs.m_counter) and
+           (lhs.m_next == rhs.m_next);
+  }
+  friend bool operator!=(const PhiloxEngine& lhs, const PhiloxEngine& rhs) {
+    return not(lhs == rhs);
+  }
+
+ private:
+  using Block = std::array<result_type, 2>;
+
+  static Block generateBlock(const std::array<uint32_t, 2>& key,
+                             const std::array<uint32_t, 4>& counter) {
+    auto words = philox(key, counter);
+    return {words[0] | (static_cast<result_type>(words[1]) << 32),
+            words[2] | (static_cast<result_type>(words[3]) << 32)};
+  }
+
+  std::array<uint32_t, 2> m_key;
+  // block index followed by the stream identifier
+  std::array<uint32_t, 4> m_counter;
+  Block m_block = {};
+  // position of the next value in the block, generate a new one if at end
+  size_t m_next = 2u;
+};
+
+}  // namespace ActsExamples
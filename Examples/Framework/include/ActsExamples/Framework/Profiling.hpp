@@ -0,0 +1,57 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace ActsExamples {
+
+/// Number and total size of memory allocations.
+struct AllocationCount {
+  uint64_t allocations = 0;
+  uint64_t bytes = 0;
+};
+
+/// Record a memory allocation of the calling thread.
+///
+/// This is called for every allocation by the allocation hook, i.e. the
+/// replacement of the global `operator new` in the
+/// `ActsExamplesFrameworkAllocationHook` library. Linking that library into
+/// an executable enables the allocation counts in the sequencer. The example
+/// executables link it if `ACTS_EXAMPLES_ALLOCATION_HOOK` is enabled.
+void recordAllocation(size_t bytes) noexcept;
+
+/// Allocations recorded for the calling thread so far.
+AllocationCount threadAllocations() noexcept;
+
+/// Whether any allocation has been recorded, i.e. the hook is in use.
+bool allocationsRecorded() noexcept;
+
+/// Peak resident set size of the process in kilobytes, zero if unknown.
+size_t peakResidentSetSize();
+
+/// Hardware performance counters of one thread.
+struct HardwareCounters {
+  uint64_t cycles = 0;
+  uint64_t instructions = 0;
+  uint64_t cacheMisses = 0;
+};
+
+/// Read the hardware performance counters of the calling thread.
+///
+/// The counters are set up on first use in each thread and only count in
+/// user space. This uses `perf_event_open` and is only available on Linux
+/// if the kernel permits it, see `/proc/sys/kernel/perf_event_paranoid`.
+///
+/// @return the counter values or nothing if they are not available
+std::optional<HardwareCounters> readThreadHardwareCounters();
+
+}  // namespace ActsExamples
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/PhiloxEngine.hpp"
 
 #include <cstdint>
 #include <random>
@@ -24,7 +25,7 @@
 namespace ActsExamples {
 
 /// The random number generator used in the framework.
-using RandomEngine = std::mt19937;  ///< Mersenne Twister
+using RandomEngine = PhiloxEngine;  ///< Counter-based Philox4x32-10
 
 /// Provide event and algorithm specific random number generator.s
 ///
@@ -32,6 +33,12 @@ using RandomEngine = std::mt19937;  ///< Mersenne Twister
 /// thread-safe, lock-free, and reproducible random number generation across
 /// single-threaded and multi-threaded test framework runs.
 ///
+/// The generators are counter-based and identified by the seed, the event,
+/// and the algorithm, and optionally by an additional key, e.g. a particle
+/// barcode. Generators for different keys are independent, such that work
+/// within an event can be split and reordered without changing the results.
+/// Spawning a generator is cheap and can be done for each item.
+///
 /// The role of the RandomNumbers is only to spawn local random number
 /// generators. It does not, in and of itself, accomodate requests for specific
 /// random number distributions (uniform, gaussian, etc). For this purpose,
@@ -54,6 +61,16 @@ class RandomNumbers {
   /// @param context is the AlgorithmContext of the host algorithm
   RandomEngine spawnGenerator(const AlgorithmContext& context) const;
 
+  /// Spawn an algorithm-local random number generator for a single item.
+  ///
+  /// The numbers only depend on the key and not on the order in which the
+  /// items are processed or on the generators used for other items.
+  ///
+  /// @param context is the AlgorithmContext of the host algorithm
+  /// @param key identifies the item within the event, e.g. a particle barcode
+  RandomEngine spawnGenerator(const AlgorithmContext& context,
+                              uint64_t key) const;
+
   /// Generate a event and algorithm specific seed value.
   ///
   /// This should only be used in special cases e.g. where a custom
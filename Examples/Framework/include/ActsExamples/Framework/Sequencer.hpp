@@ -44,6 +44,15 @@ class Sequencer {
     int numThreads = -1;
     /// output directory for timing information, empty for working directory
     std::string outputDir;
+    /// run the algorithms and writers of one event concurrently, as far as
+    /// their declared data dependencies allow
+    bool dataFlowScheduling = false;
+    /// maximum number of events processed at the same time, zero to disable.
+    /// If set, events are processed in a pipeline: readers and writers see
+    /// the events one at a time and in order, algorithms run in parallel.
+    size_t eventsInFlight = 0;
+    /// read the hardware performance counters around each algorithm
+    bool hardwareCounters = false;
   };
 
   Sequencer(const Config& cfg);
@@ -95,6 +104,35 @@ class Sequencer {
   /// This will run the start-of-run hook for all configured services, run all
   /// configured readers, algorithms, and writers for each event, then invoke
   /// the end-of-run hook for all configured writers.
+  ///
+  /// Before any event is processed, the declared data dependencies are
+  /// checked and the run fails if an input is not added by any preceding
+  /// reader or algorithm. With data flow scheduling, the algorithms and
+  /// writers of each event are run as a dependency graph; elements without
+  /// declared dependencies keep their position in the sequence.
+  ///
+  /// Algorithms whose outputs are all added by a reader, e.g. when replaying
+  /// a checkpoint, are not run, together with the algorithms that only
+  /// provide their inputs. This requires that the skipped algorithms and all
+  /// following elements declare their data dependencies.
+  ///
+  /// Each worker thread keeps a state for every algorithm for the whole run,
+  /// which the algorithms access through `AlgorithmContext::localState`.
+  ///
+  /// With a limited number of events in flight, reading, processing and
+  /// writing are separate pipeline stages. A new event is only read once a
+  /// previous one has been written, which bounds the memory and lets slow
+  /// writers hold back the readers instead of blocking worker threads.
+  ///
+  /// Besides the total time per algorithm in `timing.tsv`, the distribution
+  /// of the per-event times and the resources used by each algorithm are
+  /// written to `profile.tsv` in the output directory. Allocations are only
+  /// counted if the allocation hook is linked into the executable. The
+  /// `Event` row has the wall-clock time from reading to writing each event
+  /// and the summed resources of all elements. Allocations and hardware
+  /// counters are measured on the thread running an element; work that it
+  /// hands to other threads is missed, and work of other elements that the
+  /// thread runs while waiting, e.g. in a nested parallel loop, is included.
   int run();
 
  private:
@@ -102,6 +140,15 @@ class Sequencer {
   std::vector<std::string> listAlgorithmNames() const;
   /// Determine range of (requested) events; [SIZE_MAX, SIZE_MAX) for error.
   std::pair<size_t, size_t> determineEventsRange() const;
+  /// Remove the algorithms whose outputs are replaced by reader outputs.
+  ///
+  /// Nothing is removed unless all writers declare their inputs.
+  void skipReplacedAlgorithms();
+  /// Check that all declared inputs are added by preceding elements.
+  bool checkDataDependencies() const;
+  /// Preceding algorithms that must have finished before an algorithm or a
+  /// writer can be run. Algorithms come first, followed by the writers.
+  std::vector<std::vector<size_t>> determineDependencies() const;
 
   Config m_cfg;
   tbb::task_arena m_taskArena;
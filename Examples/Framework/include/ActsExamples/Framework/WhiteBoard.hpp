@@ -10,22 +10,38 @@
 
 #include <Acts/Utilities/Logger.hpp>
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <typeinfo>
-#include <unordered_map>
 #include <vector>
 
 namespace ActsExamples {
 
+template <typename T>
+class ReadDataHandle;
+template <typename T>
+class WriteDataHandle;
+
 /// A container to store arbitrary objects with ownership transfer.
 ///
 /// This is an append-only container that takes ownership of the objects
 /// added to it. Once an object has been added, it can only be read but not
 /// be modified. Trying to replace an existing object is considered an error.
-/// Its lifetime is bound to the liftime of the white board.
+/// Its lifetime is bound to the liftime of the white board or until it is
+/// cleared. Objects can be added and read concurrently, e.g. by algorithms of
+/// the same event that are run in parallel.
+///
+/// Every object name is assigned a fixed slot for the whole process. Data
+/// handles resolve their slot once when they are configured and access the
+/// objects without any string lookup.
+///
+/// Since stored objects are immutable, they can be shared with another white
+/// board to keep them alive beyond the event, e.g. for deferred writing.
 class WhiteBoard {
  public:
   WhiteBoard(std::unique_ptr<const Acts::Logger> logger =
@@ -51,6 +67,25 @@ class WhiteBoard {
   template <typename T>
   const T& get(const std::string& name) const;
 
+  /// Remove all stored objects, e.g. to reuse the white board for the next
+  /// event. The memory for the slots is kept.
+  void clear();
+
+  /// Replace the logger, e.g. to name the event the white board is reused for.
+  void setLogger(std::unique_ptr<const Acts::Logger> logger);
+
+  /// Share all stored objects with another white board without copying.
+  ///
+  /// The objects stay alive until both white boards are cleared or deleted.
+  ///
+  /// @throws std::invalid_argument if an object already exists in the other
+  void shareWith(WhiteBoard& other) const;
+
+  /// Get the slot assigned to an object name, assigning a new one if needed.
+  ///
+  /// @throws std::invalid_argument on empty name
+  static size_t registerSlot(const std::string& name);
+
  private:
   // type-erased value holder for move-constructible types
   struct IHolder {
@@ -67,8 +102,28 @@ class WhiteBoard {
     const std::type_info& type() const { return typeid(T); }
   };
 
+  template <typename T>
+  friend class ReadDataHandle;
+  template <typename T>
+  friend class WriteDataHandle;
+
+  /// Slot of an already registered name, SIZE_MAX if there is none.
+  ///
+  /// Repeated lookups with the same string object, e.g. a configured
+  /// collection name, are served from a per-thread cache without locking.
+  static size_t findSlot(const std::string& name);
+  /// Number of slots assigned so far.
+  static size_t numSlots();
+
+  template <typename T>
+  void addToSlot(size_t slot, const std::string& name, T&& object);
+  template <typename T>
+  const T& getFromSlot(size_t slot, const std::string& name) const;
+
   std::unique_ptr<const Acts::Logger> m_logger;
-  std::unordered_map<std::string, std::unique_ptr<IHolder>> m_store;
+  std::vector<std::shared_ptr<const IHolder>> m_slots;
+  // only needed to grow the slots for names registered during an event
+  mutable std::shared_mutex m_slotsMutex;
 
   const Acts::Logger& logger() const { return *m_logger; }
 };
@@ -77,27 +132,94 @@ class WhiteBoard {
 
 inline ActsExamples::WhiteBoard::WhiteBoard(
     std::unique_ptr<const Acts::Logger> logger)
-    : m_logger(std::move(logger)) {}
+    : m_logger(std::move(logger)), m_slots(numSlots()) {}
+
+inline void ActsExamples::WhiteBoard::clear() {
+  std::unique_lock lock(m_slotsMutex);
+  for (auto& slot : m_slots) {
+    slot.reset();
+  }
+  m_slots.resize(std::max(m_slots.size(), numSlots()));
+}
+
+inline void ActsExamples::WhiteBoard::setLogger(
+    std::unique_ptr<const Acts::Logger> logger) {
+  m_logger = std::move(logger);
+}
+
+inline void ActsExamples::WhiteBoard::shareWith(WhiteBoard& other) const {
+  if (&other == this) {
+    throw std::invalid_argument("Objects can not be shared with themselves");
+  }
+  std::shared_lock lock(m_slotsMutex);
+  std::unique_lock otherLock(other.m_slotsMutex);
+  other.m_slots.resize(std::max(other.m_slots.size(), m_slots.size()));
+  for (size_t slot = 0; slot < m_slots.size(); ++slot) {
+    if (not m_slots[slot]) {
+      continue;
+    }
+    if (other.m_slots[slot]) {
+      throw std::invalid_argument("Object in slot " + std::to_string(slot) +
+                                  " already exists");
+    }
+    other.m_slots[slot] = m_slots[slot];
+  }
+}
 
 template <typename T>
 inline void ActsExamples::WhiteBoard::add(const std::string& name, T&& object) {
   if (name.empty()) {
     throw std::invalid_argument("Object can not have an empty name");
   }
-  if (0 < m_store.count(name)) {
-    throw std::invalid_argument("Object '" + name + "' already exists");
+  addToSlot(registerSlot(name), name, std::forward<T>(object));
+}
+
+template <typename T>
+inline const T& ActsExamples::WhiteBoard::get(const std::string& name) const {
+  return getFromSlot<T>(findSlot(name), name);
+}
+
+template <typename T>
+inline void ActsExamples::WhiteBoard::addToSlot(size_t slot,
+                                                const std::string& name,
+                                                T&& object) {
+  auto holder = std::make_unique<HolderT<T>>(std::forward<T>(object));
+  {
+    std::shared_lock lock(m_slotsMutex);
+    // slots are distinct for different objects and can be set concurrently
+    if (slot < m_slots.size()) {
+      if (m_slots[slot]) {
+        throw std::invalid_argument("Object '" + name + "' already exists");
+      }
+      m_slots[slot] = std::move(holder);
+    }
+  }
+  if (holder) {
+    // the name was registered after the white board was set up
+    std::unique_lock lock(m_slotsMutex);
+    m_slots.resize(std::max(m_slots.size(), slot + 1));
+    if (m_slots[slot]) {
+      throw std::invalid_argument("Object '" + name + "' already exists");
+    }
+    m_slots[slot] = std::move(holder);
   }
-  m_store.emplace(name, std::make_unique<HolderT<T>>(std::forward<T>(object)));
   ACTS_VERBOSE("Added object '" << name << "'");
 }
 
 template <typename T>
-inline const T& ActsExamples::WhiteBoard::get(const std::string& name) const {
-  auto it = m_store.find(name);
-  if (it == m_store.end()) {
+inline const T& ActsExamples::WhiteBoard::getFromSlot(
+    size_t slot, const std::string& name) const {
+  const IHolder* holder = nullptr;
+  {
+    std::shared_lock lock(m_slotsMutex);
+    if (slot < m_slots.size()) {
+      // the holder is never removed or replaced while the event is processed
+      holder = m_slots[slot].get();
+    }
+  }
+  if (holder == nullptr) {
     throw std::out_of_range("Object '" + name + "' does not exists");
   }
-  const IHolder* holder = it->second.get();
   if (typeid(T) != holder->type()) {
     throw std::out_of_range("Type missmatch for object '" + name + "'");
   }
@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include "ActsExamples/Framework/DataHandle.hpp"
 #include "ActsExamples/Framework/IWriter.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 #include <Acts/Utilities/Logger.hpp>
@@ -60,6 +61,12 @@ class WriterT : public IWriter {
   /// No-op default implementation.
   ProcessCode endRun() override;
 
+  /// No declared dependencies, i.e. the writer runs after all algorithms.
+  ///
+  /// Most writers read further objects besides the main one. A subclass
+  /// should only override this if it lists every object it reads.
+  std::optional<DataDependencies> dataDependencies() const override;
+
  protected:
   /// Type-specific write function implementation
   /// this method is implemented in the user implementation
@@ -73,6 +80,7 @@ class WriterT : public IWriter {
 
  private:
   std::string m_objectName;
+  ReadDataHandle<write_data_t> m_inputHandle;
   std::string m_writerName;
   std::unique_ptr<const Acts::Logger> m_logger;
 };
@@ -91,6 +99,7 @@ ActsExamples::WriterT<write_data_t>::WriterT(std::string objectName,
   } else if (m_writerName.empty()) {
     throw std::invalid_argument("Missing writer name");
   }
+  m_inputHandle.initialize(m_objectName);
 }
 
 template <typename write_data_t>
@@ -103,8 +112,14 @@ inline ActsExamples::ProcessCode ActsExamples::WriterT<write_data_t>::endRun() {
   return ProcessCode::SUCCESS;
 }
 
+template <typename write_data_t>
+inline std::optional<ActsExamples::DataDependencies>
+ActsExamples::WriterT<write_data_t>::dataDependencies() const {
+  return std::nullopt;
+}
+
 template <typename write_data_t>
 inline ActsExamples::ProcessCode ActsExamples::WriterT<write_data_t>::write(
     const AlgorithmContext& context) {
-  return writeT(context, context.eventStore.get<write_data_t>(m_objectName));
+  return writeT(context, m_inputHandle(context.eventStore));
 }
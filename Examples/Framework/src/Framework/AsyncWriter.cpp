@@ -0,0 +1,126 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Framework/AsyncWriter.hpp"
+
+#include <exception>
+#include <stdexcept>
+
+ActsExamples::AsyncWriter::Job::Job(const AlgorithmContext& ctx,
+                                    std::unique_ptr<WhiteBoard> s)
+    : store(std::move(s)), context(ctx.algorithmNumber, ctx.eventNumber,
+                                   *store) {
+  context.geoContext = ctx.geoContext;
+  context.magFieldContext = ctx.magFieldContext;
+  context.calibContext = ctx.calibContext;
+}
+
+ActsExamples::AsyncWriter::AsyncWriter(const Config& cfg,
+                                       Acts::Logging::Level level)
+    : m_cfg(cfg) {
+  if (not m_cfg.writer) {
+    throw std::invalid_argument("Missing writer");
+  }
+  if (m_cfg.maxQueuedEvents == 0) {
+    throw std::invalid_argument("Invalid maximum number of queued events");
+  }
+  m_logger = Acts::getDefaultLogger("Async" + m_cfg.writer->name(), level);
+  m_queue.set_capacity(m_cfg.maxQueuedEvents);
+  m_thread = std::thread([this] { run(); });
+}
+
+ActsExamples::AsyncWriter::~AsyncWriter() {
+  stop();
+}
+
+std::string ActsExamples::AsyncWriter::name() const {
+  return m_cfg.writer->name();
+}
+
+ActsExamples::ProcessCode ActsExamples::AsyncWriter::write(
+    const AlgorithmContext& context) {
+  if (m_failed) {
+    return ProcessCode::ABORT;
+  }
+  auto store = acquireStore();
+  context.eventStore.shareWith(*store);
+  auto job = std::make_unique<Job>(context, std::move(store));
+  // blocks while the queue is full
+  m_queue.push(job.get());
+  job.release();
+  return ProcessCode::SUCCESS;
+}
+
+ActsExamples::ProcessCode ActsExamples::AsyncWriter::endRun() {
+  stop();
+  if (m_failed) {
+    ACTS_ERROR("Not all events could be written");
+    return ProcessCode::ABORT;
+  }
+  return m_cfg.writer->endRun();
+}
+
+std::optional<ActsExamples::DataDependencies>
+ActsExamples::AsyncWriter::dataDependencies() const {
+  return m_cfg.writer->dataDependencies();
+}
+
+void ActsExamples::AsyncWriter::run() {
+  while (true) {
+    Job* next = nullptr;
+    m_queue.pop(next);
+    if (next == nullptr) {
+      break;
+    }
+    std::unique_ptr<Job> job(next);
+    // events are still taken from the queue after a failure, such that
+    // queued events are released and writing threads are not blocked
+    if (not m_failed) {
+      try {
+        if (m_cfg.writer->write(job->context) != ProcessCode::SUCCESS) {
+          ACTS_ERROR("Failed to write event " << job->context.eventNumber);
+          m_failed = true;
+        }
+      } catch (const std::exception& e) {
+        ACTS_ERROR("Failed to write event " << job->context.eventNumber
+                                            << ": " << e.what());
+        m_failed = true;
+      }
+    }
+    // the event data is released once the event has been written
+    releaseStore(std::move(job->store));
+  }
+}
+
+std::unique_ptr<ActsExamples::WhiteBoard>
+ActsExamples::AsyncWriter::acquireStore() {
+  {
+    std::lock_guard<std::mutex> lock(m_storesMutex);
+    if (not m_stores.empty()) {
+      auto store = std::move(m_stores.back());
+      m_stores.pop_back();
+      return store;
+    }
+  }
+  // bounded by the number of queued events and of writing threads
+  return std::make_unique<WhiteBoard>();
+}
+
+void ActsExamples::AsyncWriter::releaseStore(
+    std::unique_ptr<WhiteBoard> store) {
+  store->clear();
+  std::lock_guard<std::mutex> lock(m_storesMutex);
+  m_stores.push_back(std::move(store));
+}
+
+void ActsExamples::AsyncWriter::stop() {
+  if (m_thread.joinable()) {
+    m_queue.push(nullptr);
+    m_thread.join();
+  }
+}
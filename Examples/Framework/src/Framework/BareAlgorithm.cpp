@@ -8,6 +8,8 @@
 
 #include "ActsExamples/Framework/BareAlgorithm.hpp"
 
+#include <stdexcept>
+
 ActsExamples::BareAlgorithm::BareAlgorithm(std::string name,
                                            Acts::Logging::Level level)
     : m_name(std::move(name)),
@@ -16,3 +18,28 @@ ActsExamples::BareAlgorithm::BareAlgorithm(std::string name,
 std::string ActsExamples::BareAlgorithm::name() const {
   return m_name;
 }
+
+std::optional<ActsExamples::DataDependencies>
+ActsExamples::BareAlgorithm::dataDependencies() const {
+  return m_dataDependencies;
+}
+
+void ActsExamples::BareAlgorithm::declareInput(std::string name) {
+  if (name.empty()) {
+    throw std::invalid_argument("Can not declare an input without name");
+  }
+  if (not m_dataDependencies) {
+    m_dataDependencies.emplace();
+  }
+  m_dataDependencies->inputs.push_back(std::move(name));
+}
+
+void ActsExamples::BareAlgorithm::declareOutput(std::string name) {
+  if (name.empty()) {
+    throw std::invalid_argument("Can not declare an output without name");
+  }
+  if (not m_dataDependencies) {
+    m_dataDependencies.emplace();
+  }
+  m_dataDependencies->outputs.push_back(std::move(name));
+}
@@ -0,0 +1,126 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Framework/Profiling.hpp"
+
+#include <atomic>
+#include <cstring>
+
+#include <sys/resource.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+// trivial types only, such that the hook never allocates itself
+thread_local ActsExamples::AllocationCount threadAllocationCount;
+std::atomic<bool> anyAllocationRecorded = false;
+
+#ifdef __linux__
+// Cycles, instructions, and cache misses of the owning thread, read at once.
+class PerfCounterGroup {
+ public:
+  PerfCounterGroup() {
+    m_fds[0] = open(PERF_COUNT_HW_CPU_CYCLES, -1);
+    if (m_fds[0] < 0) {
+      return;
+    }
+    m_fds[1] = open(PERF_COUNT_HW_INSTRUCTIONS, m_fds[0]);
+    m_fds[2] = open(PERF_COUNT_HW_CACHE_MISSES, m_fds[0]);
+    if ((m_fds[1] < 0) or (m_fds[2] < 0)) {
+      closeAll();
+      return;
+    }
+    ioctl(m_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(m_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+  PerfCounterGroup(const PerfCounterGroup&) = delete;
+  PerfCounterGroup& operator=(const PerfCounterGroup&) = delete;
+  ~PerfCounterGroup() { closeAll(); }
+
+  std::optional<ActsExamples::HardwareCounters> read() const {
+    if (m_fds[0] < 0) {
+      return std::nullopt;
+    }
+    // layout for PERF_FORMAT_GROUP: number of counters followed by values
+    uint64_t data[4] = {};
+    if (::read(m_fds[0], data, sizeof(data)) != sizeof(data) or
+        data[0] != 3) {
+      return std::nullopt;
+    }
+    return ActsExamples::HardwareCounters{data[1], data[2], data[3]};
+  }
+
+ private:
+  static int open(uint64_t config, int groupFd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    // the group is enabled at once via its leader
+    attr.disabled = (groupFd == -1) ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0);
+  }
+  void closeAll() {
+    for (int& fd : m_fds) {
+      if (0 <= fd) {
+        close(fd);
+      }
+      fd = -1;
+    }
+  }
+
+  int m_fds[3] = {-1, -1, -1};
+};
+#endif
+}  // namespace
+
+void ActsExamples::recordAllocation(size_t bytes) noexcept {
+  threadAllocationCount.allocations += 1;
+  threadAllocationCount.bytes += bytes;
+  anyAllocationRecorded.store(true, std::memory_order_relaxed);
+}
+
+ActsExamples::AllocationCount ActsExamples::threadAllocations() noexcept {
+  return threadAllocationCount;
+}
+
+bool ActsExamples::allocationsRecorded() noexcept {
+  return anyAllocationRecorded.load(std::memory_order_relaxed);
+}
+
+size_t ActsExamples::peakResidentSetSize() {
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+#ifdef __APPLE__
+  // reported in bytes instead of kilobytes
+  return usage.ru_maxrss / 1024;
+#else
+  return usage.ru_maxrss;
+#endif
+}
+
+std::optional<ActsExamples::HardwareCounters>
+ActsExamples::readThreadHardwareCounters() {
+#ifdef __linux__
+  thread_local PerfCounterGroup counters;
+  return counters.read();
+#else
+  return std::nullopt;
+#endif
+}
@@ -18,9 +18,31 @@
 
 ActsExamples::RandomNumbers::RandomNumbers(const Config& cfg) : m_cfg(cfg) {}
 
+namespace {
+// bijective 64bit mixing function from splitmix64, only zero maps to zero
+uint64_t mix(uint64_t x) {
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9u;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebu;
+  x ^= x >> 31;
+  return x;
+}
+}  // namespace
+
 ActsExamples::RandomEngine ActsExamples::RandomNumbers::spawnGenerator(
     const AlgorithmContext& context) const {
-  return RandomEngine(generateSeed(context));
+  // the event and algorithm select the stream, no further key is needed
+  return RandomEngine(m_cfg.seed, context.eventNumber,
+                      static_cast<uint32_t>(context.algorithmNumber));
+}
+
+ActsExamples::RandomEngine ActsExamples::RandomNumbers::spawnGenerator(
+    const AlgorithmContext& context, uint64_t key) const {
+  // the additional key selects a different family of streams. offset by one
+  // to keep them distinct from the generators spawned without a key.
+  return RandomEngine(m_cfg.seed ^ mix(key + 1u), context.eventNumber,
+                      static_cast<uint32_t>(context.algorithmNumber));
 }
 
 uint64_t ActsExamples::RandomNumbers::generateSeed(
@@ -8,21 +8,45 @@
 
 #include "ActsExamples/Framework/Sequencer.hpp"
 
+#include "ActsExamples/Framework/AlgorithmState.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Framework/Profiling.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
 #include <exception>
+#include <functional>
 #include <numeric>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <TROOT.h>
 #include <dfe/dfe_io_dsv.hpp>
 #include <dfe/dfe_namedtuple.hpp>
+#include <tbb/concurrent_queue.h>
+#include <tbb/flow_graph.h>
 #include <tbb/parallel_for.h>
 #include <tbb/queuing_mutex.h>
 
+// the pipeline interface changed with oneTBB
+#if __has_include(<tbb/parallel_pipeline.h>)
+#include <tbb/parallel_pipeline.h>
+namespace {
+constexpr auto kSerialInOrder = tbb::filter_mode::serial_in_order;
+constexpr auto kParallel = tbb::filter_mode::parallel;
+}  // namespace
+#else
+#include <tbb/pipeline.h>
+namespace {
+constexpr auto kSerialInOrder = tbb::filter::serial_in_order;
+constexpr auto kParallel = tbb::filter::parallel;
+}  // namespace
+#endif
+
 ActsExamples::Sequencer::Sequencer(const Sequencer::Config& cfg)
     : m_cfg(cfg),
       m_taskArena((m_cfg.numThreads < 0) ? tbb::task_arena::automatic
@@ -165,6 +189,172 @@ ActsExamples::Sequencer::determineEventsRange() const {
   return {begSelected, endSelected};
 }
 
+void ActsExamples::Sequencer::skipReplacedAlgorithms() {
+  // objects added by the readers
+  std::unordered_set<std::string> fromReaders;
+  for (const auto& reader : m_readers) {
+    auto deps = reader->dataDependencies();
+    if (deps) {
+      fromReaders.insert(deps->outputs.begin(), deps->outputs.end());
+    }
+  }
+  if (fromReaders.empty()) {
+    return;
+  }
+
+  // inputs of the elements that are run and of the skipped algorithms
+  std::unordered_set<std::string> needed;
+  std::unordered_set<std::string> neededBySkipped;
+  for (const auto& writer : m_writers) {
+    auto deps = writer->dataDependencies();
+    if (not deps) {
+      // could need any object
+      return;
+    }
+    needed.insert(deps->inputs.begin(), deps->inputs.end());
+  }
+
+  // go backwards such that the consumers are known before the producers
+  std::vector<bool> skip(m_algorithms.size(), false);
+  for (size_t i = m_algorithms.size(); 0 < i--;) {
+    auto deps = m_algorithms[i]->dataDependencies();
+    if (not deps) {
+      // could need any object added by the preceding algorithms
+      break;
+    }
+    bool isReplaced = not deps->outputs.empty();
+    bool isConnected = false;
+    for (const auto& output : deps->outputs) {
+      bool isRead = (0 < fromReaders.count(output));
+      isReplaced = isReplaced and (isRead or (needed.count(output) == 0));
+      isConnected =
+          isConnected or isRead or (0 < neededBySkipped.count(output));
+    }
+    skip[i] = isReplaced and isConnected;
+    auto& inputs = skip[i] ? neededBySkipped : needed;
+    inputs.insert(deps->inputs.begin(), deps->inputs.end());
+  }
+
+  std::vector<std::shared_ptr<IAlgorithm>> algorithms;
+  for (size_t i = 0; i < m_algorithms.size(); ++i) {
+    if (skip[i]) {
+      ACTS_INFO("Skip algorithm '" << m_algorithms[i]->name()
+                                   << "', its outputs are read instead");
+    } else {
+      algorithms.push_back(std::move(m_algorithms[i]));
+    }
+  }
+  m_algorithms = std::move(algorithms);
+}
+
+bool ActsExamples::Sequencer::checkDataDependencies() const {
+  // objects known to be added by the preceding elements
+  std::unordered_set<std::string> available;
+  // whether any preceding element does not declare what it adds
+  bool hasUndeclared = false;
+  bool isValid = true;
+
+  auto addOutputs = [&](const std::string& producer,
+                        const std::optional<DataDependencies>& deps) {
+    if (not deps) {
+      hasUndeclared = true;
+      return;
+    }
+    for (const auto& output : deps->outputs) {
+      if (not available.insert(output).second) {
+        ACTS_ERROR("Object '" << output << "' is added again by '" << producer
+                              << "'");
+        isValid = false;
+      }
+    }
+  };
+  auto checkInputs = [&](const std::string& consumer,
+                         const std::optional<DataDependencies>& deps) {
+    if (not deps) {
+      return;
+    }
+    for (const auto& input : deps->inputs) {
+      if (0 < available.count(input)) {
+        continue;
+      }
+      if (hasUndeclared) {
+        ACTS_DEBUG("Input '" << input << "' of '" << consumer
+                             << "' is not declared by any preceding element");
+      } else {
+        ACTS_ERROR("Missing producer for input '" << input << "' of '"
+                                                  << consumer << "'");
+        isValid = false;
+      }
+    }
+  };
+
+  for (const auto& reader : m_readers) {
+    addOutputs(reader->name(), reader->dataDependencies());
+  }
+  for (const auto& algorithm : m_algorithms) {
+    auto deps = algorithm->dataDependencies();
+    checkInputs(algorithm->name(), deps);
+    addOutputs(algorithm->name(), deps);
+  }
+  for (const auto& writer : m_writers) {
+    checkInputs(writer->name(), writer->dataDependencies());
+  }
+  return isValid;
+}
+
+std::vector<std::vector<size_t>>
+ActsExamples::Sequencer::determineDependencies() const {
+  std::vector<std::vector<size_t>> dependencies;
+  // algorithm that added an object
+  std::unordered_map<std::string, size_t> producers;
+  // last algorithm without declared dependencies and the ones following it
+  std::optional<size_t> barrier;
+  std::vector<size_t> sinceBarrier;
+
+  auto addNode = [&](const std::optional<DataDependencies>& deps,
+                     bool isAlgorithm) {
+    size_t node = dependencies.size();
+    auto& nodeDependencies = dependencies.emplace_back();
+    if (barrier) {
+      nodeDependencies.push_back(*barrier);
+    }
+    if (not deps) {
+      // wait for all preceding algorithms
+      nodeDependencies.insert(nodeDependencies.end(), sinceBarrier.begin(),
+                              sinceBarrier.end());
+      if (isAlgorithm) {
+        barrier = node;
+        sinceBarrier.clear();
+      }
+      return;
+    }
+    for (const auto& input : deps->inputs) {
+      auto it = producers.find(input);
+      if (it != producers.end()) {
+        nodeDependencies.push_back(it->second);
+      }
+    }
+    std::sort(nodeDependencies.begin(), nodeDependencies.end());
+    nodeDependencies.erase(
+        std::unique(nodeDependencies.begin(), nodeDependencies.end()),
+        nodeDependencies.end());
+    if (isAlgorithm) {
+      for (const auto& output : deps->outputs) {
+        producers.emplace(output, node);
+      }
+      sinceBarrier.push_back(node);
+    }
+  };
+
+  for (const auto& algorithm : m_algorithms) {
+    addNode(algorithm->dataDependencies(), true);
+  }
+  for (const auto& writer : m_writers) {
+    addNode(writer->dataDependencies(), false);
+  }
+  return dependencies;
+}
+
 // helpers for per-algorithm timing information
 namespace {
 using Clock = std::chrono::high_resolution_clock;
@@ -225,15 +415,299 @@ void storeTiming(const std::vector<std::string>& identifiers,
     writer.append(info);
   }
 }
+
+// Time and resources used by one element of the sequence.
+struct Usage {
+  Duration time = Duration::zero();
+  ActsExamples::AllocationCount allocations;
+  // increase of the process peak resident set size in kilobytes
+  size_t peakRssIncrease = 0;
+  ActsExamples::HardwareCounters counters;
+
+  Usage& operator+=(const Usage& other) {
+    time += other.time;
+    allocations.allocations += other.allocations.allocations;
+    allocations.bytes += other.allocations.bytes;
+    peakRssIncrease += other.peakRssIncrease;
+    counters.cycles += other.counters.cycles;
+    counters.instructions += other.counters.instructions;
+    counters.cacheMisses += other.counters.cacheMisses;
+    return *this;
+  }
+};
+
+// RAII-based measurement of the time and resources used within a block.
+//
+// Allocations and hardware counters are those of the executing thread. The
+// work of nested parallel loops on other threads is thus missed, while other
+// elements run by this thread during such a loop are included. The peak
+// resident set size is process-wide and is attributed to whichever element is
+// running when it grows.
+class UsageMonitor {
+ public:
+  UsageMonitor(Usage& usage, bool withCounters) : m_usage(usage) {
+    m_peakRss = ActsExamples::peakResidentSetSize();
+    m_allocations = ActsExamples::threadAllocations();
+    if (withCounters) {
+      m_counters = ActsExamples::readThreadHardwareCounters();
+    }
+    m_start = Clock::now();
+  }
+  ~UsageMonitor() {
+    m_usage.time += Clock::now() - m_start;
+    auto allocations = ActsExamples::threadAllocations();
+    m_usage.allocations.allocations +=
+        allocations.allocations - m_allocations.allocations;
+    m_usage.allocations.bytes += allocations.bytes - m_allocations.bytes;
+    m_usage.peakRssIncrease += ActsExamples::peakResidentSetSize() - m_peakRss;
+    if (m_counters) {
+      if (auto counters = ActsExamples::readThreadHardwareCounters()) {
+        m_usage.counters.cycles += counters->cycles - m_counters->cycles;
+        m_usage.counters.instructions +=
+            counters->instructions - m_counters->instructions;
+        m_usage.counters.cacheMisses +=
+            counters->cacheMisses - m_counters->cacheMisses;
+      }
+    }
+  }
+
+ private:
+  Usage& m_usage;
+  Timepoint m_start;
+  size_t m_peakRss;
+  ActsExamples::AllocationCount m_allocations;
+  std::optional<ActsExamples::HardwareCounters> m_counters;
+};
+
+// Per-event times of all elements of the sequence that run for each event.
+struct EventTimes {
+  size_t numElements = 0;
+  std::vector<size_t> events;
+  // one row with the times of all elements per event
+  std::vector<Duration> times;
+  // wall-clock time from reading to writing per event. differs from the sum
+  // of the element times if elements of the event run in parallel.
+  std::vector<Duration> wallTimes;
+
+  void append(const EventTimes& other) {
+    events.insert(events.end(), other.events.begin(), other.events.end());
+    times.insert(times.end(), other.times.begin(), other.times.end());
+    wallTimes.insert(wallTimes.end(), other.wallTimes.begin(),
+                     other.wallTimes.end());
+  }
+};
+
+// Distribution of the per-event times of one element.
+struct TimeQuantiles {
+  Duration p50 = Duration::zero();
+  Duration p95 = Duration::zero();
+  Duration p99 = Duration::zero();
+  Duration max = Duration::zero();
+  size_t maxEvent = SIZE_MAX;
+};
+
+// Quantiles of the given event times using the nearest-rank method.
+TimeQuantiles computeQuantiles(
+    std::vector<std::pair<Duration, size_t>> samples) {
+  TimeQuantiles quantiles;
+  if (samples.empty()) {
+    return quantiles;
+  }
+  std::sort(samples.begin(), samples.end());
+  auto quantile = [&](double q) {
+    size_t rank = std::ceil(q * samples.size());
+    return samples[std::max<size_t>(rank, 1) - 1].first;
+  };
+  quantiles.p50 = quantile(0.50);
+  quantiles.p95 = quantile(0.95);
+  quantiles.p99 = quantile(0.99);
+  quantiles.max = samples.back().first;
+  quantiles.maxEvent = samples.back().second;
+  return quantiles;
+}
+
+// Store per-event timing quantiles and resource usage
+struct ProfileInfo {
+  std::string identifier;
+  double time_p50_s;
+  double time_p95_s;
+  double time_p99_s;
+  double time_max_s;
+  size_t event_max;
+  // negative if not measured
+  int64_t allocations;
+  int64_t allocated_bytes;
+  int64_t peak_rss_increase_kb;
+  int64_t cycles;
+  int64_t instructions;
+  int64_t cache_misses;
+
+  DFE_NAMEDTUPLE(ProfileInfo, identifier, time_p50_s, time_p95_s, time_p99_s,
+                 time_max_s, event_max, allocations, allocated_bytes,
+                 peak_rss_increase_kb, cycles, instructions, cache_misses);
+};
+
+void storeProfile(const std::vector<std::string>& identifiers,
+                  const std::vector<TimeQuantiles>& quantiles,
+                  const std::vector<Usage>& usages, bool withAllocations,
+                  bool withCounters, std::string path) {
+  dfe::NamedTupleTsvWriter<ProfileInfo> writer(std::move(path), 6);
+  for (size_t i = 0; i < identifiers.size(); ++i) {
+    const Usage& usage = usages[i];
+    auto seconds = [](Duration d) {
+      return std::chrono::duration_cast<Seconds>(d).count();
+    };
+    auto measured = [](bool enabled, uint64_t value) {
+      return enabled ? static_cast<int64_t>(value) : int64_t(-1);
+    };
+    ProfileInfo info;
+    info.identifier = identifiers[i];
+    info.time_p50_s = seconds(quantiles[i].p50);
+    info.time_p95_s = seconds(quantiles[i].p95);
+    info.time_p99_s = seconds(quantiles[i].p99);
+    info.time_max_s = seconds(quantiles[i].max);
+    info.event_max = quantiles[i].maxEvent;
+    info.allocations =
+        measured(withAllocations, usage.allocations.allocations);
+    info.allocated_bytes = measured(withAllocations, usage.allocations.bytes);
+    info.peak_rss_increase_kb = usage.peakRssIncrease;
+    info.cycles = measured(withCounters, usage.counters.cycles);
+    info.instructions = measured(withCounters, usage.counters.instructions);
+    info.cache_misses = measured(withCounters, usage.counters.cacheMisses);
+    writer.append(info);
+  }
+}
+
+// Run nodes in the order given by their dependencies using a TBB flow graph.
+//
+// The graph is built once and can be run repeatedly, e.g. once per event.
+class DependencyGraph {
+ public:
+  using Node = tbb::flow::continue_node<tbb::flow::continue_msg>;
+
+  DependencyGraph(const std::vector<std::vector<size_t>>& dependencies,
+                  std::function<void(size_t)> execute)
+      : m_start(m_graph), m_execute(std::move(execute)) {
+    for (size_t i = 0; i < dependencies.size(); ++i) {
+      m_nodes.push_back(std::make_unique<Node>(
+          m_graph, [this, i](const tbb::flow::continue_msg&) {
+            m_execute(i);
+            return tbb::flow::continue_msg();
+          }));
+    }
+    for (size_t i = 0; i < dependencies.size(); ++i) {
+      if (dependencies[i].empty()) {
+        tbb::flow::make_edge(m_start, *m_nodes[i]);
+      }
+      for (size_t dependency : dependencies[i]) {
+        tbb::flow::make_edge(*m_nodes[dependency], *m_nodes[i]);
+      }
+    }
+  }
+
+  // Exceptions thrown by any node are rethrown here.
+  void run() {
+    m_start.try_put(tbb::flow::continue_msg());
+    m_graph.wait_for_all();
+  }
+
+ private:
+  tbb::flow::graph m_graph;
+  tbb::flow::broadcast_node<tbb::flow::continue_msg> m_start;
+  std::vector<std::unique_ptr<Node>> m_nodes;
+  std::function<void(size_t)> m_execute;
+};
+
+// Everything needed to process one event at a time, reused between events.
+struct EventSlot {
+  ActsExamples::WhiteBoard store;
+  std::optional<ActsExamples::AlgorithmContext> context;
+  // accumulated over all events of this slot
+  std::vector<Usage> usage;
+  // accumulated times before the current event
+  std::vector<Duration> previousTimes;
+  EventTimes eventTimes;
+  std::optional<DependencyGraph> graph;
+  // start of the current event
+  Timepoint start;
+
+  EventSlot(std::unique_ptr<const Acts::Logger> logger, size_t numElements)
+      : store(std::move(logger)),
+        usage(numElements),
+        previousTimes(numElements, Duration::zero()) {
+    eventTimes.numElements = numElements;
+  }
+
+  // Record the times of the elements for the current event.
+  void recordEventTimes() {
+    eventTimes.events.push_back(context->eventNumber);
+    eventTimes.wallTimes.push_back(Clock::now() - start);
+    for (size_t i = 0; i < usage.size(); ++i) {
+      eventTimes.times.push_back(usage[i].time - previousTimes[i]);
+      previousTimes[i] = usage[i].time;
+    }
+  }
+};
+
+// Number of events waiting in front of a pipeline stage.
+struct QueueDepth {
+  std::atomic<size_t> current = 0;
+  std::atomic<size_t> max = 0;
+  std::atomic<size_t> sum = 0;
+  std::atomic<size_t> samples = 0;
+
+  void push() {
+    size_t depth = ++current;
+    size_t prev = max;
+    while (prev < depth and not max.compare_exchange_weak(prev, depth)) {
+    }
+  }
+  // The depth is sampled whenever an event leaves the queue.
+  void pop() {
+    sum += current--;
+    samples++;
+  }
+  double mean() const {
+    return (0 < samples) ? static_cast<double>(sum) / samples : 0.;
+  }
+};
+
+// Store pipeline queue depth data
+struct QueueDepthInfo {
+  std::string stage;
+  double queue_depth_mean;
+  size_t queue_depth_max;
+
+  DFE_NAMEDTUPLE(QueueDepthInfo, stage, queue_depth_mean, queue_depth_max);
+};
+
+void storeQueueDepths(const std::vector<std::string>& stages,
+                      const std::vector<const QueueDepth*>& queues,
+                      std::string path) {
+  dfe::NamedTupleTsvWriter<QueueDepthInfo> writer(std::move(path), 4);
+  for (size_t i = 0; i < stages.size(); ++i) {
+    QueueDepthInfo info;
+    info.stage = stages[i];
+    info.queue_depth_mean = queues[i]->mean();
+    info.queue_depth_max = queues[i]->max;
+    writer.append(info);
+  }
+}
 }  // namespace
 
 int ActsExamples::Sequencer::run() {
   // measure overall wall clock
   Timepoint clockWallStart = Clock::now();
+  skipReplacedAlgorithms();
   // per-algorithm time measures
   std::vector<std::string> names = listAlgorithmNames();
   std::vector<Duration> clocksAlgorithms(names.size(), Duration::zero());
   tbb::queuing_mutex clocksAlgorithmsMutex;
+  // per-event measures for the elements that run for every event
+  size_t numElements = names.size();
+  std::vector<Usage> usageElements(numElements);
+  EventTimes eventTimes;
+  eventTimes.numElements = numElements;
 
   // processing only works w/ a well-known number of events
   // error message is already handled by the helper function
@@ -241,6 +715,16 @@ int ActsExamples::Sequencer::run() {
   if ((eventsRange.first == SIZE_MAX) and (eventsRange.second == SIZE_MAX)) {
     return EXIT_FAILURE;
   }
+  if (not checkDataDependencies()) {
+    return EXIT_FAILURE;
+  }
+  std::vector<std::vector<size_t>> dependencies;
+  if (m_cfg.dataFlowScheduling) {
+    dependencies = determineDependencies();
+  }
+  // position of the first algorithm in the sequence
+  size_t firstAlgorithm =
+      m_services.size() + m_decorators.size() + m_readers.size();
 
   ACTS_INFO("Processing events [" << eventsRange.first << ", "
                                   << eventsRange.second << ")");
@@ -250,6 +734,18 @@ int ActsExamples::Sequencer::run() {
   ACTS_INFO("  " << m_readers.size() << " readers");
   ACTS_INFO("  " << m_algorithms.size() << " algorithms");
   ACTS_INFO("  " << m_writers.size() << " writers");
+  if (m_cfg.dataFlowScheduling) {
+    ACTS_INFO("Algorithms are scheduled by their data flow");
+  }
+  if (0 < m_cfg.eventsInFlight) {
+    ACTS_INFO("Pipeline with at most " << m_cfg.eventsInFlight
+                                       << " events in flight");
+  }
+  bool withCounters = m_cfg.hardwareCounters;
+  if (withCounters and not readThreadHardwareCounters()) {
+    ACTS_WARNING("Hardware performance counters are not available");
+    withCounters = false;
+  }
 
   // run start-of-run hooks
   for (auto& service : m_services) {
@@ -259,79 +755,210 @@ int ActsExamples::Sequencer::run() {
     service->startRun();
   }
 
-  // execute the parallel event loop
+  // the parts of processing one event, used by all scheduling modes
+  ActsExamples::WorkerStates workerStates(m_algorithms.size());
   std::atomic<size_t> nProcessedEvents = 0;
   size_t nTotalEvents = eventsRange.second - eventsRange.first;
-  m_taskArena.execute([&] {
-    tbb::parallel_for(
-        tbb::blocked_range<size_t>(eventsRange.first, eventsRange.second),
-        [&](const tbb::blocked_range<size_t>& r) {
-          std::vector<Duration> localClocksAlgorithms(names.size(),
-                                                      Duration::zero());
-
-          for (size_t event = r.begin(); event != r.end(); ++event) {
-            // Use per-event store
-            WhiteBoard eventStore(Acts::getDefaultLogger(
-                "EventStore#" + std::to_string(event), m_cfg.logLevel));
-            // If we ever wanted to run algorithms in parallel, this needs to be
-            // changed to Algorithm context copies
-            AlgorithmContext context(0, event, eventStore);
-            size_t ialgo = 0;
-
-            // Prepare event store w/ service information
-            for (auto& service : m_services) {
-              StopWatch sw(localClocksAlgorithms[ialgo++]);
-              service->prepare(++context);
-            }
-            /// Decorate the context
-            for (auto& cdr : m_decorators) {
-              StopWatch sw(localClocksAlgorithms[ialgo++]);
-              if (cdr->decorate(++context) != ProcessCode::SUCCESS) {
-                throw std::runtime_error("Failed to decorate event context");
-              }
-            }
-            // Read everything in
-            for (auto& rdr : m_readers) {
-              StopWatch sw(localClocksAlgorithms[ialgo++]);
-              if (rdr->read(++context) != ProcessCode::SUCCESS) {
-                throw std::runtime_error("Failed to read input data");
-              }
-            }
-            // Execute all algorithms
-            for (auto& alg : m_algorithms) {
-              StopWatch sw(localClocksAlgorithms[ialgo++]);
-              if (alg->execute(++context) != ProcessCode::SUCCESS) {
-                throw std::runtime_error("Failed to process event data");
-              }
-            }
-            // Write out results
-            for (auto& wrt : m_writers) {
-              StopWatch sw(localClocksAlgorithms[ialgo++]);
-              if (wrt->write(++context) != ProcessCode::SUCCESS) {
-                throw std::runtime_error("Failed to write output data");
-              }
-            }
-
-            nProcessedEvents++;
-            if (nTotalEvents <= 100) {
-              ACTS_INFO("finished event " << event);
-            } else {
-              if (nProcessedEvents % 100 == 0) {
-                ACTS_INFO(nProcessedEvents << " / " << nTotalEvents
-                                           << " events processed");
-              }
-            }
+  size_t firstWriter = firstAlgorithm + m_algorithms.size();
+
+  auto makeSlot = [&](bool withWriters) {
+    auto slot = std::make_unique<EventSlot>(
+        Acts::getDefaultLogger("EventStore", m_cfg.logLevel), numElements);
+    if (m_cfg.dataFlowScheduling) {
+      auto nodes = dependencies;
+      if (not withWriters) {
+        // writers only depend on algorithms and can simply be dropped
+        nodes.resize(m_algorithms.size());
+      }
+      slot->graph.emplace(nodes, [&, s = slot.get()](size_t node) {
+        // each algorithm gets the number it has in the serial sequence
+        size_t ialgo = firstAlgorithm + node;
+        AlgorithmContext context = *s->context;
+        context.algorithmNumber = ialgo + 1;
+        UsageMonitor monitor(s->usage[ialgo], withCounters);
+        if (node < m_algorithms.size()) {
+          ActsExamples::WorkerStates::Lease state(workerStates, node);
+          context.algorithmState = state.get();
+          if (m_algorithms[node]->execute(context) != ProcessCode::SUCCESS) {
+            throw std::runtime_error("Failed to process event data");
           }
+        } else {
+          auto& wrt = m_writers[node - m_algorithms.size()];
+          if (wrt->write(context) != ProcessCode::SUCCESS) {
+            throw std::runtime_error("Failed to write output data");
+          }
+        }
+      });
+    }
+    return slot;
+  };
+  auto readEvent = [&](EventSlot& slot, size_t event) {
+    slot.start = Clock::now();
+    // the store only writes verbose messages; only then name it by the event
+    if (m_cfg.logLevel <= Acts::Logging::VERBOSE) {
+      slot.store.setLogger(Acts::getDefaultLogger(
+          "EventStore#" + std::to_string(event), m_cfg.logLevel));
+    }
+    AlgorithmContext& context = slot.context.emplace(0, event, slot.store);
+    size_t ialgo = 0;
+    // Prepare event store w/ service information
+    for (auto& service : m_services) {
+      UsageMonitor monitor(slot.usage[ialgo++], withCounters);
+      service->prepare(++context);
+    }
+    /// Decorate the context
+    for (auto& cdr : m_decorators) {
+      UsageMonitor monitor(slot.usage[ialgo++], withCounters);
+      if (cdr->decorate(++context) != ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to decorate event context");
+      }
+    }
+    // Read everything in
+    for (auto& rdr : m_readers) {
+      UsageMonitor monitor(slot.usage[ialgo++], withCounters);
+      if (rdr->read(++context) != ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to read input data");
+      }
+    }
+  };
+  auto executeAlgorithms = [&](EventSlot& slot) {
+    if (slot.graph) {
+      // Execute all algorithms (and writers) as their inputs permit
+      slot.graph->run();
+      return;
+    }
+    AlgorithmContext& context = *slot.context;
+    context.algorithmNumber = firstAlgorithm;
+    size_t ialgo = firstAlgorithm;
+    for (size_t i = 0; i < m_algorithms.size(); ++i) {
+      UsageMonitor monitor(slot.usage[ialgo++], withCounters);
+      ActsExamples::WorkerStates::Lease state(workerStates, i);
+      context.algorithmState = state.get();
+      if (m_algorithms[i]->execute(++context) != ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to process event data");
+      }
+    }
+    context.algorithmState = nullptr;
+  };
+  auto writeEvent = [&](EventSlot& slot) {
+    AlgorithmContext& context = *slot.context;
+    context.algorithmNumber = firstWriter;
+    size_t ialgo = firstWriter;
+    for (auto& wrt : m_writers) {
+      UsageMonitor monitor(slot.usage[ialgo++], withCounters);
+      if (wrt->write(++context) != ProcessCode::SUCCESS) {
+        throw std::runtime_error("Failed to write output data");
+      }
+    }
+  };
+  auto finishEvent = [&](EventSlot& slot) {
+    size_t event = slot.context->eventNumber;
+    slot.recordEventTimes();
+    // Release the event data but keep the store for the next event
+    slot.context.reset();
+    slot.store.clear();
+
+    size_t nProcessed = ++nProcessedEvents;
+    if (nTotalEvents <= 100) {
+      ACTS_INFO("finished event " << event);
+    } else {
+      if (nProcessed % 100 == 0) {
+        ACTS_INFO(nProcessed << " / " << nTotalEvents << " events processed");
+      }
+    }
+  };
+  // add timing info to global information
+  auto collectClocks = [&](const EventSlot& slot) {
+    tbb::queuing_mutex::scoped_lock lock(clocksAlgorithmsMutex);
+    for (size_t i = 0; i < numElements; ++i) {
+      clocksAlgorithms[i] += slot.usage[i].time;
+      usageElements[i] += slot.usage[i];
+    }
+    eventTimes.append(slot.eventTimes);
+  };
+
+  if (0 < m_cfg.eventsInFlight) {
+    // execute the event pipeline with a bounded number of events in flight
+    std::vector<std::unique_ptr<EventSlot>> slots;
+    tbb::concurrent_queue<EventSlot*> freeSlots;
+    QueueDepth algorithmsQueue;
+    QueueDepth writersQueue;
+    size_t nextEvent = eventsRange.first;
+
+    auto readStage = [&](tbb::flow_control& fc) -> EventSlot* {
+      if (nextEvent == eventsRange.second) {
+        fc.stop();
+        return nullptr;
+      }
+      // a slot is always free since it is released before its token
+      EventSlot* slot = nullptr;
+      if (not freeSlots.try_pop(slot)) {
+        throw std::logic_error("No free event slot in the pipeline");
+      }
+      readEvent(*slot, nextEvent++);
+      algorithmsQueue.push();
+      return slot;
+    };
+    auto algorithmsStage = [&](EventSlot* slot) {
+      algorithmsQueue.pop();
+      executeAlgorithms(*slot);
+      writersQueue.push();
+      return slot;
+    };
+    auto writersStage = [&](EventSlot* slot) {
+      writersQueue.pop();
+      writeEvent(*slot);
+      finishEvent(*slot);
+      freeSlots.push(slot);
+    };
+
+    m_taskArena.execute([&] {
+      // the flow graphs must be created in the arena they are run in
+      for (size_t i = 0; i < m_cfg.eventsInFlight; ++i) {
+        slots.push_back(makeSlot(false));
+        freeSlots.push(slots.back().get());
+      }
+      tbb::parallel_pipeline(
+          m_cfg.eventsInFlight,
+          tbb::make_filter<void, EventSlot*>(kSerialInOrder, readStage) &
+              tbb::make_filter<EventSlot*, EventSlot*>(kParallel,
+                                                       algorithmsStage) &
+              tbb::make_filter<EventSlot*, void>(kSerialInOrder,
+                                                 writersStage));
+    });
+    for (const auto& slot : slots) {
+      collectClocks(*slot);
+    }
 
-          // add timing info to global information
-          {
-            tbb::queuing_mutex::scoped_lock lock(clocksAlgorithmsMutex);
-            for (size_t i = 0; i < clocksAlgorithms.size(); ++i) {
-              clocksAlgorithms[i] += localClocksAlgorithms[i];
+    ACTS_INFO("Events waiting for the algorithms: "
+              << algorithmsQueue.mean() << " on average, "
+              << algorithmsQueue.max << " at most");
+    ACTS_INFO("Events waiting for the writers: "
+              << writersQueue.mean() << " on average, " << writersQueue.max
+              << " at most");
+    storeQueueDepths({"algorithms", "writers"},
+                     {&algorithmsQueue, &writersQueue},
+                     joinPaths(m_cfg.outputDir, "pipeline.tsv"));
+  } else {
+    // execute the parallel event loop
+    m_taskArena.execute([&] {
+      tbb::parallel_for(
+          tbb::blocked_range<size_t>(eventsRange.first, eventsRange.second),
+          [&](const tbb::blocked_range<size_t>& r) {
+            // the slot is reused for all events of this range
+            auto slot = makeSlot(true);
+            for (size_t event = r.begin(); event != r.end(); ++event) {
+              readEvent(*slot, event);
+              executeAlgorithms(*slot);
+              if (not slot->graph) {
+                writeEvent(*slot);
+              }
+              finishEvent(*slot);
             }
-          }
-        });
-  });
+            collectClocks(*slot);
+          });
+    });
+  }
 
   // run end-of-run hooks
   for (auto& wrt : m_writers) {
@@ -359,5 +986,38 @@ int ActsExamples::Sequencer::run() {
   storeTiming(names, clocksAlgorithms, numEvents,
               joinPaths(m_cfg.outputDir, "timing.tsv"));
 
+  // per-event time distributions, preceded by the wall-clock time of the
+  // whole event. the resource usage of the event is the sum of its elements.
+  std::vector<std::string> profileNames = {"Event"};
+  profileNames.insert(profileNames.end(), names.begin(),
+                      names.begin() + numElements);
+  std::vector<Usage> profileUsage(1);
+  for (const Usage& usage : usageElements) {
+    profileUsage.front() += usage;
+  }
+  profileUsage.insert(profileUsage.end(), usageElements.begin(),
+                      usageElements.end());
+  std::vector<TimeQuantiles> quantiles;
+  std::vector<std::pair<Duration, size_t>> samples(eventTimes.events.size());
+  for (size_t i = 0; i < samples.size(); ++i) {
+    samples[i] = {eventTimes.wallTimes[i], eventTimes.events[i]};
+  }
+  quantiles.push_back(computeQuantiles(samples));
+  for (size_t ielement = 0; ielement < numElements; ++ielement) {
+    for (size_t i = 0; i < samples.size(); ++i) {
+      samples[i].first = eventTimes.times[i * numElements + ielement];
+    }
+    quantiles.push_back(computeQuantiles(samples));
+  }
+  ACTS_INFO("Time per event: " << asString(quantiles[0].p50) << " median, "
+                               << asString(quantiles[0].p99)
+                               << " 99th percentile, "
+                               << asString(quantiles[0].max) << " in event "
+                               << quantiles[0].maxEvent);
+  ACTS_INFO("Peak resident set size: " << peakResidentSetSize() / 1024
+                                       << " MB");
+  storeProfile(profileNames, quantiles, profileUsage, allocationsRecorded(),
+               withCounters, joinPaths(m_cfg.outputDir, "profile.tsv"));
+
   return EXIT_SUCCESS;
 }
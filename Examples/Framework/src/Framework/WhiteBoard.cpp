@@ -0,0 +1,82 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+
+namespace {
+// Process-wide assignment of object names to white board slots.
+//
+// Names are only ever added, such that a slot stays valid for the whole run.
+struct SlotRegistry {
+  std::shared_mutex mutex;
+  std::unordered_map<std::string, size_t> slots;
+};
+
+SlotRegistry& slotRegistry() {
+  static SlotRegistry registry;
+  return registry;
+}
+}  // namespace
+
+size_t ActsExamples::WhiteBoard::registerSlot(const std::string& name) {
+  if (name.empty()) {
+    throw std::invalid_argument("Object can not have an empty name");
+  }
+  size_t slot = findSlot(name);
+  if (slot != SIZE_MAX) {
+    return slot;
+  }
+  auto& registry = slotRegistry();
+  std::unique_lock lock(registry.mutex);
+  // another thread might have registered the name in the meantime
+  return registry.slots.emplace(name, registry.slots.size()).first->second;
+}
+
+size_t ActsExamples::WhiteBoard::findSlot(const std::string& name) {
+  // names are mostly looked up through the same configuration strings. the
+  // string address selects a cache entry and the name must still match, since
+  // the string might have been changed or replaced in the meantime.
+  struct CacheEntry {
+    const std::string* address = nullptr;
+    std::string name;
+    size_t slot = SIZE_MAX;
+  };
+  thread_local std::array<CacheEntry, 64> cache;
+  auto& entry =
+      cache[(reinterpret_cast<uintptr_t>(&name) / alignof(std::string)) %
+            cache.size()];
+  if ((entry.address == &name) and (entry.name == name)) {
+    return entry.slot;
+  }
+
+  auto& registry = slotRegistry();
+  size_t slot = SIZE_MAX;
+  {
+    std::shared_lock lock(registry.mutex);
+    auto it = registry.slots.find(name);
+    if (it == registry.slots.end()) {
+      return SIZE_MAX;
+    }
+    slot = it->second;
+  }
+  // slots are never reassigned and can be kept for the whole process
+  entry.address = &name;
+  entry.name = name;
+  entry.slot = slot;
+  return slot;
+}
+
+size_t ActsExamples::WhiteBoard::numSlots() {
+  auto& registry = slotRegistry();
+  std::shared_lock lock(registry.mutex);
+  return registry.slots.size();
+}
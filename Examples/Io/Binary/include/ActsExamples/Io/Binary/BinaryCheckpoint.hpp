@@ -0,0 +1,79 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace ActsExamples {
+
+/// Type of a white board collection that can be stored in a checkpoint.
+enum class CheckpointCollectionType {
+  /// SimParticleContainer
+  Particles,
+  /// SimHitContainer
+  SimHits,
+  /// MeasurementContainer
+  Measurements,
+  /// IndexSourceLinkContainer
+  SourceLinks,
+  /// IndexMultimap<ActsFatras::Barcode>
+  MeasurementParticlesMap,
+  /// IndexMultimap<Index> from measurements to simulated hits
+  MeasurementSimHitsMap,
+  /// SimSpacePointContainer
+  SpacePoints,
+  /// SimSeedContainer
+  Seeds,
+  /// ProtoTrackContainer
+  ProtoTracks,
+};
+
+/// A white board collection stored in a checkpoint.
+struct CheckpointCollection {
+  /// Name of the collection on the white board.
+  std::string name;
+  /// Type of the collection.
+  CheckpointCollectionType type;
+  /// Space point collection the seeds refer to; only used for seeds and
+  /// must be stored in the same checkpoint.
+  std::string spacePoints = {};
+};
+
+/// The event data at a fixed point of the sequence, stored for later runs.
+///
+/// The collections of every event are stored in columnar binary files, one
+/// per collection, in a directory that is specific to the configuration. A
+/// checkpoint written for one configuration is never replayed for another
+/// one. Runs whose upstream configuration did not change can then read the
+/// collections instead of running the algorithms that created them.
+struct BinaryCheckpoint {
+  /// Directory that holds all checkpoints.
+  std::string cacheDir;
+  /// Name of the checkpoint, e.g. the last algorithm whose outputs are stored.
+  std::string name;
+  /// Description of the configuration of everything up to the checkpoint.
+  std::string configuration;
+  /// Stored collections.
+  std::vector<CheckpointCollection> collections;
+
+  /// Directory of the checkpoint, `<cacheDir>/<name>-<configuration hash>`.
+  std::string directory() const;
+
+  /// Whether the checkpoint was written completely by a previous run.
+  bool exists() const;
+
+  /// Check that the checkpoint is fully configured.
+  ///
+  /// @throws std::invalid_argument on missing names, duplicate collections,
+  ///         or seeds that refer to space points not stored before them
+  void checkConfig() const;
+};
+
+}  // namespace ActsExamples
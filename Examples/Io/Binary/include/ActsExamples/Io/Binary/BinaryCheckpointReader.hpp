@@ -0,0 +1,59 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsExamples/Framework/IReader.hpp"
+#include "ActsExamples/Io/Binary/BinaryCheckpoint.hpp"
+#include "ActsExamples/Io/Binary/ColumnarFile.hpp"
+#include <Acts/Utilities/Logger.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ActsExamples {
+
+/// Replay the collections of a checkpoint written by a previous run.
+///
+/// The declared outputs are the stored collections. The sequencer does not
+/// run the algorithms that would add them again, and neither the ones that
+/// are only needed by those.
+///
+/// Events are read directly from the memory-mapped files: thread-safe for
+/// parallel event processing.
+class BinaryCheckpointReader final : public IReader {
+ public:
+  /// Construct the reader and map the checkpoint files.
+  ///
+  /// @params checkpoint is the checkpoint to read
+  /// @params lvl is the logging level
+  /// @throws std::runtime_error if the checkpoint does not exist
+  BinaryCheckpointReader(const BinaryCheckpoint& checkpoint,
+                         Acts::Logging::Level lvl);
+
+  std::string name() const final override;
+
+  /// Return the events available in all files.
+  std::pair<size_t, size_t> availableEvents() const final override;
+
+  /// Read the collections of one event.
+  ProcessCode read(const AlgorithmContext& ctx) final override;
+
+  /// The collections added by the reader.
+  std::optional<DataDependencies> dataDependencies() const final override;
+
+ private:
+  BinaryCheckpoint m_checkpoint;
+  std::vector<std::unique_ptr<ColumnarFileReader>> m_files;
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  const Acts::Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace ActsExamples
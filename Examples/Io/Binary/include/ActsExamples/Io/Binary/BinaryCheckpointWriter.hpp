@@ -0,0 +1,65 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsExamples/Framework/IWriter.hpp"
+#include "ActsExamples/Io/Binary/BinaryCheckpoint.hpp"
+#include "ActsExamples/Io/Binary/ColumnarFile.hpp"
+#include <Acts/Utilities/Logger.hpp>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ActsExamples {
+
+/// Store the collections of a checkpoint for later runs.
+///
+/// Every collection is written to its own file,
+///
+///     <checkpoint directory>/<collection>.bin
+///
+/// with the layout of the corresponding binary writer. The checkpoint only
+/// becomes available for replay once the run ended successfully.
+///
+/// Safe to use from multiple writer threads - uses a std::mutex lock.
+class BinaryCheckpointWriter final : public IWriter {
+ public:
+  /// Construct the writer and create the checkpoint files.
+  ///
+  /// A previous checkpoint with the same configuration is overwritten.
+  ///
+  /// @params checkpoint is the checkpoint to write
+  /// @params lvl is the logging level
+  BinaryCheckpointWriter(const BinaryCheckpoint& checkpoint,
+                         Acts::Logging::Level lvl);
+
+  std::string name() const final override;
+
+  /// Store the collections of one event.
+  ProcessCode write(const AlgorithmContext& ctx) final override;
+
+  /// Write the event index of all files and mark the checkpoint complete.
+  ProcessCode endRun() final override;
+
+  /// The collections read by the writer.
+  std::optional<DataDependencies> dataDependencies() const final override;
+
+ private:
+  BinaryCheckpoint m_checkpoint;
+  std::string m_directory;
+  std::mutex m_writeMutex;
+  std::vector<std::unique_ptr<ColumnarFileWriter>> m_files;
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  const Acts::Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace ActsExamples
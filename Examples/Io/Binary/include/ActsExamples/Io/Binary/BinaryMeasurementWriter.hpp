@@ -0,0 +1,71 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/Framework/WriterT.hpp"
+#include "ActsExamples/Io/Binary/ColumnarFile.hpp"
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace ActsExamples {
+
+/// Write measurements to columnar binary files.
+///
+/// All events are written to the following files in the configured output
+/// directory
+///
+///     measurements.bin
+///     measurement-simhit-map.bin
+///     cells.bin (optional)
+///
+/// where the row number in the measurements file is the measurement index.
+///
+/// Safe to use from multiple writer threads - uses a std::mutex lock.
+class BinaryMeasurementWriter final : public WriterT<MeasurementContainer> {
+ public:
+  struct Config {
+    /// Which measurement collection to write.
+    std::string inputMeasurements;
+    /// Which cluster collection to write (optional).
+    std::string inputClusters;
+    /// Input collection to map measured hits to simulated hits.
+    std::string inputMeasurementSimHitsMap;
+    /// Where to place the output files.
+    std::string outputDir;
+  };
+
+  /// Construct the measurement writer and create the output files.
+  ///
+  /// @params cfg is the configuration object
+  /// @params lvl is the logging level
+  BinaryMeasurementWriter(const Config& cfg, Acts::Logging::Level lvl);
+
+  /// Write the event indices and close the files.
+  ProcessCode endRun() final override;
+
+ protected:
+  /// Type-specific write implementation.
+  ///
+  /// @param[in] ctx is the algorithm context
+  /// @param[in] measurements are the measurements to be written
+  ProcessCode writeT(const AlgorithmContext& ctx,
+                     const MeasurementContainer& measurements) final override;
+
+ private:
+  Config m_cfg;
+  std::mutex m_writeMutex;
+  std::unique_ptr<ColumnarFileWriter> m_measurementsFile;
+  std::unique_ptr<ColumnarFileWriter> m_simHitLinksFile;
+  std::unique_ptr<ColumnarFileWriter> m_cellsFile;
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,64 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsExamples/Framework/IReader.hpp"
+#include "ActsExamples/Io/Binary/ColumnarFile.hpp"
+#include <Acts/Utilities/Logger.hpp>
+
+#include <memory>
+#include <string>
+
+namespace ActsExamples {
+
+/// Read particles from a columnar binary file.
+///
+/// The file is the one written by the `BinaryParticleWriter`, i.e.
+///
+///     <stem>.bin
+///
+/// in the configured input directory. Events are read directly from the
+/// memory-mapped file: thread-safe for parallel event processing.
+class BinaryParticleReader final : public IReader {
+ public:
+  struct Config {
+    /// Where to read input files from.
+    std::string inputDir;
+    /// Input filename stem.
+    std::string inputStem;
+    /// Which particle collection to read into.
+    std::string outputParticles;
+  };
+
+  /// Construct the particle reader and map the input file.
+  ///
+  /// @params cfg is the configuration object
+  /// @params lvl is the logging level
+  BinaryParticleReader(const Config& cfg, Acts::Logging::Level lvl);
+
+  std::string name() const final override;
+
+  /// Return the available events range.
+  std::pair<size_t, size_t> availableEvents() const final override;
+
+  /// Read out data from the input stream.
+  ProcessCode read(const ActsExamples::AlgorithmContext& ctx) final override;
+
+  /// The particle collection added by the reader.
+  std::optional<DataDependencies> dataDependencies() const final override;
+
+ private:
+  Config m_cfg;
+  std::unique_ptr<ColumnarFileReader> m_file;
+  std::unique_ptr<const Acts::Logger> m_logger;
+
+  const Acts::Logger& logger() const { return *m_logger; }
+};
+
+}  // namespace ActsExamples
@@ -0,0 +1,65 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/Framework/WriterT.hpp"
+#include "ActsExamples/Io/Binary/ColumnarFile.hpp"
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace ActsExamples {
+
+/// Write simulated hits to a columnar binary file.
+///
+/// All events are written to a single file in the configured output
+/// directory,
+///
+///     <stem>.bin
+///
+/// with one row per simulated hit.
+///
+/// Safe to use from multiple writer threads - uses a std::mutex lock.
+class BinarySimHitWriter final : public WriterT<SimHitContainer> {
+ public:
+  struct Config {
+    /// Input simulated hits collection to write.
+    std::string inputSimHits;
+    /// Where to place the output file.
+    std::string outputDir;
+    /// Output filename stem.
+    std::string outputStem;
+  };
+
+  /// Construct the simulated hits writer and create the output file.
+  ///
+  /// @params cfg is the configuration object
+  /// @params lvl is the logging level
+  BinarySimHitWriter(const Config& cfg, Acts::Logging::Level lvl);
+
+  /// Write the event index and close the file.
+  ProcessCode endRun() final override;
+
+ protected:
+  /// Type-specific write implementation.
+  ///
+  /// @param[in] ctx is the algorithm context
+  /// @param[in] simHits are the simulated hits to be written
+  ProcessCode writeT(const ActsExamples::AlgorithmContext& ctx,
+                     const SimHitContainer& simHits) final override;
+
+ private:
+  Config m_cfg;
+  std::mutex m_writeMutex;
+  std::unique_ptr<ColumnarFileWriter> m_file;
+};
+
+}  // namespace ActsExamples
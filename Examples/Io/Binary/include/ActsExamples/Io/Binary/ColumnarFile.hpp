@@ -0,0 +1,184 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsExamples/Utilities/Range.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace ActsExamples {
+
+/// Value type of a column.
+enum class ColumnType : uint32_t {
+  UInt8 = 1,
+  Int32 = 2,
+  UInt32 = 3,
+  UInt64 = 4,
+  Float32 = 5,
+  Float64 = 6,
+};
+
+/// The column type that stores values of the given type.
+template <typename T>
+constexpr ColumnType columnType() {
+  if constexpr (std::is_same_v<T, uint8_t>) {
+    return ColumnType::UInt8;
+  } else if constexpr (std::is_same_v<T, int32_t>) {
+    return ColumnType::Int32;
+  } else if constexpr (std::is_same_v<T, uint32_t>) {
+    return ColumnType::UInt32;
+  } else if constexpr (std::is_same_v<T, uint64_t>) {
+    return ColumnType::UInt64;
+  } else if constexpr (std::is_same_v<T, float>) {
+    return ColumnType::Float32;
+  } else {
+    static_assert(std::is_same_v<T, double>, "Unsupported column type");
+    return ColumnType::Float64;
+  }
+}
+
+/// Name and value type of a column.
+struct ColumnSpec {
+  std::string name;
+  ColumnType type;
+};
+
+/// Values of one column of one event, without the type.
+struct ColumnData {
+  const void* data;
+  ColumnType type;
+  size_t size;
+
+  template <typename T>
+  ColumnData(const std::vector<T>& values)
+      : data(values.data()), type(columnType<T>()), size(values.size()) {}
+};
+
+/// Write events of columnar data to a single binary file.
+///
+/// The file consists of
+///
+/// 1.  a header with a magic number, the format version, and the name and
+///     type of all columns,
+/// 2.  one block per event with the number of rows followed by the values
+///     of each column, stored contiguously,
+/// 3.  an index with the event number and file offset of every block, and
+/// 4.  a trailer with the file offset of the index.
+///
+/// All numbers are stored in native byte order and every column starts at a
+/// multiple of eight bytes, such that the mapped file can be accessed
+/// without any decoding. Events can be written in any order.
+///
+/// @note Not thread-safe, writing events must be serialized by the user.
+class ColumnarFileWriter {
+ public:
+  /// Create the file and write the header.
+  ///
+  /// @throws std::runtime_error if the file can not be created
+  ColumnarFileWriter(const std::string& path, std::vector<ColumnSpec> columns);
+  /// Write the index if the file was not closed yet.
+  ~ColumnarFileWriter();
+
+  /// Append the data of one event.
+  ///
+  /// @param event Event number, must not have been written before
+  /// @param columns Values of all columns in the declared order
+  /// @throws std::invalid_argument if the columns do not match the declared
+  ///         ones or differ in size, or if the event was already written
+  void writeEvent(size_t event, const std::vector<ColumnData>& columns);
+
+  /// Write the index and close the file.
+  void close();
+
+ private:
+  void writePadding();
+
+  std::string m_path;
+  std::vector<ColumnSpec> m_columns;
+  std::ofstream m_file;
+  // event number and offset of every written block
+  std::vector<std::pair<uint64_t, uint64_t>> m_index;
+  // event numbers in the index for the duplicate check
+  std::unordered_set<uint64_t> m_writtenEvents;
+};
+
+/// Read events of columnar data from a file written by the columnar writer.
+///
+/// The file is mapped into memory and the column values of an event are
+/// accessed directly in the mapped memory. Reading is thread-safe.
+class ColumnarFileReader {
+ public:
+  /// The column values of one event, valid as long as the reader exists.
+  class EventView {
+   public:
+    /// Number of rows in the event.
+    size_t size() const { return m_size; }
+
+    /// Values of one column.
+    ///
+    /// @tparam T value type that must match the column type
+    /// @param icolumn Position of the column in the declared columns
+    template <typename T>
+    Range<const T*> column(size_t icolumn) const {
+      if (m_types.at(icolumn) != columnType<T>()) {
+        throw std::invalid_argument("Invalid type for column " +
+                                    std::to_string(icolumn));
+      }
+      const T* begin = static_cast<const T*>(m_columns[icolumn]);
+      return makeRange(begin, begin + m_size);
+    }
+
+   private:
+    friend class ColumnarFileReader;
+
+    size_t m_size = 0;
+    std::vector<const void*> m_columns;
+    std::vector<ColumnType> m_types;
+  };
+
+  /// Map the file and read the index.
+  ///
+  /// @param path Path of the file
+  /// @param columns Expected columns in the expected order
+  /// @throws std::runtime_error if the file can not be read or is invalid
+  ///         or if the columns do not match the expected ones
+  ColumnarFileReader(const std::string& path, std::vector<ColumnSpec> columns);
+  ColumnarFileReader(const ColumnarFileReader&) = delete;
+  ColumnarFileReader& operator=(const ColumnarFileReader&) = delete;
+  ~ColumnarFileReader();
+
+  /// Range of event numbers in the file.
+  ///
+  /// @note Events within the range can be missing, e.g. if some were
+  ///       skipped when writing.
+  std::pair<size_t, size_t> availableEvents() const;
+
+  /// Access the data of one event.
+  ///
+  /// @throws std::out_of_range if the event is not in the file
+  EventView event(size_t event) const;
+
+ private:
+  std::string m_path;
+  std::vector<ColumnSpec> m_columns;
+  const std::byte* m_data = nullptr;
+  size_t m_size = 0;
+  // event number and offset of every block, sorted by event number
+  std::vector<std::pair<uint64_t, uint64_t>> m_index;
+};
+
+}  // namespace ActsExamples
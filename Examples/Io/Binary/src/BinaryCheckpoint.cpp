@@ -0,0 +1,79 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/BinaryCheckpoint.hpp"
+
+#include "ActsExamples/Utilities/Paths.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace {
+// FNV-1a, stable across platforms and compilers unlike std::hash
+uint64_t hashConfiguration(const std::string& configuration) {
+  uint64_t hash = 14695981039346656037u;
+  for (unsigned char c : configuration) {
+    hash ^= c;
+    hash *= 1099511628211u;
+  }
+  return hash;
+}
+}  // namespace
+
+std::string ActsExamples::BinaryCheckpoint::directory() const {
+  char hash[17];
+  std::snprintf(hash, sizeof(hash), "%016llx",
+                static_cast<unsigned long long>(
+                    hashConfiguration(configuration)));
+  return joinPaths(cacheDir, name + '-' + hash);
+}
+
+bool ActsExamples::BinaryCheckpoint::exists() const {
+  // the configuration is written last, once all events are stored
+  std::ifstream file(joinPaths(directory(), "configuration.txt"));
+  if (not file) {
+    return false;
+  }
+  std::string stored((std::istreambuf_iterator<char>(file)),
+                     std::istreambuf_iterator<char>());
+  // different configurations could still have the same hash
+  return stored == configuration;
+}
+
+void ActsExamples::BinaryCheckpoint::checkConfig() const {
+  if (name.empty()) {
+    throw std::invalid_argument("Missing checkpoint name");
+  }
+  if (collections.empty()) {
+    throw std::invalid_argument("Missing checkpoint collections");
+  }
+  std::unordered_set<std::string> spacePoints;
+  std::unordered_set<std::string> names;
+  for (const auto& collection : collections) {
+    if (collection.name.empty()) {
+      throw std::invalid_argument("Missing checkpoint collection name");
+    }
+    if (not names.insert(collection.name).second) {
+      throw std::invalid_argument("Collection '" + collection.name +
+                                  "' is stored twice in the checkpoint");
+    }
+    if (collection.type == CheckpointCollectionType::SpacePoints) {
+      spacePoints.insert(collection.name);
+    }
+    if (collection.type == CheckpointCollectionType::Seeds and
+        spacePoints.count(collection.spacePoints) == 0) {
+      throw std::invalid_argument(
+          "Space points of seeds '" + collection.name +
+          "' must be stored before them in the checkpoint");
+    }
+  }
+}
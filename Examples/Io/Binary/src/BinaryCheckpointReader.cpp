@@ -0,0 +1,110 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/BinaryCheckpointReader.hpp"
+
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Utilities/Paths.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "BinaryColumns.hpp"
+
+ActsExamples::BinaryCheckpointReader::BinaryCheckpointReader(
+    const ActsExamples::BinaryCheckpoint& checkpoint, Acts::Logging::Level lvl)
+    : m_checkpoint(checkpoint),
+      m_logger(Acts::getDefaultLogger("BinaryCheckpointReader", lvl)) {
+  m_checkpoint.checkConfig();
+  if (not m_checkpoint.exists()) {
+    throw std::runtime_error("Checkpoint '" + m_checkpoint.name +
+                             "' does not exist for this configuration");
+  }
+  auto directory = m_checkpoint.directory();
+  for (const auto& collection : m_checkpoint.collections) {
+    m_files.push_back(std::make_unique<ColumnarFileReader>(
+        joinPaths(directory, collection.name + ".bin"),
+        BinaryColumns::specs(collection.type)));
+  }
+  ACTS_INFO("Replaying checkpoint '" << m_checkpoint.name << "' from "
+                                     << directory);
+}
+
+std::string ActsExamples::BinaryCheckpointReader::name() const {
+  return "BinaryCheckpointReader";
+}
+
+std::pair<size_t, size_t>
+ActsExamples::BinaryCheckpointReader::availableEvents() const {
+  std::pair<size_t, size_t> events = {0u, SIZE_MAX};
+  for (const auto& file : m_files) {
+    auto available = file->availableEvents();
+    events.first = std::max(events.first, available.first);
+    events.second = std::min(events.second, available.second);
+  }
+  events.second = std::max(events.first, events.second);
+  return events;
+}
+
+std::optional<ActsExamples::DataDependencies>
+ActsExamples::BinaryCheckpointReader::dataDependencies() const {
+  DataDependencies dependencies;
+  for (const auto& collection : m_checkpoint.collections) {
+    dependencies.outputs.push_back(collection.name);
+  }
+  return dependencies;
+}
+
+ActsExamples::ProcessCode ActsExamples::BinaryCheckpointReader::read(
+    const AlgorithmContext& ctx) {
+  using namespace BinaryColumns;
+  using Type = CheckpointCollectionType;
+
+  auto& store = ctx.eventStore;
+  for (size_t i = 0; i < m_files.size(); ++i) {
+    const auto& collection = m_checkpoint.collections[i];
+    const auto& name = collection.name;
+    auto event = m_files[i]->event(ctx.eventNumber);
+    switch (collection.type) {
+      case Type::Particles:
+        store.add(name, Particles::decode(event));
+        break;
+      case Type::SimHits:
+        store.add(name, SimHits::decode(event));
+        break;
+      case Type::Measurements: {
+        // the source links are stored separately if they are needed
+        IndexSourceLinkContainer sourceLinks;
+        store.add(name, Measurements::decode(event, sourceLinks));
+        break;
+      }
+      case Type::SourceLinks:
+        store.add(name, SourceLinks::decode(event));
+        break;
+      case Type::MeasurementParticlesMap:
+        store.add(name, MeasurementParticleLinks::decode(event));
+        break;
+      case Type::MeasurementSimHitsMap:
+        store.add(name, MeasurementSimHitLinks::decode(event));
+        break;
+      case Type::SpacePoints:
+        store.add(name, SpacePoints::decode(event));
+        break;
+      case Type::Seeds:
+        // the space points were added before and stay in place
+        store.add(name,
+                  Seeds::decode(event, store.get<SimSpacePointContainer>(
+                                           collection.spacePoints)));
+        break;
+      case Type::ProtoTracks:
+        store.add(name, ProtoTracks::decode(event));
+        break;
+    }
+  }
+  return ProcessCode::SUCCESS;
+}
@@ -0,0 +1,121 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/BinaryCheckpointWriter.hpp"
+
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Utilities/Paths.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+#include "BinaryColumns.hpp"
+
+ActsExamples::BinaryCheckpointWriter::BinaryCheckpointWriter(
+    const ActsExamples::BinaryCheckpoint& checkpoint, Acts::Logging::Level lvl)
+    : m_checkpoint(checkpoint),
+      m_logger(Acts::getDefaultLogger("BinaryCheckpointWriter", lvl)) {
+  m_checkpoint.checkConfig();
+  m_directory = ensureWritableDirectory(m_checkpoint.directory());
+  // an incomplete checkpoint must not be replayed if the run fails
+  std::remove(joinPaths(m_directory, "configuration.txt").c_str());
+  for (const auto& collection : m_checkpoint.collections) {
+    m_files.push_back(std::make_unique<ColumnarFileWriter>(
+        joinPaths(m_directory, collection.name + ".bin"),
+        BinaryColumns::specs(collection.type)));
+  }
+  ACTS_INFO("Writing checkpoint '" << m_checkpoint.name << "' to "
+                                   << m_directory);
+}
+
+std::string ActsExamples::BinaryCheckpointWriter::name() const {
+  return "BinaryCheckpointWriter";
+}
+
+std::optional<ActsExamples::DataDependencies>
+ActsExamples::BinaryCheckpointWriter::dataDependencies() const {
+  DataDependencies dependencies;
+  for (const auto& collection : m_checkpoint.collections) {
+    dependencies.inputs.push_back(collection.name);
+  }
+  return dependencies;
+}
+
+ActsExamples::ProcessCode ActsExamples::BinaryCheckpointWriter::write(
+    const AlgorithmContext& ctx) {
+  using namespace BinaryColumns;
+  using Type = CheckpointCollectionType;
+
+  const auto& store = ctx.eventStore;
+  std::vector<ColumnValues> columns;
+  columns.reserve(m_checkpoint.collections.size());
+  for (const auto& collection : m_checkpoint.collections) {
+    const auto& name = collection.name;
+    switch (collection.type) {
+      case Type::Particles:
+        columns.push_back(
+            Particles::encode(store.get<SimParticleContainer>(name)));
+        break;
+      case Type::SimHits:
+        columns.push_back(SimHits::encode(store.get<SimHitContainer>(name)));
+        break;
+      case Type::Measurements:
+        columns.push_back(
+            Measurements::encode(store.get<MeasurementContainer>(name)));
+        break;
+      case Type::SourceLinks:
+        columns.push_back(
+            SourceLinks::encode(store.get<IndexSourceLinkContainer>(name)));
+        break;
+      case Type::MeasurementParticlesMap:
+        columns.push_back(MeasurementParticleLinks::encode(
+            store.get<IndexMultimap<ActsFatras::Barcode>>(name)));
+        break;
+      case Type::MeasurementSimHitsMap:
+        columns.push_back(MeasurementSimHitLinks::encode(
+            store.get<IndexMultimap<Index>>(name)));
+        break;
+      case Type::SpacePoints:
+        columns.push_back(
+            SpacePoints::encode(store.get<SimSpacePointContainer>(name)));
+        break;
+      case Type::Seeds:
+        columns.push_back(Seeds::encode(
+            store.get<SimSeedContainer>(name),
+            store.get<SimSpacePointContainer>(collection.spacePoints)));
+        break;
+      case Type::ProtoTracks:
+        columns.push_back(
+            ProtoTracks::encode(store.get<ProtoTrackContainer>(name)));
+        break;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  for (size_t i = 0; i < m_files.size(); ++i) {
+    m_files[i]->writeEvent(ctx.eventNumber, columns[i].data());
+  }
+  return ProcessCode::SUCCESS;
+}
+
+ActsExamples::ProcessCode ActsExamples::BinaryCheckpointWriter::endRun() {
+  for (auto& file : m_files) {
+    file->close();
+  }
+  // only a complete checkpoint is replayed by later runs
+  std::ofstream configuration(joinPaths(m_directory, "configuration.txt"));
+  configuration << m_checkpoint.configuration;
+  if (not configuration) {
+    ACTS_ERROR("Could not mark checkpoint '" << m_checkpoint.name
+                                             << "' as complete");
+    return ProcessCode::ABORT;
+  }
+  ACTS_INFO("Stored checkpoint '" << m_checkpoint.name << "'");
+  return ProcessCode::SUCCESS;
+}
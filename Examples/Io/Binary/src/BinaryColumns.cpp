@@ -0,0 +1,527 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "BinaryColumns.hpp"
+
+#include "ActsExamples/Digitization/MeasurementCreation.hpp"
+
+#include <array>
+#include <limits>
+#include <stdexcept>
+
+namespace ActsExamples {
+namespace BinaryColumns {
+
+ColumnValues::ColumnValues(const std::vector<ColumnSpec>& specs) {
+  m_columns.reserve(specs.size());
+  for (const auto& spec : specs) {
+    switch (spec.type) {
+      case ColumnType::UInt8:
+        m_columns.emplace_back(std::vector<uint8_t>());
+        break;
+      case ColumnType::Int32:
+        m_columns.emplace_back(std::vector<int32_t>());
+        break;
+      case ColumnType::UInt32:
+        m_columns.emplace_back(std::vector<uint32_t>());
+        break;
+      case ColumnType::UInt64:
+        m_columns.emplace_back(std::vector<uint64_t>());
+        break;
+      case ColumnType::Float32:
+        m_columns.emplace_back(std::vector<float>());
+        break;
+      case ColumnType::Float64:
+        m_columns.emplace_back(std::vector<double>());
+        break;
+    }
+  }
+}
+
+std::vector<ColumnData> ColumnValues::data() const {
+  std::vector<ColumnData> columns;
+  columns.reserve(m_columns.size());
+  for (const auto& values : m_columns) {
+    std::visit([&](const auto& v) { columns.emplace_back(v); }, values);
+  }
+  return columns;
+}
+
+ColumnValues Particles::encode(const SimParticleContainer& particles) {
+  ColumnValues columns(specs());
+  auto& particleId = columns.column<uint64_t>(ParticleId);
+  auto& particleType = columns.column<int32_t>(ParticleType);
+  auto& process = columns.column<uint32_t>(Process);
+  auto& x = columns.column<double>(X);
+  auto& y = columns.column<double>(Y);
+  auto& z = columns.column<double>(Z);
+  auto& t = columns.column<double>(T);
+  auto& dx = columns.column<double>(Dx);
+  auto& dy = columns.column<double>(Dy);
+  auto& dz = columns.column<double>(Dz);
+  auto& p = columns.column<double>(Momentum);
+  auto& m = columns.column<double>(Mass);
+  auto& q = columns.column<double>(Charge);
+  auto& properTime = columns.column<double>(ProperTime);
+  auto& pathInX0 = columns.column<double>(PathInX0);
+  auto& pathInL0 = columns.column<double>(PathInL0);
+  for (const auto& particle : particles) {
+    particleId.push_back(particle.particleId().value());
+    particleType.push_back(particle.pdg());
+    process.push_back(static_cast<uint32_t>(particle.process()));
+    x.push_back(particle.fourPosition()[Acts::ePos0]);
+    y.push_back(particle.fourPosition()[Acts::ePos1]);
+    z.push_back(particle.fourPosition()[Acts::ePos2]);
+    t.push_back(particle.fourPosition()[Acts::eTime]);
+    dx.push_back(particle.unitDirection()[Acts::ePos0]);
+    dy.push_back(particle.unitDirection()[Acts::ePos1]);
+    dz.push_back(particle.unitDirection()[Acts::ePos2]);
+    p.push_back(particle.absoluteMomentum());
+    m.push_back(particle.mass());
+    q.push_back(particle.charge());
+    properTime.push_back(particle.properTime());
+    pathInX0.push_back(particle.pathInX0());
+    pathInL0.push_back(particle.pathInL0());
+  }
+  return columns;
+}
+
+SimParticleContainer Particles::decode(const EventView& event) {
+  auto particleId = event.column<uint64_t>(ParticleId).begin();
+  auto particleType = event.column<int32_t>(ParticleType).begin();
+  auto process = event.column<uint32_t>(Process).begin();
+  auto x = event.column<double>(X).begin();
+  auto y = event.column<double>(Y).begin();
+  auto z = event.column<double>(Z).begin();
+  auto t = event.column<double>(T).begin();
+  auto dx = event.column<double>(Dx).begin();
+  auto dy = event.column<double>(Dy).begin();
+  auto dz = event.column<double>(Dz).begin();
+  auto p = event.column<double>(Momentum).begin();
+  auto m = event.column<double>(Mass).begin();
+  auto q = event.column<double>(Charge).begin();
+  auto properTime = event.column<double>(ProperTime).begin();
+  auto pathInX0 = event.column<double>(PathInX0).begin();
+  auto pathInL0 = event.column<double>(PathInL0).begin();
+
+  SimParticleContainer::sequence_type sequence;
+  sequence.reserve(event.size());
+  for (size_t i = 0; i < event.size(); ++i) {
+    ActsFatras::Particle particle(ActsFatras::Barcode(particleId[i]),
+                                  Acts::PdgParticle(particleType[i]), q[i],
+                                  m[i]);
+    particle.setProcess(static_cast<ActsFatras::ProcessType>(process[i]));
+    particle.setPosition4(x[i], y[i], z[i], t[i]);
+    particle.setDirection(dx[i], dy[i], dz[i]);
+    particle.setAbsoluteMomentum(p[i]);
+    particle.setProperTime(properTime[i]);
+    particle.setMaterialPassed(pathInX0[i], pathInL0[i]);
+    sequence.push_back(std::move(particle));
+  }
+
+  // the particles were written in container order and need no sorting
+  SimParticleContainer particles;
+  particles.adopt_sequence(boost::container::ordered_unique_range,
+                           std::move(sequence));
+  return particles;
+}
+
+ColumnValues SimHits::encode(const SimHitContainer& simHits) {
+  ColumnValues columns(specs());
+  auto& geometryId = columns.column<uint64_t>(GeometryId);
+  auto& particleId = columns.column<uint64_t>(ParticleId);
+  auto& index = columns.column<int32_t>(Index);
+  auto& x = columns.column<double>(X);
+  auto& y = columns.column<double>(Y);
+  auto& z = columns.column<double>(Z);
+  auto& t = columns.column<double>(T);
+  auto& px = columns.column<double>(Px);
+  auto& py = columns.column<double>(Py);
+  auto& pz = columns.column<double>(Pz);
+  auto& e = columns.column<double>(E);
+  auto& pxAfter = columns.column<double>(PxAfter);
+  auto& pyAfter = columns.column<double>(PyAfter);
+  auto& pzAfter = columns.column<double>(PzAfter);
+  auto& eAfter = columns.column<double>(EAfter);
+  for (const auto& hit : simHits) {
+    geometryId.push_back(hit.geometryId().value());
+    particleId.push_back(hit.particleId().value());
+    index.push_back(hit.index());
+    x.push_back(hit.fourPosition()[Acts::ePos0]);
+    y.push_back(hit.fourPosition()[Acts::ePos1]);
+    z.push_back(hit.fourPosition()[Acts::ePos2]);
+    t.push_back(hit.fourPosition()[Acts::eTime]);
+    px.push_back(hit.momentum4Before()[Acts::eMom0]);
+    py.push_back(hit.momentum4Before()[Acts::eMom1]);
+    pz.push_back(hit.momentum4Before()[Acts::eMom2]);
+    e.push_back(hit.momentum4Before()[Acts::eEnergy]);
+    pxAfter.push_back(hit.momentum4After()[Acts::eMom0]);
+    pyAfter.push_back(hit.momentum4After()[Acts::eMom1]);
+    pzAfter.push_back(hit.momentum4After()[Acts::eMom2]);
+    eAfter.push_back(hit.momentum4After()[Acts::eEnergy]);
+  }
+  return columns;
+}
+
+SimHitContainer SimHits::decode(const EventView& event) {
+  auto geometryId = event.column<uint64_t>(GeometryId).begin();
+  auto particleId = event.column<uint64_t>(ParticleId).begin();
+  auto index = event.column<int32_t>(Index).begin();
+  auto x = event.column<double>(X).begin();
+  auto y = event.column<double>(Y).begin();
+  auto z = event.column<double>(Z).begin();
+  auto t = event.column<double>(T).begin();
+  auto px = event.column<double>(Px).begin();
+  auto py = event.column<double>(Py).begin();
+  auto pz = event.column<double>(Pz).begin();
+  auto e = event.column<double>(E).begin();
+  auto pxAfter = event.column<double>(PxAfter).begin();
+  auto pyAfter = event.column<double>(PyAfter).begin();
+  auto pzAfter = event.column<double>(PzAfter).begin();
+  auto eAfter = event.column<double>(EAfter).begin();
+
+  SimHitContainer::sequence_type sequence;
+  sequence.reserve(event.size());
+  for (size_t i = 0; i < event.size(); ++i) {
+    sequence.emplace_back(Acts::GeometryIdentifier(geometryId[i]),
+                          ActsFatras::Barcode(particleId[i]),
+                          ActsFatras::Hit::Vector4(x[i], y[i], z[i], t[i]),
+                          ActsFatras::Hit::Vector4(px[i], py[i], pz[i], e[i]),
+                          ActsFatras::Hit::Vector4(pxAfter[i], pyAfter[i],
+                                                   pzAfter[i], eAfter[i]),
+                          index[i]);
+  }
+
+  // the hits were written in container order and need no sorting
+  SimHitContainer simHits;
+  simHits.adopt_sequence(boost::container::ordered_range, std::move(sequence));
+  return simHits;
+}
+
+ColumnValues Measurements::encode(const MeasurementContainer& measurements) {
+  ColumnValues columns(specs());
+  auto& geometryId = columns.column<uint64_t>(GeometryId);
+  auto& parameterMask = columns.column<uint8_t>(ParameterMask);
+  // the value and variance columns follow the bound parameter order
+  std::array<std::vector<double>*, Acts::eBoundSize> values;
+  std::array<std::vector<double>*, Acts::eBoundSize> variances;
+  for (size_t ipar = 0; ipar < Acts::eBoundSize; ++ipar) {
+    values[ipar] = &columns.column<double>(Loc0 + ipar);
+    variances[ipar] = &columns.column<double>(VarLoc0 + ipar);
+  }
+  for (const auto& measurement : measurements) {
+    std::visit(
+        [&](const auto& m) {
+          geometryId.push_back(m.sourceLink().geometryId().value());
+          // expand to the full set of parameters; unmeasured ones are zero
+          Acts::BoundVector parameters = m.expander() * m.parameters();
+          Acts::BoundSymMatrix covariance =
+              m.expander() * m.covariance() * m.expander().transpose();
+          uint8_t mask = 0;
+          for (unsigned int ipar = 0;
+               ipar < static_cast<unsigned int>(Acts::eBoundSize); ++ipar) {
+            if (m.contains(static_cast<Acts::BoundIndices>(ipar))) {
+              mask |= (1u << ipar);
+            }
+            values[ipar]->push_back(parameters[ipar]);
+            variances[ipar]->push_back(covariance(ipar, ipar));
+          }
+          parameterMask.push_back(mask);
+        },
+        measurement);
+  }
+  return columns;
+}
+
+MeasurementContainer Measurements::decode(
+    const EventView& event, IndexSourceLinkContainer& sourceLinks) {
+  auto geometryId = event.column<uint64_t>(GeometryId).begin();
+  auto parameterMask = event.column<uint8_t>(ParameterMask).begin();
+  std::array<const double*, Acts::eBoundSize> values;
+  std::array<const double*, Acts::eBoundSize> variances;
+  for (size_t ipar = 0; ipar < Acts::eBoundSize; ++ipar) {
+    values[ipar] = event.column<double>(Loc0 + ipar).begin();
+    variances[ipar] = event.column<double>(VarLoc0 + ipar).begin();
+  }
+
+  MeasurementContainer measurements;
+  measurements.reserve(event.size());
+  sourceLinks.reserve(sourceLinks.size() + event.size());
+  DigitizedParameters dParameters;
+  for (Index imeas = 0; imeas < event.size(); ++imeas) {
+    dParameters.indices.clear();
+    dParameters.values.clear();
+    dParameters.variances.clear();
+    for (size_t ipar = 0; ipar < Acts::eBoundSize; ++ipar) {
+      if (parameterMask[imeas] & (1u << ipar)) {
+        dParameters.indices.push_back(static_cast<Acts::BoundIndices>(ipar));
+        dParameters.values.push_back(values[ipar][imeas]);
+        dParameters.variances.push_back(variances[ipar][imeas]);
+      }
+    }
+    IndexSourceLink sourceLink(Acts::GeometryIdentifier(geometryId[imeas]),
+                               imeas);
+    measurements.push_back(createMeasurement(dParameters, sourceLink));
+    sourceLinks.emplace_hint(sourceLinks.end(), std::move(sourceLink));
+  }
+  return measurements;
+}
+
+ColumnValues MeasurementSimHitLinks::encode(const IndexMultimap<Index>& links) {
+  ColumnValues columns(specs());
+  auto& measurementId = columns.column<uint32_t>(MeasurementId);
+  auto& hitId = columns.column<uint32_t>(HitId);
+  for (auto [measurement, hit] : links) {
+    measurementId.push_back(measurement);
+    hitId.push_back(hit);
+  }
+  return columns;
+}
+
+IndexMultimap<Index> MeasurementSimHitLinks::decode(const EventView& event) {
+  auto measurementId = event.column<uint32_t>(MeasurementId).begin();
+  auto hitId = event.column<uint32_t>(HitId).begin();
+  IndexMultimap<Index> links;
+  links.reserve(event.size());
+  for (size_t i = 0; i < event.size(); ++i) {
+    links.emplace_hint(links.end(), measurementId[i], hitId[i]);
+  }
+  return links;
+}
+
+ColumnValues Cells::encode(const ClusterContainer& clusters) {
+  ColumnValues columns(specs());
+  auto& measurementId = columns.column<uint32_t>(MeasurementId);
+  auto& sizeLoc0 = columns.column<uint32_t>(SizeLoc0);
+  auto& sizeLoc1 = columns.column<uint32_t>(SizeLoc1);
+  auto& channel0 = columns.column<uint32_t>(Channel0);
+  auto& channel1 = columns.column<uint32_t>(Channel1);
+  auto& activation = columns.column<double>(Activation);
+  for (Index imeas = 0; imeas < clusters.size(); ++imeas) {
+    const auto& cluster = clusters[imeas];
+    for (const auto& cell : cluster.channels) {
+      measurementId.push_back(imeas);
+      sizeLoc0.push_back(cluster.sizeLoc0);
+      sizeLoc1.push_back(cluster.sizeLoc1);
+      channel0.push_back(cell.bin[0]);
+      channel1.push_back(cell.bin[1]);
+      activation.push_back(cell.activation);
+    }
+  }
+  return columns;
+}
+
+ClusterContainer Cells::decode(const EventView& event, size_t nClusters) {
+  auto measurementId = event.column<uint32_t>(MeasurementId).begin();
+  auto sizeLoc0 = event.column<uint32_t>(SizeLoc0).begin();
+  auto sizeLoc1 = event.column<uint32_t>(SizeLoc1).begin();
+  auto channel0 = event.column<uint32_t>(Channel0).begin();
+  auto channel1 = event.column<uint32_t>(Channel1).begin();
+  auto activation = event.column<double>(Activation).begin();
+
+  // one cluster per measurement
+  ClusterContainer clusters(nClusters);
+  for (size_t i = 0; i < event.size(); ++i) {
+    Cluster& cluster = clusters.at(measurementId[i]);
+    cluster.sizeLoc0 = sizeLoc0[i];
+    cluster.sizeLoc1 = sizeLoc1[i];
+    // the path of the particle through the cell is not stored
+    cluster.channels.emplace_back(
+        ActsFatras::Channelizer::Bin2D{channel0[i], channel1[i]},
+        ActsFatras::Channelizer::Segment2D{Acts::Vector2::Zero(),
+                                           Acts::Vector2::Zero()},
+        activation[i]);
+  }
+  return clusters;
+}
+
+ColumnValues SourceLinks::encode(const IndexSourceLinkContainer& sourceLinks) {
+  ColumnValues columns(specs());
+  auto& geometryId = columns.column<uint64_t>(GeometryId);
+  auto& measurementId = columns.column<uint32_t>(MeasurementId);
+  for (const auto& sourceLink : sourceLinks) {
+    geometryId.push_back(sourceLink.geometryId().value());
+    measurementId.push_back(sourceLink.index());
+  }
+  return columns;
+}
+
+IndexSourceLinkContainer SourceLinks::decode(const EventView& event) {
+  auto geometryId = event.column<uint64_t>(GeometryId).begin();
+  auto measurementId = event.column<uint32_t>(MeasurementId).begin();
+  IndexSourceLinkContainer::sequence_type sequence;
+  sequence.reserve(event.size());
+  for (size_t i = 0; i < event.size(); ++i) {
+    sequence.emplace_back(Acts::GeometryIdentifier(geometryId[i]),
+                          measurementId[i]);
+  }
+  // the source links were written in container order and need no sorting
+  IndexSourceLinkContainer sourceLinks;
+  sourceLinks.adopt_sequence(boost::container::ordered_range,
+                             std::move(sequence));
+  return sourceLinks;
+}
+
+ColumnValues MeasurementParticleLinks::encode(
+    const IndexMultimap<ActsFatras::Barcode>& links) {
+  ColumnValues columns(specs());
+  auto& measurementId = columns.column<uint32_t>(MeasurementId);
+  auto& particleId = columns.column<uint64_t>(ParticleId);
+  for (auto [measurement, particle] : links) {
+    measurementId.push_back(measurement);
+    particleId.push_back(particle.value());
+  }
+  return columns;
+}
+
+IndexMultimap<ActsFatras::Barcode> MeasurementParticleLinks::decode(
+    const EventView& event) {
+  auto measurementId = event.column<uint32_t>(MeasurementId).begin();
+  auto particleId = event.column<uint64_t>(ParticleId).begin();
+  IndexMultimap<ActsFatras::Barcode> links;
+  links.reserve(event.size());
+  for (size_t i = 0; i < event.size(); ++i) {
+    links.emplace_hint(links.end(), measurementId[i],
+                       ActsFatras::Barcode(particleId[i]));
+  }
+  return links;
+}
+
+ColumnValues SpacePoints::encode(const SimSpacePointContainer& spacePoints) {
+  ColumnValues columns(specs());
+  auto& x = columns.column<float>(X);
+  auto& y = columns.column<float>(Y);
+  auto& z = columns.column<float>(Z);
+  auto& varR = columns.column<float>(VarR);
+  auto& varZ = columns.column<float>(VarZ);
+  auto& measurementId = columns.column<uint32_t>(MeasurementId);
+  for (const auto& spacePoint : spacePoints) {
+    x.push_back(spacePoint.x());
+    y.push_back(spacePoint.y());
+    z.push_back(spacePoint.z());
+    varR.push_back(spacePoint.varianceR());
+    varZ.push_back(spacePoint.varianceZ());
+    measurementId.push_back(spacePoint.measurementIndex());
+  }
+  return columns;
+}
+
+SimSpacePointContainer SpacePoints::decode(const EventView& event) {
+  auto x = event.column<float>(X).begin();
+  auto y = event.column<float>(Y).begin();
+  auto z = event.column<float>(Z).begin();
+  auto varR = event.column<float>(VarR).begin();
+  auto varZ = event.column<float>(VarZ).begin();
+  auto measurementId = event.column<uint32_t>(MeasurementId).begin();
+  SimSpacePointContainer spacePoints;
+  spacePoints.reserve(event.size());
+  for (size_t i = 0; i < event.size(); ++i) {
+    spacePoints.emplace_back(Acts::Vector3(x[i], y[i], z[i]), varR[i],
+                             varZ[i], measurementId[i]);
+  }
+  return spacePoints;
+}
+
+ColumnValues Seeds::encode(const SimSeedContainer& seeds,
+                           const SimSpacePointContainer& spacePoints) {
+  ColumnValues columns(specs());
+  std::array<std::vector<uint32_t>*, 3> positions = {
+      &columns.column<uint32_t>(Bottom),
+      &columns.column<uint32_t>(Middle),
+      &columns.column<uint32_t>(Top),
+  };
+  auto& zVertex = columns.column<float>(ZVertex);
+  for (const auto& seed : seeds) {
+    for (size_t isp = 0; isp < positions.size(); ++isp) {
+      const SimSpacePoint* spacePoint = seed.sp().at(isp);
+      if (spacePoint < spacePoints.data() or
+          spacePoints.data() + spacePoints.size() <= spacePoint) {
+        throw std::invalid_argument(
+            "Seed space point is not in the space point collection");
+      }
+      positions[isp]->push_back(spacePoint - spacePoints.data());
+    }
+    zVertex.push_back(seed.z());
+  }
+  return columns;
+}
+
+SimSeedContainer Seeds::decode(const EventView& event,
+                               const SimSpacePointContainer& spacePoints) {
+  auto bottom = event.column<uint32_t>(Bottom).begin();
+  auto middle = event.column<uint32_t>(Middle).begin();
+  auto top = event.column<uint32_t>(Top).begin();
+  auto zVertex = event.column<float>(ZVertex).begin();
+  SimSeedContainer seeds;
+  seeds.reserve(event.size());
+  for (size_t i = 0; i < event.size(); ++i) {
+    seeds.emplace_back(spacePoints.at(bottom[i]), spacePoints.at(middle[i]),
+                       spacePoints.at(top[i]), zVertex[i]);
+  }
+  return seeds;
+}
+
+ColumnValues ProtoTracks::encode(const ProtoTrackContainer& protoTracks) {
+  ColumnValues columns(specs());
+  auto& trackId = columns.column<uint32_t>(TrackId);
+  auto& measurementId = columns.column<uint32_t>(MeasurementId);
+  for (Index itrack = 0; itrack < protoTracks.size(); ++itrack) {
+    const auto& protoTrack = protoTracks[itrack];
+    if (protoTrack.empty()) {
+      trackId.push_back(itrack);
+      measurementId.push_back(std::numeric_limits<Index>::max());
+    }
+    for (auto measurement : protoTrack) {
+      trackId.push_back(itrack);
+      measurementId.push_back(measurement);
+    }
+  }
+  return columns;
+}
+
+ProtoTrackContainer ProtoTracks::decode(const EventView& event) {
+  auto trackId = event.column<uint32_t>(TrackId).begin();
+  auto measurementId = event.column<uint32_t>(MeasurementId).begin();
+  ProtoTrackContainer protoTracks;
+  for (size_t i = 0; i < event.size(); ++i) {
+    if (protoTracks.size() <= trackId[i]) {
+      protoTracks.resize(trackId[i] + 1u);
+    }
+    if (measurementId[i] != std::numeric_limits<Index>::max()) {
+      protoTracks[trackId[i]].push_back(measurementId[i]);
+    }
+  }
+  return protoTracks;
+}
+
+std::vector<ColumnSpec> specs(CheckpointCollectionType type) {
+  switch (type) {
+    case CheckpointCollectionType::Particles:
+      return Particles::specs();
+    case CheckpointCollectionType::SimHits:
+      return SimHits::specs();
+    case CheckpointCollectionType::Measurements:
+      return Measurements::specs();
+    case CheckpointCollectionType::SourceLinks:
+      return SourceLinks::specs();
+    case CheckpointCollectionType::MeasurementParticlesMap:
+      return MeasurementParticleLinks::specs();
+    case CheckpointCollectionType::MeasurementSimHitsMap:
+      return MeasurementSimHitLinks::specs();
+    case CheckpointCollectionType::SpacePoints:
+      return SpacePoints::specs();
+    case CheckpointCollectionType::Seeds:
+      return Seeds::specs();
+    case CheckpointCollectionType::ProtoTracks:
+      return ProtoTracks::specs();
+  }
+  throw std::invalid_argument("Unknown checkpoint collection type");
+}
+
+}  // namespace BinaryColumns
+}  // namespace ActsExamples
@@ -0,0 +1,342 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+/// @file
+/// @brief Column layouts of the binary event data files
+
+#pragma once
+
+#include "ActsExamples/EventData/Cluster.hpp"
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/ProtoTrack.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/EventData/SimSeed.hpp"
+#include "ActsExamples/EventData/SimSpacePoint.hpp"
+#include "ActsExamples/Io/Binary/BinaryCheckpoint.hpp"
+#include "ActsExamples/Io/Binary/ColumnarFile.hpp"
+#include "ActsFatras/EventData/Barcode.hpp"
+
+#include <variant>
+#include <vector>
+
+namespace ActsExamples {
+namespace BinaryColumns {
+
+// All values are stored in the native units without conversion. Every layout
+// encodes one event of its collection into column values that can be written
+// directly and decodes the collection from the columns of a read event.
+
+using EventView = ColumnarFileReader::EventView;
+
+/// Owned values of all columns of one event.
+class ColumnValues {
+ public:
+  /// Create empty columns of the given types.
+  ColumnValues(const std::vector<ColumnSpec>& specs);
+
+  /// Values of one column.
+  ///
+  /// @tparam T value type that must match the column type
+  template <typename T>
+  std::vector<T>& column(size_t icolumn) {
+    return std::get<std::vector<T>>(m_columns.at(icolumn));
+  }
+
+  /// Type-erased access to all columns, valid while the values exist.
+  std::vector<ColumnData> data() const;
+
+ private:
+  using Values =
+      std::variant<std::vector<uint8_t>, std::vector<int32_t>,
+                   std::vector<uint32_t>, std::vector<uint64_t>,
+                   std::vector<float>, std::vector<double>>;
+
+  std::vector<Values> m_columns;
+};
+
+/// One row per particle, ordered by particle identifier.
+struct Particles {
+  enum : size_t {
+    ParticleId,
+    ParticleType,
+    Process,
+    X,
+    Y,
+    Z,
+    T,
+    Dx,
+    Dy,
+    Dz,
+    Momentum,
+    Mass,
+    Charge,
+    ProperTime,
+    PathInX0,
+    PathInL0,
+  };
+  static std::vector<ColumnSpec> specs() {
+    return {
+        {"particle_id", ColumnType::UInt64},
+        {"particle_type", ColumnType::Int32},
+        {"process", ColumnType::UInt32},
+        {"x", ColumnType::Float64},
+        {"y", ColumnType::Float64},
+        {"z", ColumnType::Float64},
+        {"t", ColumnType::Float64},
+        {"dx", ColumnType::Float64},
+        {"dy", ColumnType::Float64},
+        {"dz", ColumnType::Float64},
+        {"p", ColumnType::Float64},
+        {"m", ColumnType::Float64},
+        {"q", ColumnType::Float64},
+        {"proper_time", ColumnType::Float64},
+        {"path_in_x0", ColumnType::Float64},
+        {"path_in_l0", ColumnType::Float64},
+    };
+  }
+  static ColumnValues encode(const SimParticleContainer& particles);
+  static SimParticleContainer decode(const EventView& event);
+};
+
+/// One row per simulated hit, ordered by geometry identifier.
+struct SimHits {
+  enum : size_t {
+    GeometryId,
+    ParticleId,
+    Index,
+    X,
+    Y,
+    Z,
+    T,
+    // four-momentum before and after the interaction
+    Px,
+    Py,
+    Pz,
+    E,
+    PxAfter,
+    PyAfter,
+    PzAfter,
+    EAfter,
+  };
+  static std::vector<ColumnSpec> specs() {
+    return {
+        {"geometry_id", ColumnType::UInt64},
+        {"particle_id", ColumnType::UInt64},
+        {"index", ColumnType::Int32},
+        {"x", ColumnType::Float64},
+        {"y", ColumnType::Float64},
+        {"z", ColumnType::Float64},
+        {"t", ColumnType::Float64},
+        {"px", ColumnType::Float64},
+        {"py", ColumnType::Float64},
+        {"pz", ColumnType::Float64},
+        {"e", ColumnType::Float64},
+        {"px_after", ColumnType::Float64},
+        {"py_after", ColumnType::Float64},
+        {"pz_after", ColumnType::Float64},
+        {"e_after", ColumnType::Float64},
+    };
+  }
+  static ColumnValues encode(const SimHitContainer& simHits);
+  static SimHitContainer decode(const EventView& event);
+};
+
+/// One row per measurement, the row number is the measurement index.
+///
+/// Only the measured parameters are set; the bit `1 << i` of the parameter
+/// mask is set if the bound parameter `i` is measured.
+struct Measurements {
+  enum : size_t {
+    GeometryId,
+    ParameterMask,
+    // values and variances of the bound parameters
+    Loc0,
+    Loc1,
+    Phi,
+    Theta,
+    QOverP,
+    Time,
+    VarLoc0,
+    VarLoc1,
+    VarPhi,
+    VarTheta,
+    VarQOverP,
+    VarTime,
+  };
+  static std::vector<ColumnSpec> specs() {
+    return {
+        {"geometry_id", ColumnType::UInt64},
+        {"parameter_mask", ColumnType::UInt8},
+        {"loc0", ColumnType::Float64},
+        {"loc1", ColumnType::Float64},
+        {"phi", ColumnType::Float64},
+        {"theta", ColumnType::Float64},
+        {"qop", ColumnType::Float64},
+        {"time", ColumnType::Float64},
+        {"var_loc0", ColumnType::Float64},
+        {"var_loc1", ColumnType::Float64},
+        {"var_phi", ColumnType::Float64},
+        {"var_theta", ColumnType::Float64},
+        {"var_qop", ColumnType::Float64},
+        {"var_time", ColumnType::Float64},
+    };
+  }
+  static ColumnValues encode(const MeasurementContainer& measurements);
+  /// Decode the measurements and the source links they refer to.
+  static MeasurementContainer decode(const EventView& event,
+                                     IndexSourceLinkContainer& sourceLinks);
+};
+
+/// One row per pair of measurement and simulated hit.
+struct MeasurementSimHitLinks {
+  enum : size_t {
+    MeasurementId,
+    HitId,
+  };
+  static std::vector<ColumnSpec> specs() {
+    return {
+        {"measurement_id", ColumnType::UInt32},
+        {"hit_id", ColumnType::UInt32},
+    };
+  }
+  static ColumnValues encode(const IndexMultimap<Index>& links);
+  static IndexMultimap<Index> decode(const EventView& event);
+};
+
+/// One row per cell, ordered by measurement. The cluster sizes are repeated
+/// for all cells of a cluster.
+struct Cells {
+  enum : size_t {
+    MeasurementId,
+    SizeLoc0,
+    SizeLoc1,
+    Channel0,
+    Channel1,
+    Activation,
+  };
+  static std::vector<ColumnSpec> specs() {
+    return {
+        {"measurement_id", ColumnType::UInt32},
+        {"size_loc0", ColumnType::UInt32},
+        {"size_loc1", ColumnType::UInt32},
+        {"channel0", ColumnType::UInt32},
+        {"channel1", ColumnType::UInt32},
+        {"activation", ColumnType::Float64},
+    };
+  }
+  static ColumnValues encode(const ClusterContainer& clusters);
+  /// Decode the clusters of the given number of measurements.
+  static ClusterContainer decode(const EventView& event, size_t nClusters);
+};
+
+/// One row per source link, ordered by geometry identifier.
+struct SourceLinks {
+  enum : size_t {
+    GeometryId,
+    MeasurementId,
+  };
+  static std::vector<ColumnSpec> specs() {
+    return {
+        {"geometry_id", ColumnType::UInt64},
+        {"measurement_id", ColumnType::UInt32},
+    };
+  }
+  static ColumnValues encode(const IndexSourceLinkContainer& sourceLinks);
+  static IndexSourceLinkContainer decode(const EventView& event);
+};
+
+/// One row per pair of measurement and particle.
+struct MeasurementParticleLinks {
+  enum : size_t {
+    MeasurementId,
+    ParticleId,
+  };
+  static std::vector<ColumnSpec> specs() {
+    return {
+        {"measurement_id", ColumnType::UInt32},
+        {"particle_id", ColumnType::UInt64},
+    };
+  }
+  static ColumnValues encode(const IndexMultimap<ActsFatras::Barcode>& links);
+  static IndexMultimap<ActsFatras::Barcode> decode(const EventView& event);
+};
+
+/// One row per space point, in container order.
+struct SpacePoints {
+  enum : size_t {
+    X,
+    Y,
+    Z,
+    VarR,
+    VarZ,
+    MeasurementId,
+  };
+  static std::vector<ColumnSpec> specs() {
+    return {
+        {"x", ColumnType::Float32},
+        {"y", ColumnType::Float32},
+        {"z", ColumnType::Float32},
+        {"var_r", ColumnType::Float32},
+        {"var_z", ColumnType::Float32},
+        {"measurement_id", ColumnType::UInt32},
+    };
+  }
+  static ColumnValues encode(const SimSpacePointContainer& spacePoints);
+  static SimSpacePointContainer decode(const EventView& event);
+};
+
+/// One row per seed, with the positions of its space points in the space
+/// point container.
+struct Seeds {
+  enum : size_t {
+    Bottom,
+    Middle,
+    Top,
+    ZVertex,
+  };
+  static std::vector<ColumnSpec> specs() {
+    return {
+        {"bottom", ColumnType::UInt32},
+        {"middle", ColumnType::UInt32},
+        {"top", ColumnType::UInt32},
+        {"z_vertex", ColumnType::Float32},
+    };
+  }
+  /// @throws std::invalid_argument if a seed uses other space points
+  static ColumnValues encode(const SimSeedContainer& seeds,
+                             const SimSpacePointContainer& spacePoints);
+  /// @param spacePoints Space points the seeds refer to, must outlive them
+  static SimSeedContainer decode(const EventView& event,
+                                 const SimSpacePointContainer& spacePoints);
+};
+
+/// One row per measurement of a proto track, ordered by track. Empty tracks
+/// are stored as a single row with an invalid measurement index.
+struct ProtoTracks {
+  enum : size_t {
+    TrackId,
+    MeasurementId,
+  };
+  static std::vector<ColumnSpec> specs() {
+    return {
+        {"track_id", ColumnType::UInt32},
+        {"measurement_id", ColumnType::UInt32},
+    };
+  }
+  static ColumnValues encode(const ProtoTrackContainer& protoTracks);
+  static ProtoTrackContainer decode(const EventView& event);
+};
+
+/// Column layout used to store a checkpoint collection of the given type.
+std::vector<ColumnSpec> specs(CheckpointCollectionType type);
+
+}  // namespace BinaryColumns
+}  // namespace ActsExamples
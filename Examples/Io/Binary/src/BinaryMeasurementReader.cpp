@@ -0,0 +1,89 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/BinaryMeasurementReader.hpp"
+
+#include "ActsExamples/EventData/Cluster.hpp"
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Utilities/Paths.hpp"
+
+#include <stdexcept>
+
+#include "BinaryColumns.hpp"
+
+ActsExamples::BinaryMeasurementReader::BinaryMeasurementReader(
+    const ActsExamples::BinaryMeasurementReader::Config& cfg,
+    Acts::Logging::Level lvl)
+    : m_cfg(cfg),
+      m_logger(Acts::getDefaultLogger("BinaryMeasurementReader", lvl)) {
+  if (m_cfg.outputMeasurements.empty()) {
+    throw std::invalid_argument("Missing measurement output collection");
+  }
+  if (m_cfg.outputMeasurementSimHitsMap.empty()) {
+    throw std::invalid_argument(
+        "Missing measurement-to-simulated-hits map output collection");
+  }
+  if (m_cfg.outputSourceLinks.empty()) {
+    throw std::invalid_argument("Missing source links output collection");
+  }
+  m_measurementsFile = std::make_unique<ColumnarFileReader>(
+      joinPaths(m_cfg.inputDir, "measurements.bin"),
+      BinaryColumns::Measurements::specs());
+  m_simHitLinksFile = std::make_unique<ColumnarFileReader>(
+      joinPaths(m_cfg.inputDir, "measurement-simhit-map.bin"),
+      BinaryColumns::MeasurementSimHitLinks::specs());
+  if (not m_cfg.outputClusters.empty()) {
+    m_cellsFile = std::make_unique<ColumnarFileReader>(
+        joinPaths(m_cfg.inputDir, "cells.bin"), BinaryColumns::Cells::specs());
+  }
+}
+
+std::string ActsExamples::BinaryMeasurementReader::name() const {
+  return "BinaryMeasurementReader";
+}
+
+std::pair<size_t, size_t>
+ActsExamples::BinaryMeasurementReader::availableEvents() const {
+  return m_measurementsFile->availableEvents();
+}
+
+std::optional<ActsExamples::DataDependencies>
+ActsExamples::BinaryMeasurementReader::dataDependencies() const {
+  DataDependencies dependencies{{},
+                                {m_cfg.outputMeasurements,
+                                 m_cfg.outputMeasurementSimHitsMap,
+                                 m_cfg.outputSourceLinks}};
+  if (not m_cfg.outputClusters.empty()) {
+    dependencies.outputs.push_back(m_cfg.outputClusters);
+  }
+  return dependencies;
+}
+
+ActsExamples::ProcessCode ActsExamples::BinaryMeasurementReader::read(
+    const ActsExamples::AlgorithmContext& ctx) {
+  auto event = m_measurementsFile->event(ctx.eventNumber);
+  IndexSourceLinkContainer sourceLinks;
+  auto measurements = BinaryColumns::Measurements::decode(event, sourceLinks);
+  auto measurementSimHitsMap = BinaryColumns::MeasurementSimHitLinks::decode(
+      m_simHitLinksFile->event(ctx.eventNumber));
+
+  if (m_cellsFile) {
+    ctx.eventStore.add(m_cfg.outputClusters,
+                       BinaryColumns::Cells::decode(
+                           m_cellsFile->event(ctx.eventNumber), event.size()));
+  }
+  ctx.eventStore.add(m_cfg.outputMeasurements, std::move(measurements));
+  ctx.eventStore.add(m_cfg.outputMeasurementSimHitsMap,
+                     std::move(measurementSimHitsMap));
+  ctx.eventStore.add(m_cfg.outputSourceLinks, std::move(sourceLinks));
+
+  return ActsExamples::ProcessCode::SUCCESS;
+}
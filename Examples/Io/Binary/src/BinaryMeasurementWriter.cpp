@@ -0,0 +1,74 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/BinaryMeasurementWriter.hpp"
+
+#include "ActsExamples/EventData/Cluster.hpp"
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Utilities/Paths.hpp"
+
+#include <optional>
+#include <stdexcept>
+
+#include "BinaryColumns.hpp"
+
+ActsExamples::BinaryMeasurementWriter::BinaryMeasurementWriter(
+    const ActsExamples::BinaryMeasurementWriter::Config& cfg,
+    Acts::Logging::Level lvl)
+    : WriterT(cfg.inputMeasurements, "BinaryMeasurementWriter", lvl),
+      m_cfg(cfg) {
+  // Input container for measurements is already checked by base constructor
+  if (m_cfg.inputMeasurementSimHitsMap.empty()) {
+    throw std::invalid_argument(
+        "Missing hit-to-simulated-hits map input collection");
+  }
+  m_measurementsFile = std::make_unique<ColumnarFileWriter>(
+      joinPaths(m_cfg.outputDir, "measurements.bin"),
+      BinaryColumns::Measurements::specs());
+  m_simHitLinksFile = std::make_unique<ColumnarFileWriter>(
+      joinPaths(m_cfg.outputDir, "measurement-simhit-map.bin"),
+      BinaryColumns::MeasurementSimHitLinks::specs());
+  if (not m_cfg.inputClusters.empty()) {
+    m_cellsFile = std::make_unique<ColumnarFileWriter>(
+        joinPaths(m_cfg.outputDir, "cells.bin"),
+        BinaryColumns::Cells::specs());
+  }
+}
+
+ActsExamples::ProcessCode ActsExamples::BinaryMeasurementWriter::endRun() {
+  m_measurementsFile->close();
+  m_simHitLinksFile->close();
+  if (m_cellsFile) {
+    m_cellsFile->close();
+  }
+  return ProcessCode::SUCCESS;
+}
+
+ActsExamples::ProcessCode ActsExamples::BinaryMeasurementWriter::writeT(
+    const AlgorithmContext& ctx, const MeasurementContainer& measurements) {
+  const auto& measurementSimHitsMap = ctx.eventStore.get<IndexMultimap<Index>>(
+      m_cfg.inputMeasurementSimHitsMap);
+
+  auto measurementColumns = BinaryColumns::Measurements::encode(measurements);
+  auto linkColumns =
+      BinaryColumns::MeasurementSimHitLinks::encode(measurementSimHitsMap);
+  std::optional<BinaryColumns::ColumnValues> cellColumns;
+  if (m_cellsFile) {
+    cellColumns = BinaryColumns::Cells::encode(
+        ctx.eventStore.get<ClusterContainer>(m_cfg.inputClusters));
+  }
+
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_measurementsFile->writeEvent(ctx.eventNumber, measurementColumns.data());
+  m_simHitLinksFile->writeEvent(ctx.eventNumber, linkColumns.data());
+  if (m_cellsFile) {
+    m_cellsFile->writeEvent(ctx.eventNumber, cellColumns->data());
+  }
+  return ProcessCode::SUCCESS;
+}
@@ -0,0 +1,56 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/BinaryParticleReader.hpp"
+
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Utilities/Paths.hpp"
+
+#include <stdexcept>
+
+#include "BinaryColumns.hpp"
+
+ActsExamples::BinaryParticleReader::BinaryParticleReader(
+    const ActsExamples::BinaryParticleReader::Config& cfg,
+    Acts::Logging::Level lvl)
+    : m_cfg(cfg),
+      m_logger(Acts::getDefaultLogger("BinaryParticleReader", lvl)) {
+  if (m_cfg.inputStem.empty()) {
+    throw std::invalid_argument("Missing input filename stem");
+  }
+  if (m_cfg.outputParticles.empty()) {
+    throw std::invalid_argument("Missing output collection");
+  }
+  m_file = std::make_unique<ColumnarFileReader>(
+      joinPaths(m_cfg.inputDir, m_cfg.inputStem + ".bin"),
+      BinaryColumns::Particles::specs());
+}
+
+std::string ActsExamples::BinaryParticleReader::name() const {
+  return "BinaryParticleReader";
+}
+
+std::pair<size_t, size_t> ActsExamples::BinaryParticleReader::availableEvents()
+    const {
+  return m_file->availableEvents();
+}
+
+std::optional<ActsExamples::DataDependencies>
+ActsExamples::BinaryParticleReader::dataDependencies() const {
+  return DataDependencies{{}, {m_cfg.outputParticles}};
+}
+
+ActsExamples::ProcessCode ActsExamples::BinaryParticleReader::read(
+    const ActsExamples::AlgorithmContext& ctx) {
+  auto event = m_file->event(ctx.eventNumber);
+  ctx.eventStore.add(m_cfg.outputParticles,
+                     BinaryColumns::Particles::decode(event));
+
+  return ProcessCode::SUCCESS;
+}
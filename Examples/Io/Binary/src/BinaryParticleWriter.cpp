@@ -0,0 +1,43 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/BinaryParticleWriter.hpp"
+
+#include "ActsExamples/Utilities/Paths.hpp"
+
+#include <stdexcept>
+
+#include "BinaryColumns.hpp"
+
+ActsExamples::BinaryParticleWriter::BinaryParticleWriter(
+    const ActsExamples::BinaryParticleWriter::Config& cfg,
+    Acts::Logging::Level lvl)
+    : WriterT(cfg.inputParticles, "BinaryParticleWriter", lvl), m_cfg(cfg) {
+  // inputParticles is already checked by base constructor
+  if (m_cfg.outputStem.empty()) {
+    throw std::invalid_argument("Missing ouput filename stem");
+  }
+  m_file = std::make_unique<ColumnarFileWriter>(
+      joinPaths(m_cfg.outputDir, m_cfg.outputStem + ".bin"),
+      BinaryColumns::Particles::specs());
+}
+
+ActsExamples::ProcessCode ActsExamples::BinaryParticleWriter::endRun() {
+  m_file->close();
+  return ProcessCode::SUCCESS;
+}
+
+ActsExamples::ProcessCode ActsExamples::BinaryParticleWriter::writeT(
+    const ActsExamples::AlgorithmContext& ctx,
+    const SimParticleContainer& particles) {
+  auto columns = BinaryColumns::Particles::encode(particles);
+
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  m_file->writeEvent(ctx.eventNumber, columns.data());
+  return ProcessCode::SUCCESS;
+}
@@ -0,0 +1,55 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/BinarySimHitReader.hpp"
+
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Utilities/Paths.hpp"
+
+#include <stdexcept>
+
+#include "BinaryColumns.hpp"
+
+ActsExamples::BinarySimHitReader::BinarySimHitReader(
+    const ActsExamples::BinarySimHitReader::Config& cfg,
+    Acts::Logging::Level lvl)
+    : m_cfg(cfg), m_logger(Acts::getDefaultLogger("BinarySimHitReader", lvl)) {
+  if (m_cfg.inputStem.empty()) {
+    throw std::invalid_argument("Missing input filename stem");
+  }
+  if (m_cfg.outputSimHits.empty()) {
+    throw std::invalid_argument("Missing simulated hits output collection");
+  }
+  m_file = std::make_unique<ColumnarFileReader>(
+      joinPaths(m_cfg.inputDir, m_cfg.inputStem + ".bin"),
+      BinaryColumns::SimHits::specs());
+}
+
+std::string ActsExamples::BinarySimHitReader::name() const {
+  return "BinarySimHitReader";
+}
+
+std::pair<size_t, size_t> ActsExamples::BinarySimHitReader::availableEvents()
+    const {
+  return m_file->availableEvents();
+}
+
+std::optional<ActsExamples::DataDependencies>
+ActsExamples::BinarySimHitReader::dataDependencies() const {
+  return DataDependencies{{}, {m_cfg.outputSimHits}};
+}
+
+ActsExamples::ProcessCode ActsExamples::BinarySimHitReader::read(
+    const ActsExamples::AlgorithmContext& ctx) {
+  auto event = m_file->event(ctx.eventNumber);
+  ctx.eventStore.add(m_cfg.outputSimHits,
+                     BinaryColumns::SimHits::decode(event));
+
+  return ProcessCode::SUCCESS;
+}
@@ -0,0 +1,251 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Binary/ColumnarFile.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+constexpr char kMagic[8] = {'A', 'C', 'T', 'S', 'C', 'O', 'L', 'F'};
+constexpr uint32_t kVersion = 1;
+constexpr size_t kAlignment = 8;
+// index offset, number of events, magic
+constexpr size_t kTrailerSize = 2 * sizeof(uint64_t) + sizeof(kMagic);
+
+size_t valueSize(ActsExamples::ColumnType type) {
+  switch (type) {
+    case ActsExamples::ColumnType::UInt8:
+      return 1;
+    case ActsExamples::ColumnType::Int32:
+    case ActsExamples::ColumnType::UInt32:
+    case ActsExamples::ColumnType::Float32:
+      return 4;
+    case ActsExamples::ColumnType::UInt64:
+    case ActsExamples::ColumnType::Float64:
+      return 8;
+  }
+  throw std::invalid_argument("Invalid column type");
+}
+
+size_t padded(size_t size) {
+  return (size + kAlignment - 1) / kAlignment * kAlignment;
+}
+
+template <typename T>
+void writeValue(std::ofstream& file, T value) {
+  file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// Sequential reads from the mapped file with bounds checks.
+struct Cursor {
+  const std::byte* data;
+  size_t size;
+  size_t pos;
+  const std::string& path;
+
+  const std::byte* take(size_t n) {
+    if (size < pos + n) {
+      throw std::runtime_error("Truncated columnar file '" + path + "'");
+    }
+    const std::byte* ptr = data + pos;
+    pos += n;
+    return ptr;
+  }
+  template <typename T>
+  T read() {
+    T value;
+    std::memcpy(&value, take(sizeof(T)), sizeof(T));
+    return value;
+  }
+  void align() { pos = padded(pos); }
+};
+}  // namespace
+
+ActsExamples::ColumnarFileWriter::ColumnarFileWriter(
+    const std::string& path, std::vector<ColumnSpec> columns)
+    : m_path(path),
+      m_columns(std::move(columns)),
+      m_file(path, std::ios::binary | std::ios::trunc) {
+  if (not m_file.good()) {
+    throw std::runtime_error("Could not create columnar file '" + path + "'");
+  }
+  m_file.write(kMagic, sizeof(kMagic));
+  writeValue<uint32_t>(m_file, kVersion);
+  writeValue<uint32_t>(m_file, m_columns.size());
+  for (const auto& column : m_columns) {
+    writeValue<uint32_t>(m_file, static_cast<uint32_t>(column.type));
+    writeValue<uint32_t>(m_file, column.name.size());
+    m_file.write(column.name.data(), column.name.size());
+  }
+  writePadding();
+}
+
+ActsExamples::ColumnarFileWriter::~ColumnarFileWriter() {
+  if (m_file.is_open()) {
+    close();
+  }
+}
+
+void ActsExamples::ColumnarFileWriter::writeEvent(
+    size_t event, const std::vector<ColumnData>& columns) {
+  if (columns.size() != m_columns.size()) {
+    throw std::invalid_argument("Invalid number of columns");
+  }
+  for (size_t i = 0; i < columns.size(); ++i) {
+    if (columns[i].type != m_columns[i].type) {
+      throw std::invalid_argument("Invalid type for column '" +
+                                  m_columns[i].name + "'");
+    }
+    if (columns[i].size != columns.front().size) {
+      throw std::invalid_argument("Inconsistent size for column '" +
+                                  m_columns[i].name + "'");
+    }
+  }
+  if (not m_writtenEvents.insert(event).second) {
+    throw std::invalid_argument("Event " + std::to_string(event) +
+                                " was already written");
+  }
+
+  m_index.emplace_back(event, static_cast<uint64_t>(m_file.tellp()));
+  writeValue<uint64_t>(m_file, columns.empty() ? 0u : columns.front().size);
+  for (const auto& column : columns) {
+    m_file.write(static_cast<const char*>(column.data),
+                 column.size * valueSize(column.type));
+    writePadding();
+  }
+  if (not m_file.good()) {
+    throw std::runtime_error("Could not write to columnar file '" + m_path +
+                             "'");
+  }
+}
+
+void ActsExamples::ColumnarFileWriter::close() {
+  uint64_t indexOffset = m_file.tellp();
+  for (const auto& [event, offset] : m_index) {
+    writeValue<uint64_t>(m_file, event);
+    writeValue<uint64_t>(m_file, offset);
+  }
+  writeValue<uint64_t>(m_file, indexOffset);
+  writeValue<uint64_t>(m_file, m_index.size());
+  m_file.write(kMagic, sizeof(kMagic));
+  m_file.close();
+}
+
+void ActsExamples::ColumnarFileWriter::writePadding() {
+  static const char zeros[kAlignment] = {};
+  size_t pos = m_file.tellp();
+  m_file.write(zeros, padded(pos) - pos);
+}
+
+ActsExamples::ColumnarFileReader::ColumnarFileReader(
+    const std::string& path, std::vector<ColumnSpec> columns)
+    : m_path(path), m_columns(std::move(columns)) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Could not open columnar file '" + path + "'");
+  }
+  struct stat info;
+  if (::fstat(fd, &info) != 0) {
+    ::close(fd);
+    throw std::runtime_error("Could not open columnar file '" + path + "'");
+  }
+  m_size = info.st_size;
+  void* data = (0 < m_size)
+                   ? ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0)
+                   : MAP_FAILED;
+  // the mapping stays valid after the file is closed
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    throw std::runtime_error("Could not map columnar file '" + path + "'");
+  }
+  m_data = static_cast<const std::byte*>(data);
+
+  try {
+    // header and column declarations
+    Cursor cursor{m_data, m_size, 0, m_path};
+    if (std::memcmp(cursor.take(sizeof(kMagic)), kMagic, sizeof(kMagic)) !=
+            0 or
+        cursor.read<uint32_t>() != kVersion) {
+      throw std::runtime_error("Invalid columnar file '" + path + "'");
+    }
+    uint32_t numColumns = cursor.read<uint32_t>();
+    if (numColumns != m_columns.size()) {
+      throw std::runtime_error("Unexpected columns in '" + path + "'");
+    }
+    for (const auto& column : m_columns) {
+      auto type = static_cast<ColumnType>(cursor.read<uint32_t>());
+      auto nameSize = cursor.read<uint32_t>();
+      std::string name(reinterpret_cast<const char*>(cursor.take(nameSize)),
+                       nameSize);
+      if ((type != column.type) or (name != column.name)) {
+        throw std::runtime_error("Unexpected column '" + name + "' in '" +
+                                 path + "'");
+      }
+    }
+    // trailer and index
+    if (m_size < kTrailerSize) {
+      throw std::runtime_error("Truncated columnar file '" + path + "'");
+    }
+    Cursor trailer{m_data, m_size, m_size - kTrailerSize, m_path};
+    uint64_t indexOffset = trailer.read<uint64_t>();
+    uint64_t numEvents = trailer.read<uint64_t>();
+    if (std::memcmp(trailer.take(sizeof(kMagic)), kMagic, sizeof(kMagic)) !=
+        0) {
+      throw std::runtime_error("Incomplete columnar file '" + path + "'");
+    }
+    Cursor index{m_data, m_size - kTrailerSize, indexOffset, m_path};
+    for (uint64_t i = 0; i < numEvents; ++i) {
+      uint64_t event = index.read<uint64_t>();
+      uint64_t offset = index.read<uint64_t>();
+      m_index.emplace_back(event, offset);
+    }
+    std::sort(m_index.begin(), m_index.end());
+  } catch (...) {
+    ::munmap(const_cast<std::byte*>(m_data), m_size);
+    throw;
+  }
+}
+
+ActsExamples::ColumnarFileReader::~ColumnarFileReader() {
+  ::munmap(const_cast<std::byte*>(m_data), m_size);
+}
+
+std::pair<size_t, size_t> ActsExamples::ColumnarFileReader::availableEvents()
+    const {
+  if (m_index.empty()) {
+    return {0u, 0u};
+  }
+  return {m_index.front().first, m_index.back().first + 1};
+}
+
+ActsExamples::ColumnarFileReader::EventView
+ActsExamples::ColumnarFileReader::event(size_t event) const {
+  auto it = std::lower_bound(
+      m_index.begin(), m_index.end(), event,
+      [](const auto& entry, size_t e) { return entry.first < e; });
+  if ((it == m_index.end()) or (it->first != event)) {
+    throw std::out_of_range("Event " + std::to_string(event) +
+                            " is not in '" + m_path + "'");
+  }
+  Cursor cursor{m_data, m_size, it->second, m_path};
+  EventView view;
+  view.m_size = cursor.read<uint64_t>();
+  for (const auto& column : m_columns) {
+    view.m_columns.push_back(
+        cursor.take(view.m_size * valueSize(column.type)));
+    view.m_types.push_back(column.type);
+    cursor.align();
+  }
+  return view;
+}
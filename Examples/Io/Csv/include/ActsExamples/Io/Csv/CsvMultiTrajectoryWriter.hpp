@@ -51,6 +51,9 @@ class CsvMultiTrajectoryWriter : public WriterT<TrajectoriesContainer> {
   CsvMultiTrajectoryWriter(const Config& cfg,
                            Acts::Logging::Level level = Acts::Logging::INFO);
 
+  /// All objects read by the writer.
+  std::optional<DataDependencies> dataDependencies() const override;
+
  protected:
   /// @brief Write method called by the base class
   /// @param [in] context is the algorithm context for consistency
@@ -52,6 +52,9 @@ class CsvSimHitReader final : public IReader {
   /// Read out data from the input stream.
   ProcessCode read(const ActsExamples::AlgorithmContext& ctx) final override;
 
+  /// The single output collection.
+  std::optional<DataDependencies> dataDependencies() const final override;
+
  private:
   Config m_cfg;
   std::pair<size_t, size_t> m_eventsRange;
@@ -0,0 +1,62 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include "ActsExamples/EventData/SimSpacePoint.hpp"
+#include "ActsExamples/Framework/WriterT.hpp"
+
+#include <limits>
+#include <string>
+
+namespace ActsExamples {
+
+/// Write out space points in comma-separated-value format.
+///
+/// This writes one file per event into the configured output directory. By
+/// default it writes to the current working directory. Files are named
+/// using the following schema
+///
+///     event000000001-<stem>.csv
+///     event000000002-<stem>.csv
+///     ...
+///
+/// and each line in the file corresponds to one space point. The files can
+/// be replayed by the seed finder benchmark.
+class CsvSpacePointWriter final : public WriterT<SimSpacePointContainer> {
+ public:
+  struct Config {
+    /// Input space point collection to write.
+    std::string inputSpacePoints;
+    /// Where to place output files.
+    std::string outputDir;
+    /// Output filename stem.
+    std::string outputStem = "spacepoints";
+    /// Number of decimal digits for floating point precision in output.
+    size_t outputPrecision = std::numeric_limits<float>::max_digits10;
+  };
+
+  /// Construct the space point writer.
+  ///
+  /// @params cfg is the configuration object
+  /// @params lvl is the logging level
+  CsvSpacePointWriter(const Config& cfg, Acts::Logging::Level lvl);
+
+ protected:
+  /// Type-specific write implementation.
+  ///
+  /// @param[in] ctx is the algorithm context
+  /// @param[in] spacePoints are the space points to be written
+  ProcessCode writeT(const AlgorithmContext& ctx,
+                     const SimSpacePointContainer& spacePoints) final override;
+
+ private:
+  Config m_cfg;
+};
+
+}  // namespace ActsExamples
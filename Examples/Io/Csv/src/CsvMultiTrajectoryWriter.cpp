@@ -30,6 +30,12 @@ CsvMultiTrajectoryWriter::CsvMultiTrajectoryWriter(
   }
 }
 
+std::optional<DataDependencies> CsvMultiTrajectoryWriter::dataDependencies()
+    const {
+  return DataDependencies{
+      {m_cfg.inputTrajectories, m_cfg.inputMeasurementParticlesMap}, {}};
+}
+
 ProcessCode CsvMultiTrajectoryWriter::writeT(
     const AlgorithmContext& context,
     const TrajectoriesContainer& trajectories) {
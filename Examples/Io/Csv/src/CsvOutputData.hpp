@@ -135,6 +135,18 @@ struct MeasurementData {
                  var_phi, var_theta, var_time);
 };
 
+struct SpacePointData {
+  /// Event-unique measurement identifier of the underlying measurement.
+  uint64_t measurement_id;
+  /// Global space point position components in mm.
+  float sp_x, sp_y, sp_z;
+  /// Space point position variances in radial and z direction in mm^2.
+  float sp_covr, sp_covz;
+
+  DFE_NAMEDTUPLE(SpacePointData, measurement_id, sp_x, sp_y, sp_z, sp_covr,
+                 sp_covz);
+};
+
 struct CellData {
   /// Hit surface identifier.
   uint64_t geometry_id = 0u;
@@ -47,6 +47,11 @@ std::pair<size_t, size_t> ActsExamples::CsvParticleReader::availableEvents()
   return m_eventsRange;
 }
 
+std::optional<ActsExamples::DataDependencies>
+ActsExamples::CsvParticleReader::dataDependencies() const {
+  return DataDependencies{{}, {m_cfg.outputParticles}};
+}
+
 ActsExamples::ProcessCode ActsExamples::CsvParticleReader::read(
     const ActsExamples::AlgorithmContext& ctx) {
   SimParticleContainer::sequence_type unordered;
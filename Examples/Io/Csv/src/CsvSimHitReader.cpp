@@ -41,6 +41,11 @@ std::pair<size_t, size_t> ActsExamples::CsvSimHitReader::availableEvents()
   return m_eventsRange;
 }
 
+std::optional<ActsExamples::DataDependencies>
+ActsExamples::CsvSimHitReader::dataDependencies() const {
+  return DataDependencies{{}, {m_cfg.outputSimHits}};
+}
+
 ActsExamples::ProcessCode ActsExamples::CsvSimHitReader::read(
     const ActsExamples::AlgorithmContext& ctx) {
   auto path = perEventFilepath(m_cfg.inputDir, m_cfg.inputStem + ".csv",
@@ -0,0 +1,52 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Io/Csv/CsvSpacePointWriter.hpp"
+
+#include "Acts/Definitions/Units.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Utilities/Paths.hpp"
+
+#include <stdexcept>
+
+#include <dfe/dfe_io_dsv.hpp>
+
+#include "CsvOutputData.hpp"
+
+ActsExamples::CsvSpacePointWriter::CsvSpacePointWriter(
+    const ActsExamples::CsvSpacePointWriter::Config& cfg,
+    Acts::Logging::Level lvl)
+    : WriterT(cfg.inputSpacePoints, "CsvSpacePointWriter", lvl), m_cfg(cfg) {
+  // inputSpacePoints is already checked by base constructor
+  if (m_cfg.outputStem.empty()) {
+    throw std::invalid_argument("Missing ouput filename stem");
+  }
+}
+
+ActsExamples::ProcessCode ActsExamples::CsvSpacePointWriter::writeT(
+    const AlgorithmContext& ctx,
+    const ActsExamples::SimSpacePointContainer& spacePoints) {
+  auto path = perEventFilepath(m_cfg.outputDir, m_cfg.outputStem + ".csv",
+                               ctx.eventNumber);
+  dfe::NamedTupleCsvWriter<SpacePointData> writer(path, m_cfg.outputPrecision);
+
+  SpacePointData data;
+  for (const auto& sp : spacePoints) {
+    data.measurement_id = sp.measurementIndex();
+    data.sp_x = sp.x() / Acts::UnitConstants::mm;
+    data.sp_y = sp.y() / Acts::UnitConstants::mm;
+    data.sp_z = sp.z() / Acts::UnitConstants::mm;
+    data.sp_covr = sp.varianceR() / (Acts::UnitConstants::mm *
+                                     Acts::UnitConstants::mm);
+    data.sp_covz = sp.varianceZ() / (Acts::UnitConstants::mm *
+                                     Acts::UnitConstants::mm);
+    writer.append(data);
+  }
+
+  return ProcessCode::SUCCESS;
+}
@@ -77,6 +77,15 @@ ActsExamples::ProcessCode ActsExamples::CKFPerformanceWriter::endRun() {
   return ProcessCode::SUCCESS;
 }
 
+std::optional<ActsExamples::DataDependencies>
+ActsExamples::CKFPerformanceWriter::dataDependencies() const {
+  return DataDependencies{
+      {m_cfg.inputTrajectories,
+       m_cfg.inputParticles,
+       m_cfg.inputMeasurementParticlesMap},
+      {}};
+}
+
 ActsExamples::ProcessCode ActsExamples::CKFPerformanceWriter::writeT(
     const AlgorithmContext& ctx, const TrajectoriesContainer& trajectories) {
   using HitParticlesMap = IndexMultimap<ActsFatras::Barcode>;
@@ -66,6 +66,9 @@ class CKFPerformanceWriter final : public WriterT<TrajectoriesContainer> {
   /// Finalize plots.
   ProcessCode endRun() final override;
 
+  /// All objects read by the writer.
+  std::optional<DataDependencies> dataDependencies() const final override;
+
  private:
   ProcessCode writeT(const AlgorithmContext& ctx,
                      const TrajectoriesContainer& trajectories) final override;
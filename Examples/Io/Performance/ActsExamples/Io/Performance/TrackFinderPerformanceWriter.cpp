@@ -260,3 +260,12 @@ ActsExamples::ProcessCode ActsExamples::TrackFinderPerformanceWriter::endRun() {
   m_impl->close();
   return ProcessCode::SUCCESS;
 }
+
+std::optional<ActsExamples::DataDependencies>
+ActsExamples::TrackFinderPerformanceWriter::dataDependencies() const {
+  return DataDependencies{
+      {m_impl->cfg.inputProtoTracks,
+       m_impl->cfg.inputParticles,
+       m_impl->cfg.inputMeasurementParticlesMap},
+      {}};
+}
@@ -40,6 +40,9 @@ class TrackFinderPerformanceWriter final : public WriterT<ProtoTrackContainer> {
 
   ProcessCode endRun() final override;
 
+  /// All objects read by the writer.
+  std::optional<DataDependencies> dataDependencies() const final override;
+
  private:
   ProcessCode writeT(const AlgorithmContext& ctx,
                      const ProtoTrackContainer& tracks) final override;
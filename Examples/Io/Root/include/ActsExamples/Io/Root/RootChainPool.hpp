@@ -0,0 +1,151 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ActsExamples {
+
+/// A pool of independent input chains for concurrent reads.
+///
+/// Each element owns its own chain and branch buffers and is used by a single
+/// read at a time, such that reads of different events do not need to
+/// serialize on a common chain. Elements are created on demand, up to a
+/// maximum number. A returned element is preferably handed out again to the
+/// thread that used it last. Events are usually assigned to the threads in
+/// contiguous ranges, so each chain keeps reading ahead in its own part of the
+/// input.
+///
+/// @tparam chain_t chain with its branch buffers, can be incomplete until
+///                 the pool is used
+template <typename chain_t>
+class RootChainPool {
+ public:
+  using Factory = std::function<std::unique_ptr<chain_t>()>;
+
+  /// Exclusive access to one element of the pool, returned on destruction.
+  class Lease {
+   public:
+    Lease(RootChainPool& pool, chain_t& chain)
+        : m_pool(&pool), m_chain(&chain) {}
+    Lease(const Lease&) = delete;
+    Lease(Lease&& other)
+        : m_pool(std::exchange(other.m_pool, nullptr)),
+          m_chain(other.m_chain) {}
+    Lease& operator=(const Lease&) = delete;
+    Lease& operator=(Lease&&) = delete;
+    ~Lease() {
+      if (m_pool != nullptr) {
+        m_pool->release(*m_chain);
+      }
+    }
+
+    chain_t& operator*() const { return *m_chain; }
+    chain_t* operator->() const { return m_chain; }
+
+   private:
+    RootChainPool* m_pool;
+    chain_t* m_chain;
+  };
+
+  /// @param factory Creates a new element, must be callable concurrently
+  /// @param maxChains Maximum number of elements, 0 for no limit
+  RootChainPool(Factory factory, size_t maxChains)
+      : m_factory(std::move(factory)), m_maxChains(maxChains) {
+    if (not m_factory) {
+      throw std::invalid_argument("Missing chain factory");
+    }
+  }
+
+  /// Get exclusive access to an idle element.
+  ///
+  /// Creates a new element if all are in use and the limit is not reached,
+  /// and waits for one to be returned otherwise.
+  Lease acquire() {
+    const auto thread = std::this_thread::get_id();
+    std::unique_lock lock(m_mutex);
+    while (m_idle.empty() and 0 < m_maxChains and
+           m_maxChains <= m_numCreated) {
+      m_returned.wait(lock);
+    }
+    if (m_idle.empty()) {
+      ++m_numCreated;
+      lock.unlock();
+      // open the input without blocking the other reads
+      std::unique_ptr<chain_t> chain;
+      try {
+        chain = m_factory();
+      } catch (...) {
+        lock.lock();
+        --m_numCreated;
+        m_returned.notify_one();
+        throw;
+      }
+      lock.lock();
+      m_chains.push_back({std::move(chain), thread});
+      return Lease(*this, *m_chains.back().chain);
+    }
+    // prefer the element last used by this thread, otherwise the most recent
+    auto it = m_idle.end() - 1;
+    for (auto i = m_idle.begin(); i != m_idle.end(); ++i) {
+      if ((*i)->lastThread == thread) {
+        it = i;
+        break;
+      }
+    }
+    Entry* entry = *it;
+    m_idle.erase(it);
+    entry->lastThread = thread;
+    return Lease(*this, *entry->chain);
+  }
+
+  /// The number of elements created so far.
+  size_t size() const {
+    std::lock_guard lock(m_mutex);
+    return m_chains.size();
+  }
+
+ private:
+  struct Entry {
+    std::unique_ptr<chain_t> chain;
+    std::thread::id lastThread;
+  };
+
+  void release(chain_t& chain) {
+    {
+      std::lock_guard lock(m_mutex);
+      for (auto& entry : m_chains) {
+        if (entry.chain.get() == &chain) {
+          m_idle.push_back(&entry);
+          break;
+        }
+      }
+    }
+    m_returned.notify_one();
+  }
+
+  Factory m_factory;
+  size_t m_maxChains;
+  size_t m_numCreated = 0;
+  // deque keeps the entries in place when new ones are added
+  std::deque<Entry> m_chains;
+  std::vector<Entry*> m_idle;
+  mutable std::mutex m_mutex;
+  std::condition_variable m_returned;
+};
+
+}  // namespace ActsExamples
@@ -11,15 +11,14 @@
 #include "ActsExamples/Framework/IReader.hpp"
 #include "ActsExamples/Framework/IService.hpp"
 #include "ActsExamples/Framework/ProcessCode.hpp"
+#include "ActsExamples/Io/Root/RootChainPool.hpp"
 #include <Acts/Definitions/Algebra.hpp>
 #include <Acts/Propagator/MaterialInteractor.hpp>
 #include <Acts/Utilities/Logger.hpp>
 
-#include <mutex>
+#include <memory>
 #include <vector>
 
-class TChain;
-
 namespace ActsExamples {
 
 /// @class RootMaterialTrackReader
@@ -27,6 +26,10 @@ namespace ActsExamples {
 /// @brief Reads in MaterialTrack information from a root file
 /// and fills it into a format to be understood by the MaterialMapping
 /// algorithm
+///
+/// The entries of each event are found once when the reader is created.
+/// Events are read concurrently, each read uses one of several independent
+/// input chains with a read-ahead cache.
 class RootMaterialTrackReader : public IReader {
  public:
   /// @brief The nested configuration struct
@@ -39,6 +42,11 @@ class RootMaterialTrackReader : public IReader {
 
     /// Whether the events are ordered or not
     bool orderedEvents = true;
+    /// Maximum number of concurrent reads, each with its own input chain;
+    /// 0 to allow one for each thread
+    size_t maxConcurrentReads = 0;
+    /// Size of the read-ahead cache of each input chain in bytes, 0 to disable
+    long long readAheadBytes = 16 * 1024 * 1024;
 
     /// The default logger
     std::shared_ptr<const Acts::Logger> logger;
@@ -77,49 +85,28 @@ class RootMaterialTrackReader : public IReader {
   /// Private access to the logging instance
   const Acts::Logger& logger() const { return *m_cfg.logger; }
 
+  /// Input chain with its own branch buffers
+  struct Chain;
+
+  /// Open a new input chain for concurrent reads
+  std::unique_ptr<Chain> makeChain() const;
+
   /// The config class
   Config m_cfg;
 
-  /// mutex used to protect multi-threaded reads
-  std::mutex m_read_mutex;
-
   /// The number of events
   size_t m_events = 0;
 
-  /// The input tree name
-  TChain* m_inputChain = nullptr;
-
-  /// Event identifier.
-  uint32_t m_eventId;
+  /// The first entry of each event and the end of the last event, after the
+  /// entries are ordered by event number
+  std::vector<size_t> m_eventOffsets = {};
 
   /// The entry numbers for accessing events in increased order (there could be
   /// multiple entries corresponding to one event number)
   std::vector<long long> m_entryNumbers = {};
 
-  float m_v_x;    ///< start global x
-  float m_v_y;    ///< start global y
-  float m_v_z;    ///< start global z
-  float m_v_px;   ///< start global momentum x
-  float m_v_py;   ///< start global momentum y
-  float m_v_pz;   ///< start global momentum z
-  float m_v_phi;  ///< start phi direction
-  float m_v_eta;  ///< start eta direction
-  float m_tX0;    ///< thickness in X0/L0
-  float m_tL0;    ///< thickness in X0/L0
-
-  std::vector<float>* m_step_x = new std::vector<float>;   ///< step x position
-  std::vector<float>* m_step_y = new std::vector<float>;   ///< step y position
-  std::vector<float>* m_step_z = new std::vector<float>;   ///< step z position
-  std::vector<float>* m_step_dx = new std::vector<float>;  ///< step x direction
-  std::vector<float>* m_step_dy = new std::vector<float>;  ///< step y direction
-  std::vector<float>* m_step_dz = new std::vector<float>;  ///< step z direction
-  std::vector<float>* m_step_length = new std::vector<float>;  ///< step length
-  std::vector<float>* m_step_X0 = new std::vector<float>;  ///< step material x0
-  std::vector<float>* m_step_L0 = new std::vector<float>;  ///< step material l0
-  std::vector<float>* m_step_A = new std::vector<float>;   ///< step material A
-  std::vector<float>* m_step_Z = new std::vector<float>;   ///< step material Z
-  std::vector<float>* m_step_rho =
-      new std::vector<float>;  ///< step material rho
+  /// Input chains used by the concurrent reads
+  RootChainPool<Chain> m_chains;
 };
 
 }  // namespace ActsExamples
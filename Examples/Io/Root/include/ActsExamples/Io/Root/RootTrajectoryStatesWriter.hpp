@@ -70,6 +70,9 @@ class RootTrajectoryStatesWriter final : public WriterT<TrajectoriesContainer> {
   /// End-of-run hook
   ProcessCode endRun() final override;
 
+  /// All objects read by the writer.
+  std::optional<DataDependencies> dataDependencies() const final override;
+
  protected:
   /// @brief Write method called by the base class
   /// @param [in] ctx is the algorithm context for event information
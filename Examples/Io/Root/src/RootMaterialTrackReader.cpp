@@ -1,6 +1,6 @@
 // This file is part of the Acts project.
 //
-// Copyright (C) 2017-2018 CERN for the benefit of the Acts project
+// Copyright (C) 2017-2021 CERN for the benefit of the Acts project
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -10,73 +10,154 @@
 
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <numeric>
 
 #include <TChain.h>
 #include <TFile.h>
-#include <TMath.h>
+
+struct ActsExamples::RootMaterialTrackReader::Chain {
+  TChain chain;
+
+  float v_x;    ///< start global x
+  float v_y;    ///< start global y
+  float v_z;    ///< start global z
+  float v_px;   ///< start global momentum x
+  float v_py;   ///< start global momentum y
+  float v_pz;   ///< start global momentum z
+  float v_phi;  ///< start phi direction
+  float v_eta;  ///< start eta direction
+  float tX0;    ///< thickness in X0/L0
+  float tL0;    ///< thickness in X0/L0
+
+  std::vector<float>* step_x = new std::vector<float>;   ///< step x position
+  std::vector<float>* step_y = new std::vector<float>;   ///< step y position
+  std::vector<float>* step_z = new std::vector<float>;   ///< step z position
+  std::vector<float>* step_dx = new std::vector<float>;  ///< step x direction
+  std::vector<float>* step_dy = new std::vector<float>;  ///< step y direction
+  std::vector<float>* step_dz = new std::vector<float>;  ///< step z direction
+  std::vector<float>* step_length = new std::vector<float>;  ///< step length
+  std::vector<float>* step_X0 = new std::vector<float>;  ///< step material x0
+  std::vector<float>* step_L0 = new std::vector<float>;  ///< step material l0
+  std::vector<float>* step_A = new std::vector<float>;   ///< step material A
+  std::vector<float>* step_Z = new std::vector<float>;   ///< step material Z
+  std::vector<float>* step_rho = new std::vector<float>;  ///< step material rho
+
+  Chain(const std::string& treeName) : chain(treeName.c_str()) {}
+  Chain(const Chain&) = delete;
+  Chain& operator=(const Chain&) = delete;
+  ~Chain() {
+    delete step_x;
+    delete step_y;
+    delete step_z;
+    delete step_dx;
+    delete step_dy;
+    delete step_dz;
+    delete step_length;
+    delete step_X0;
+    delete step_L0;
+    delete step_A;
+    delete step_Z;
+    delete step_rho;
+  }
+};
 
 ActsExamples::RootMaterialTrackReader::RootMaterialTrackReader(
     const ActsExamples::RootMaterialTrackReader::Config& cfg)
-    : ActsExamples::IReader(), m_cfg(cfg), m_events(0), m_inputChain(nullptr) {
-  m_inputChain = new TChain(m_cfg.treeName.c_str());
-
-  // Set the branches
-  m_inputChain->SetBranchAddress("event_id", &m_eventId);
-  m_inputChain->SetBranchAddress("v_x", &m_v_x);
-  m_inputChain->SetBranchAddress("v_y", &m_v_y);
-  m_inputChain->SetBranchAddress("v_z", &m_v_z);
-  m_inputChain->SetBranchAddress("v_px", &m_v_px);
-  m_inputChain->SetBranchAddress("v_py", &m_v_py);
-  m_inputChain->SetBranchAddress("v_pz", &m_v_pz);
-  m_inputChain->SetBranchAddress("v_phi", &m_v_phi);
-  m_inputChain->SetBranchAddress("v_eta", &m_v_eta);
-  m_inputChain->SetBranchAddress("t_X0", &m_tX0);
-  m_inputChain->SetBranchAddress("t_L0", &m_tL0);
-  m_inputChain->SetBranchAddress("mat_x", &m_step_x);
-  m_inputChain->SetBranchAddress("mat_y", &m_step_y);
-  m_inputChain->SetBranchAddress("mat_z", &m_step_z);
-  m_inputChain->SetBranchAddress("mat_dx", &m_step_dx);
-  m_inputChain->SetBranchAddress("mat_dy", &m_step_dy);
-  m_inputChain->SetBranchAddress("mat_dz", &m_step_dz);
-  m_inputChain->SetBranchAddress("mat_step_length", &m_step_length);
-  m_inputChain->SetBranchAddress("mat_X0", &m_step_X0);
-  m_inputChain->SetBranchAddress("mat_L0", &m_step_L0);
-  m_inputChain->SetBranchAddress("mat_A", &m_step_A);
-  m_inputChain->SetBranchAddress("mat_Z", &m_step_Z);
-  m_inputChain->SetBranchAddress("mat_rho", &m_step_rho);
+    : ActsExamples::IReader(),
+      m_cfg(cfg),
+      m_chains([this]() { return makeChain(); }, cfg.maxConcurrentReads) {
+  // Only the event number is needed to find the entries of each event
+  TChain indexChain(m_cfg.treeName.c_str());
 
   // loop over the input files
   for (auto inputFile : m_cfg.fileList) {
     // add file to the input chain
-    m_inputChain->Add(inputFile.c_str());
+    indexChain.Add(inputFile.c_str());
     ACTS_DEBUG("Adding File " << inputFile << " to tree '" << m_cfg.treeName
                               << "'.");
   }
 
-  m_events = m_inputChain->GetEntries();
-  ACTS_DEBUG("The full chain has " << m_events << " entries.");
+  uint32_t eventId = 0;
+  indexChain.SetBranchStatus("*", false);
+  indexChain.SetBranchStatus("event_id", true);
+  indexChain.SetBranchAddress("event_id", &eventId);
+
+  size_t nEntries = indexChain.GetEntries();
+  ACTS_DEBUG("The full chain has " << nEntries << " entries.");
+
+  std::vector<uint32_t> eventIds(nEntries);
+  for (size_t entry = 0; entry < nEntries; ++entry) {
+    indexChain.GetEntry(entry);
+    eventIds[entry] = eventId;
+  }
 
   // If the events are not in order, get the entry numbers for ordered events
   if (not m_cfg.orderedEvents) {
-    m_entryNumbers.resize(m_events);
-    m_inputChain->Draw("event_id", "", "goff");
-    // Sort to get the entry numbers of the ordered events
-    TMath::Sort(m_inputChain->GetEntries(), m_inputChain->GetV1(),
-                m_entryNumbers.data(), false);
+    m_entryNumbers.resize(nEntries);
+    std::iota(m_entryNumbers.begin(), m_entryNumbers.end(), 0);
+    std::stable_sort(m_entryNumbers.begin(), m_entryNumbers.end(),
+                     [&](long long lhs, long long rhs) {
+                       return eventIds[lhs] < eventIds[rhs];
+                     });
+  }
+
+  // Count the entries of each event to get the first entry of each event
+  if (not eventIds.empty()) {
+    m_events = *std::max_element(eventIds.begin(), eventIds.end()) + 1u;
   }
+  m_eventOffsets.assign(m_events + 1u, 0u);
+  for (auto id : eventIds) {
+    ++m_eventOffsets[id + 1u];
+  }
+  std::partial_sum(m_eventOffsets.begin(), m_eventOffsets.end(),
+                   m_eventOffsets.begin());
+  ACTS_DEBUG("The entries contain " << m_events << " events.");
 }
 
-ActsExamples::RootMaterialTrackReader::~RootMaterialTrackReader() {
-  delete m_step_x;
-  delete m_step_y;
-  delete m_step_z;
-  delete m_step_length;
-  delete m_step_X0;
-  delete m_step_L0;
-  delete m_step_A;
-  delete m_step_Z;
-  delete m_step_rho;
+ActsExamples::RootMaterialTrackReader::~RootMaterialTrackReader() = default;
+
+std::unique_ptr<ActsExamples::RootMaterialTrackReader::Chain>
+ActsExamples::RootMaterialTrackReader::makeChain() const {
+  auto input = std::make_unique<Chain>(m_cfg.treeName);
+  TChain& chain = input->chain;
+
+  // Set the branches
+  chain.SetBranchAddress("v_x", &input->v_x);
+  chain.SetBranchAddress("v_y", &input->v_y);
+  chain.SetBranchAddress("v_z", &input->v_z);
+  chain.SetBranchAddress("v_px", &input->v_px);
+  chain.SetBranchAddress("v_py", &input->v_py);
+  chain.SetBranchAddress("v_pz", &input->v_pz);
+  chain.SetBranchAddress("v_phi", &input->v_phi);
+  chain.SetBranchAddress("v_eta", &input->v_eta);
+  chain.SetBranchAddress("t_X0", &input->tX0);
+  chain.SetBranchAddress("t_L0", &input->tL0);
+  chain.SetBranchAddress("mat_x", &input->step_x);
+  chain.SetBranchAddress("mat_y", &input->step_y);
+  chain.SetBranchAddress("mat_z", &input->step_z);
+  chain.SetBranchAddress("mat_dx", &input->step_dx);
+  chain.SetBranchAddress("mat_dy", &input->step_dy);
+  chain.SetBranchAddress("mat_dz", &input->step_dz);
+  chain.SetBranchAddress("mat_step_length", &input->step_length);
+  chain.SetBranchAddress("mat_X0", &input->step_X0);
+  chain.SetBranchAddress("mat_L0", &input->step_L0);
+  chain.SetBranchAddress("mat_A", &input->step_A);
+  chain.SetBranchAddress("mat_Z", &input->step_Z);
+  chain.SetBranchAddress("mat_rho", &input->step_rho);
+
+  for (auto inputFile : m_cfg.fileList) {
+    chain.Add(inputFile.c_str());
+  }
+
+  // Read ahead the baskets of all branches
+  if (0 < m_cfg.readAheadBytes) {
+    chain.SetCacheSize(m_cfg.readAheadBytes);
+    chain.AddBranchToCache("*", true);
+  }
+  ACTS_DEBUG("Opened a new input chain for concurrent reads.");
+  return input;
 }
 
 std::string ActsExamples::RootMaterialTrackReader::name() const {
@@ -92,20 +173,16 @@ ActsExamples::ProcessCode ActsExamples::RootMaterialTrackReader::read(
     const ActsExamples::AlgorithmContext& context) {
   ACTS_DEBUG("Trying to read recorded material from tracks.");
   // read in the material track
-  if (m_inputChain && context.eventNumber < m_events) {
-    // lock the mutex
-    std::lock_guard<std::mutex> lock(m_read_mutex);
-    // now read
+  if (context.eventNumber < m_events) {
+    // Use one of the input chains not used by any other read
+    auto input = m_chains.acquire();
 
     // The collection to be written
     std::vector<Acts::RecordedMaterialTrack> mtrackCollection;
 
     // Find the start entry and the batch size for this event
-    std::string eventNumberStr = std::to_string(context.eventNumber);
-    std::string findStartEntry = "event_id<" + eventNumberStr;
-    std::string findBatchSize = "event_id==" + eventNumberStr;
-    size_t startEntry = m_inputChain->GetEntries(findStartEntry.c_str());
-    size_t batchSize = m_inputChain->GetEntries(findBatchSize.c_str());
+    size_t startEntry = m_eventOffsets[context.eventNumber];
+    size_t batchSize = m_eventOffsets[context.eventNumber + 1] - startEntry;
     ACTS_VERBOSE("The event has " << batchSize
                                   << " entries with the start entry "
                                   << startEntry);
@@ -119,24 +196,25 @@ ActsExamples::ProcessCode ActsExamples::RootMaterialTrackReader::read(
       }
       ACTS_VERBOSE("Reading event: " << context.eventNumber
                                      << " with stored entry: " << entry);
-      m_inputChain->GetEntry(entry);
+      input->chain.GetEntry(entry);
 
       Acts::RecordedMaterialTrack rmTrack;
       // Fill the position and momentum
-      rmTrack.first.first = Acts::Vector3(m_v_x, m_v_y, m_v_z);
-      rmTrack.first.second = Acts::Vector3(m_v_px, m_v_py, m_v_pz);
+      rmTrack.first.first = Acts::Vector3(input->v_x, input->v_y, input->v_z);
+      rmTrack.first.second =
+          Acts::Vector3(input->v_px, input->v_py, input->v_pz);
 
       // Fill the individual steps
-      size_t msteps = m_step_length->size();
+      size_t msteps = input->step_length->size();
       ACTS_VERBOSE("Reading " << msteps << " material steps.");
       rmTrack.second.materialInteractions.reserve(msteps);
       rmTrack.second.materialInX0 = 0.;
       rmTrack.second.materialInL0 = 0.;
 
       for (size_t is = 0; is < msteps; ++is) {
-        double mX0 = (*m_step_X0)[is];
-        double mL0 = (*m_step_L0)[is];
-        double s = (*m_step_length)[is];
+        double mX0 = (*input->step_X0)[is];
+        double mL0 = (*input->step_L0)[is];
+        double s = (*input->step_length)[is];
 
         rmTrack.second.materialInX0 += s / mX0;
         rmTrack.second.materialInL0 += s / mL0;
@@ -144,12 +222,15 @@ ActsExamples::ProcessCode ActsExamples::RootMaterialTrackReader::read(
         /// Fill the position & the material
         Acts::MaterialInteraction mInteraction;
         mInteraction.position =
-            Acts::Vector3((*m_step_x)[is], (*m_step_y)[is], (*m_step_z)[is]);
+            Acts::Vector3((*input->step_x)[is], (*input->step_y)[is],
+                          (*input->step_z)[is]);
         mInteraction.direction =
-            Acts::Vector3((*m_step_dx)[is], (*m_step_dy)[is], (*m_step_dz)[is]);
+            Acts::Vector3((*input->step_dx)[is], (*input->step_dy)[is],
+                          (*input->step_dz)[is]);
         mInteraction.materialSlab = Acts::MaterialSlab(
-            Acts::Material::fromMassDensity(mX0, mL0, (*m_step_A)[is],
-                                            (*m_step_Z)[is], (*m_step_rho)[is]),
+            Acts::Material::fromMassDensity(
+                mX0, mL0, (*input->step_A)[is], (*input->step_Z)[is],
+                (*input->step_rho)[is]),
             s);
         rmTrack.second.materialInteractions.push_back(std::move(mInteraction));
       }
@@ -238,6 +238,17 @@ ActsExamples::ProcessCode ActsExamples::RootTrajectoryStatesWriter::endRun() {
   return ProcessCode::SUCCESS;
 }
 
+std::optional<ActsExamples::DataDependencies>
+ActsExamples::RootTrajectoryStatesWriter::dataDependencies() const {
+  return DataDependencies{
+      {m_cfg.inputTrajectories,
+       m_cfg.inputParticles,
+       m_cfg.inputSimHits,
+       m_cfg.inputMeasurementParticlesMap,
+       m_cfg.inputMeasurementSimHitsMap},
+      {}};
+}
+
 ActsExamples::ProcessCode ActsExamples::RootTrajectoryStatesWriter::writeT(
     const AlgorithmContext& ctx, const TrajectoriesContainer& trajectories) {
   using HitParticlesMap = IndexMultimap<ActsFatras::Barcode>;
@@ -14,17 +14,161 @@
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 #include "ActsExamples/Utilities/Paths.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <numeric>
 
 #include <TChain.h>
 #include <TFile.h>
-#include <TMath.h>
+
+struct ActsExamples::RootTrajectorySummaryReader::Chain {
+  TChain chain;
+
+  std::vector<uint32_t>* multiTrajNr =
+      new std::vector<uint32_t>;  ///< the multi-trajectory number
+  std::vector<unsigned int>* subTrajNr =
+      new std::vector<unsigned int>;  ///< the multi-trajectory sub-trajectory
+                                      ///< number
+
+  std::vector<unsigned int>* nStates =
+      new std::vector<unsigned int>;  ///< The number of states
+  std::vector<unsigned int>* nMeasurements =
+      new std::vector<unsigned int>;  ///< The number of measurements
+  std::vector<unsigned int>* nOutliers =
+      new std::vector<unsigned int>;  ///< The number of outliers
+  std::vector<unsigned int>* nHoles =
+      new std::vector<unsigned int>;  ///< The number of holes
+  std::vector<float>* chi2Sum = new std::vector<float>;  ///< The total chi2
+  std::vector<unsigned int>* NDF =
+      new std::vector<unsigned int>;  ///< The number of ndf of the
+                                      ///< measurements+outliers
+  std::vector<std::vector<double>>* measurementChi2 =
+      new std::vector<std::vector<double>>;  ///< The chi2 on all measurement
+                                             ///< states
+  std::vector<std::vector<double>>* outlierChi2 =
+      new std::vector<std::vector<double>>;  ///< The chi2 on all outlier states
+  std::vector<std::vector<double>>* measurementVolume =
+      new std::vector<std::vector<double>>;  ///< The volume id of the
+                                             ///< measurements
+  std::vector<std::vector<double>>* measurementLayer =
+      new std::vector<std::vector<double>>;  ///< The layer id of the
+                                             ///< measurements
+  std::vector<std::vector<double>>* outlierVolume =
+      new std::vector<std::vector<double>>;  ///< The volume id of the outliers
+  std::vector<std::vector<double>>* outlierLayer =
+      new std::vector<std::vector<double>>;  ///< The layer id of the outliers
+
+  // The majority truth particle info
+  std::vector<unsigned int>* nMajorityHits =
+      new std::vector<unsigned int>;  ///< The number of hits from majority
+                                      ///< particle
+  std::vector<uint64_t>* majorityParticleId =
+      new std::vector<uint64_t>;  ///< The particle Id of the majority particle
+  std::vector<int>* t_charge =
+      new std::vector<int>;  ///< Charge of majority particle
+  std::vector<float>* t_time =
+      new std::vector<float>;  ///< Time of majority particle
+  std::vector<float>* t_vx =
+      new std::vector<float>;  ///< Vertex x positions of majority particle
+  std::vector<float>* t_vy =
+      new std::vector<float>;  ///< Vertex y positions of majority particle
+  std::vector<float>* t_vz =
+      new std::vector<float>;  ///< Vertex z positions of majority particle
+  std::vector<float>* t_px =
+      new std::vector<float>;  ///< Initial momenta px of majority particle
+  std::vector<float>* t_py =
+      new std::vector<float>;  ///< Initial momenta py of majority particle
+  std::vector<float>* t_pz =
+      new std::vector<float>;  ///< Initial momenta pz of majority particle
+  std::vector<float>* t_theta =
+      new std::vector<float>;  ///< Initial momenta theta of majority particle
+  std::vector<float>* t_phi =
+      new std::vector<float>;  ///< Initial momenta phi of majority particle
+  std::vector<float>* t_pT =
+      new std::vector<float>;  ///< Initial momenta pT of majority particle
+  std::vector<float>* t_eta =
+      new std::vector<float>;  ///< Initial momenta eta of majority particle
+
+  std::vector<bool>* hasFittedParams =
+      new std::vector<bool>;  ///< If the track has fitted parameter
+  std::vector<float>* eLOC0_fit =
+      new std::vector<float>;  ///< Fitted parameters eBoundLoc0 of track
+  std::vector<float>* eLOC1_fit =
+      new std::vector<float>;  ///< Fitted parameters eBoundLoc1 of track
+  std::vector<float>* ePHI_fit =
+      new std::vector<float>;  ///< Fitted parameters ePHI of track
+  std::vector<float>* eTHETA_fit =
+      new std::vector<float>;  ///< Fitted parameters eTHETA of track
+  std::vector<float>* eQOP_fit =
+      new std::vector<float>;  ///< Fitted parameters eQOP of track
+  std::vector<float>* eT_fit =
+      new std::vector<float>;  ///< Fitted parameters eT of track
+  std::vector<float>* err_eLOC0_fit =
+      new std::vector<float>;  ///< Fitted parameters eLOC err of track
+  std::vector<float>* err_eLOC1_fit =
+      new std::vector<float>;  ///< Fitted parameters eBoundLoc1 err of track
+  std::vector<float>* err_ePHI_fit =
+      new std::vector<float>;  ///< Fitted parameters ePHI err of track
+  std::vector<float>* err_eTHETA_fit =
+      new std::vector<float>;  ///< Fitted parameters eTHETA err of track
+  std::vector<float>* err_eQOP_fit =
+      new std::vector<float>;  ///< Fitted parameters eQOP err of track
+  std::vector<float>* err_eT_fit =
+      new std::vector<float>;  ///< Fitted parameters eT err of track
+
+  Chain(const std::string& treeName) : chain(treeName.c_str()) {}
+  Chain(const Chain&) = delete;
+  Chain& operator=(const Chain&) = delete;
+  ~Chain() {
+    delete multiTrajNr;
+    delete subTrajNr;
+    delete nStates;
+    delete nMeasurements;
+    delete nOutliers;
+    delete nHoles;
+    delete chi2Sum;
+    delete NDF;
+    delete measurementChi2;
+    delete outlierChi2;
+    delete measurementVolume;
+    delete measurementLayer;
+    delete outlierVolume;
+    delete outlierLayer;
+    delete nMajorityHits;
+    delete majorityParticleId;
+    delete t_charge;
+    delete t_time;
+    delete t_vx;
+    delete t_vy;
+    delete t_vz;
+    delete t_px;
+    delete t_py;
+    delete t_pz;
+    delete t_theta;
+    delete t_phi;
+    delete t_pT;
+    delete t_eta;
+    delete hasFittedParams;
+    delete eLOC0_fit;
+    delete eLOC1_fit;
+    delete ePHI_fit;
+    delete eTHETA_fit;
+    delete eQOP_fit;
+    delete eT_fit;
+    delete err_eLOC0_fit;
+    delete err_eLOC1_fit;
+    delete err_ePHI_fit;
+    delete err_eTHETA_fit;
+    delete err_eQOP_fit;
+    delete err_eT_fit;
+  }
+};
 
 ActsExamples::RootTrajectorySummaryReader::RootTrajectorySummaryReader(
     const ActsExamples::RootTrajectorySummaryReader::Config& cfg)
-    : ActsExamples::IReader(), m_cfg(cfg), m_events(0), m_inputChain(nullptr) {
-  m_inputChain = new TChain(m_cfg.treeName.c_str());
-
+    : ActsExamples::IReader(),
+      m_cfg(cfg),
+      m_chains([this]() { return makeChain(); }, cfg.maxConcurrentReads) {
   if (m_cfg.inputFile.empty()) {
     throw std::invalid_argument("Missing input filename");
   }
@@ -32,73 +176,98 @@ ActsExamples::RootTrajectorySummaryReader::RootTrajectorySummaryReader(
     throw std::invalid_argument("Missing input directory");
   }
 
-  // Set the branches
-  m_inputChain->SetBranchAddress("event_nr", &m_eventNr);
-  m_inputChain->SetBranchAddress("multiTraj_nr", &m_multiTrajNr);
-  m_inputChain->SetBranchAddress("subTraj_nr", &m_subTrajNr);
-
-  // These info is not really stored in the event store, but still read in
-  m_inputChain->SetBranchAddress("nStates", &m_nStates);
-  m_inputChain->SetBranchAddress("nMeasurements", &m_nMeasurements);
-  m_inputChain->SetBranchAddress("nOutliers", &m_nOutliers);
-  m_inputChain->SetBranchAddress("nHoles", &m_nHoles);
-  m_inputChain->SetBranchAddress("chi2Sum", &m_chi2Sum);
-  m_inputChain->SetBranchAddress("NDF", &m_NDF);
-  m_inputChain->SetBranchAddress("measurementChi2", &m_measurementChi2);
-  m_inputChain->SetBranchAddress("outlierChi2", &m_outlierChi2);
-  m_inputChain->SetBranchAddress("measurementVolume", &m_measurementVolume);
-  m_inputChain->SetBranchAddress("measurementLayer", &m_measurementLayer);
-  m_inputChain->SetBranchAddress("outlierVolume", &m_outlierVolume);
-  m_inputChain->SetBranchAddress("outlierLayer", &m_outlierLayer);
-
-  m_inputChain->SetBranchAddress("majorityParticleId", &m_majorityParticleId);
-  m_inputChain->SetBranchAddress("nMajorityHits", &m_nMajorityHits);
-  m_inputChain->SetBranchAddress("t_charge", &m_t_charge);
-  m_inputChain->SetBranchAddress("t_time", &m_t_time);
-  m_inputChain->SetBranchAddress("t_vx", &m_t_vx);
-  m_inputChain->SetBranchAddress("t_vy", &m_t_vy);
-  m_inputChain->SetBranchAddress("t_vz", &m_t_vz);
-  m_inputChain->SetBranchAddress("t_px", &m_t_px);
-  m_inputChain->SetBranchAddress("t_py", &m_t_py);
-  m_inputChain->SetBranchAddress("t_pz", &m_t_pz);
-  m_inputChain->SetBranchAddress("t_theta", &m_t_theta);
-  m_inputChain->SetBranchAddress("t_phi", &m_t_phi);
-  m_inputChain->SetBranchAddress("t_eta", &m_t_eta);
-  m_inputChain->SetBranchAddress("t_pT", &m_t_pT);
-
-  m_inputChain->SetBranchAddress("hasFittedParams", &m_hasFittedParams);
-  m_inputChain->SetBranchAddress("eLOC0_fit", &m_eLOC0_fit);
-  m_inputChain->SetBranchAddress("eLOC1_fit", &m_eLOC1_fit);
-  m_inputChain->SetBranchAddress("ePHI_fit", &m_ePHI_fit);
-  m_inputChain->SetBranchAddress("eTHETA_fit", &m_eTHETA_fit);
-  m_inputChain->SetBranchAddress("eQOP_fit", &m_eQOP_fit);
-  m_inputChain->SetBranchAddress("eT_fit", &m_eT_fit);
-  m_inputChain->SetBranchAddress("err_eLOC0_fit", &m_err_eLOC0_fit);
-  m_inputChain->SetBranchAddress("err_eLOC1_fit", &m_err_eLOC1_fit);
-  m_inputChain->SetBranchAddress("err_ePHI_fit", &m_err_ePHI_fit);
-  m_inputChain->SetBranchAddress("err_eTHETA_fit", &m_err_eTHETA_fit);
-  m_inputChain->SetBranchAddress("err_eQOP_fit", &m_err_eQOP_fit);
-  m_inputChain->SetBranchAddress("err_eT_fit", &m_err_eT_fit);
+  // Only the event number is needed to order the entries
+  TChain indexChain(m_cfg.treeName.c_str());
 
   auto path = joinPaths(m_cfg.inputDir, m_cfg.inputFile);
 
   // add file to the input chain
-  m_inputChain->Add(path.c_str());
+  indexChain.Add(path.c_str());
   ACTS_DEBUG("Adding File " << path << " to tree '" << m_cfg.treeName << "'.");
 
-  m_events = m_inputChain->GetEntries();
+  m_events = indexChain.GetEntries();
   ACTS_DEBUG("The full chain has " << m_events << " entries.");
 
   // If the events are not in order, get the entry numbers for ordered events
   if (not m_cfg.orderedEvents) {
+    uint32_t eventNr = 0;
+    indexChain.SetBranchStatus("*", false);
+    indexChain.SetBranchStatus("event_nr", true);
+    indexChain.SetBranchAddress("event_nr", &eventNr);
+
+    std::vector<uint32_t> eventNrs(m_events);
+    for (size_t entry = 0; entry < m_events; ++entry) {
+      indexChain.GetEntry(entry);
+      eventNrs[entry] = eventNr;
+    }
     m_entryNumbers.resize(m_events);
-    m_inputChain->Draw("event_nr", "", "goff");
-    // Sort to get the entry numbers of the ordered events
-    TMath::Sort(m_inputChain->GetEntries(), m_inputChain->GetV1(),
-                m_entryNumbers.data(), false);
+    std::iota(m_entryNumbers.begin(), m_entryNumbers.end(), 0);
+    std::stable_sort(m_entryNumbers.begin(), m_entryNumbers.end(),
+                     [&](long long lhs, long long rhs) {
+                       return eventNrs[lhs] < eventNrs[rhs];
+                     });
   }
 }
 
+std::unique_ptr<ActsExamples::RootTrajectorySummaryReader::Chain>
+ActsExamples::RootTrajectorySummaryReader::makeChain() const {
+  auto input = std::make_unique<Chain>(m_cfg.treeName);
+  TChain& chain = input->chain;
+
+  // Set the branches
+  chain.SetBranchAddress("multiTraj_nr", &input->multiTrajNr);
+  chain.SetBranchAddress("subTraj_nr", &input->subTrajNr);
+  chain.SetBranchAddress("nStates", &input->nStates);
+  chain.SetBranchAddress("nMeasurements", &input->nMeasurements);
+  chain.SetBranchAddress("nOutliers", &input->nOutliers);
+  chain.SetBranchAddress("nHoles", &input->nHoles);
+  chain.SetBranchAddress("chi2Sum", &input->chi2Sum);
+  chain.SetBranchAddress("NDF", &input->NDF);
+  chain.SetBranchAddress("measurementChi2", &input->measurementChi2);
+  chain.SetBranchAddress("outlierChi2", &input->outlierChi2);
+  chain.SetBranchAddress("measurementVolume", &input->measurementVolume);
+  chain.SetBranchAddress("measurementLayer", &input->measurementLayer);
+  chain.SetBranchAddress("outlierVolume", &input->outlierVolume);
+  chain.SetBranchAddress("outlierLayer", &input->outlierLayer);
+  chain.SetBranchAddress("majorityParticleId", &input->majorityParticleId);
+  chain.SetBranchAddress("nMajorityHits", &input->nMajorityHits);
+  chain.SetBranchAddress("t_charge", &input->t_charge);
+  chain.SetBranchAddress("t_time", &input->t_time);
+  chain.SetBranchAddress("t_vx", &input->t_vx);
+  chain.SetBranchAddress("t_vy", &input->t_vy);
+  chain.SetBranchAddress("t_vz", &input->t_vz);
+  chain.SetBranchAddress("t_px", &input->t_px);
+  chain.SetBranchAddress("t_py", &input->t_py);
+  chain.SetBranchAddress("t_pz", &input->t_pz);
+  chain.SetBranchAddress("t_theta", &input->t_theta);
+  chain.SetBranchAddress("t_phi", &input->t_phi);
+  chain.SetBranchAddress("t_eta", &input->t_eta);
+  chain.SetBranchAddress("t_pT", &input->t_pT);
+  chain.SetBranchAddress("hasFittedParams", &input->hasFittedParams);
+  chain.SetBranchAddress("eLOC0_fit", &input->eLOC0_fit);
+  chain.SetBranchAddress("eLOC1_fit", &input->eLOC1_fit);
+  chain.SetBranchAddress("ePHI_fit", &input->ePHI_fit);
+  chain.SetBranchAddress("eTHETA_fit", &input->eTHETA_fit);
+  chain.SetBranchAddress("eQOP_fit", &input->eQOP_fit);
+  chain.SetBranchAddress("eT_fit", &input->eT_fit);
+  chain.SetBranchAddress("err_eLOC0_fit", &input->err_eLOC0_fit);
+  chain.SetBranchAddress("err_eLOC1_fit", &input->err_eLOC1_fit);
+  chain.SetBranchAddress("err_ePHI_fit", &input->err_ePHI_fit);
+  chain.SetBranchAddress("err_eTHETA_fit", &input->err_eTHETA_fit);
+  chain.SetBranchAddress("err_eQOP_fit", &input->err_eQOP_fit);
+  chain.SetBranchAddress("err_eT_fit", &input->err_eT_fit);
+
+  chain.Add(joinPaths(m_cfg.inputDir, m_cfg.inputFile).c_str());
+
+  // Read ahead the baskets of all branches
+  if (0 < m_cfg.readAheadBytes) {
+    chain.SetCacheSize(m_cfg.readAheadBytes);
+    chain.AddBranchToCache("*", true);
+  }
+  ACTS_DEBUG("Opened a new input chain for concurrent reads.");
+  return input;
+}
+
 std::string ActsExamples::RootTrajectorySummaryReader::name() const {
   return m_cfg.name;
 }
@@ -108,59 +277,17 @@ ActsExamples::RootTrajectorySummaryReader::availableEvents() const {
   return {0u, m_events};
 }
 
-ActsExamples::RootTrajectorySummaryReader::~RootTrajectorySummaryReader() {
-  delete m_multiTrajNr;
-  delete m_subTrajNr;
-  delete m_nStates;
-  delete m_nMeasurements;
-  delete m_nOutliers;
-  delete m_nHoles;
-  delete m_chi2Sum;
-  delete m_NDF;
-  delete m_measurementChi2;
-  delete m_outlierChi2;
-  delete m_measurementVolume;
-  delete m_measurementLayer;
-  delete m_outlierVolume;
-  delete m_outlierLayer;
-  delete m_majorityParticleId;
-  delete m_nMajorityHits;
-  delete m_t_charge;
-  delete m_t_time;
-  delete m_t_vx;
-  delete m_t_vy;
-  delete m_t_vz;
-  delete m_t_px;
-  delete m_t_py;
-  delete m_t_pz;
-  delete m_t_theta;
-  delete m_t_phi;
-  delete m_t_pT;
-  delete m_t_eta;
-  delete m_hasFittedParams;
-  delete m_eLOC0_fit;
-  delete m_eLOC1_fit;
-  delete m_ePHI_fit;
-  delete m_eTHETA_fit;
-  delete m_eQOP_fit;
-  delete m_eT_fit;
-  delete m_err_eLOC0_fit;
-  delete m_err_eLOC1_fit;
-  delete m_err_ePHI_fit;
-  delete m_err_eTHETA_fit;
-  delete m_err_eQOP_fit;
-  delete m_err_eT_fit;
-}
+ActsExamples::RootTrajectorySummaryReader::~RootTrajectorySummaryReader() =
+    default;
 
 ActsExamples::ProcessCode ActsExamples::RootTrajectorySummaryReader::read(
     const ActsExamples::AlgorithmContext& context) {
   ACTS_DEBUG("Trying to read recorded tracks.");
 
   // read in the fitted track parameters and particles
-  if (m_inputChain && context.eventNumber < m_events) {
-    // lock the mutex
-    std::lock_guard<std::mutex> lock(m_read_mutex);
-    // now read
+  if (context.eventNumber < m_events) {
+    // Use one of the input chains not used by any other read
+    auto input = m_chains.acquire();
 
     std::shared_ptr<Acts::PerigeeSurface> perigeeSurface =
         Acts::Surface::makeShared<Acts::PerigeeSurface>(
@@ -175,23 +302,24 @@ ActsExamples::ProcessCode ActsExamples::RootTrajectorySummaryReader::read(
     if (not m_cfg.orderedEvents and entry < m_entryNumbers.size()) {
       entry = m_entryNumbers[entry];
     }
-    m_inputChain->GetEntry(entry);
+    input->chain.GetEntry(entry);
     ACTS_INFO("Reading event: " << context.eventNumber
                                 << " stored as entry: " << entry);
 
-    unsigned int nTracks = m_eLOC0_fit->size();
+    unsigned int nTracks = input->eLOC0_fit->size();
     for (unsigned int i = 0; i < nTracks; i++) {
       Acts::BoundVector paramVec;
-      paramVec << (*m_eLOC0_fit)[i], (*m_eLOC1_fit)[i], (*m_ePHI_fit)[i],
-          (*m_eTHETA_fit)[i], (*m_eQOP_fit)[i], (*m_eT_fit)[i];
+      paramVec << (*input->eLOC0_fit)[i], (*input->eLOC1_fit)[i],
+          (*input->ePHI_fit)[i], (*input->eTHETA_fit)[i],
+          (*input->eQOP_fit)[i], (*input->eT_fit)[i];
 
       // Resolutions
-      double resD0 = (*m_err_eLOC0_fit)[i];
-      double resZ0 = (*m_err_eLOC1_fit)[i];
-      double resPh = (*m_err_ePHI_fit)[i];
-      double resTh = (*m_err_eTHETA_fit)[i];
-      double resQp = (*m_err_eQOP_fit)[i];
-      double resT = (*m_err_eT_fit)[i];
+      double resD0 = (*input->err_eLOC0_fit)[i];
+      double resZ0 = (*input->err_eLOC1_fit)[i];
+      double resPh = (*input->err_ePHI_fit)[i];
+      double resTh = (*input->err_eTHETA_fit)[i];
+      double resQp = (*input->err_eQOP_fit)[i];
+      double resT = (*input->err_eT_fit)[i];
 
       // Fill vector of track objects with simple covariance matrix
       Acts::BoundSymMatrix covMat;
@@ -205,14 +333,15 @@ ActsExamples::ProcessCode ActsExamples::RootTrajectorySummaryReader::read(
           perigeeSurface, paramVec, std::move(covMat)));
     }
 
-    unsigned int nTruthParticles = m_t_vx->size();
+    unsigned int nTruthParticles = input->t_vx->size();
     for (unsigned int i = 0; i < nTruthParticles; i++) {
       ActsFatras::Particle truthParticle;
 
-      truthParticle.setPosition4((*m_t_vx)[i], (*m_t_vy)[i], (*m_t_vz)[i],
-                                 (*m_t_time)[i]);
-      truthParticle.setDirection((*m_t_px)[i], (*m_t_py)[i], (*m_t_pz)[i]);
-      truthParticle.setParticleId((*m_majorityParticleId)[i]);
+      truthParticle.setPosition4((*input->t_vx)[i], (*input->t_vy)[i],
+                                 (*input->t_vz)[i], (*input->t_time)[i]);
+      truthParticle.setDirection((*input->t_px)[i], (*input->t_py)[i],
+                                 (*input->t_pz)[i]);
+      truthParticle.setParticleId((*input->majorityParticleId)[i]);
 
       truthParticleCollection.insert(truthParticleCollection.end(),
                                      truthParticle);
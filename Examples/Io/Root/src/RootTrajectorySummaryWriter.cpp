@@ -133,6 +133,15 @@ ActsExamples::ProcessCode ActsExamples::RootTrajectorySummaryWriter::endRun() {
   return ProcessCode::SUCCESS;
 }
 
+std::optional<ActsExamples::DataDependencies>
+ActsExamples::RootTrajectorySummaryWriter::dataDependencies() const {
+  return DataDependencies{
+      {m_cfg.inputTrajectories,
+       m_cfg.inputParticles,
+       m_cfg.inputMeasurementParticlesMap},
+      {}};
+}
+
 ActsExamples::ProcessCode ActsExamples::RootTrajectorySummaryWriter::writeT(
     const AlgorithmContext& ctx, const TrajectoriesContainer& trajectories) {
   using HitParticlesMap = IndexMultimap<ActsFatras::Barcode>;
@@ -14,6 +14,7 @@
 #include "ActsExamples/Framework/Sequencer.hpp"
 
 #include <string>
+#include <vector>
 
 #include <boost/program_options.hpp>
 
@@ -80,5 +81,15 @@ Sequencer::Config readSequencerConfig(
 RandomNumbers::Config readRandomNumbersConfig(
     const boost::program_options::variables_map& vm);
 
+/// Describe the values of all options in a reproducible text form.
+///
+/// Each option is written as `name=value` on its own line in alphabetical
+/// order, e.g. to identify the configuration of a checkpoint.
+///
+/// @param ignoredPrefixes Options starting with one of them are left out
+/// @throws std::invalid_argument for an option of an unsupported type
+std::string describeOptions(const boost::program_options::variables_map& vm,
+                            const std::vector<std::string>& ignoredPrefixes);
+
 }  // namespace Options
 }  // namespace ActsExamples
@@ -11,9 +11,14 @@
 #include "Acts/Utilities/Helpers.hpp"
 #include "ActsExamples/Utilities/Options.hpp"
 
+#include <algorithm>
 #include <exception>
 #include <fstream>
+#include <iomanip>
+#include <limits>
 #include <regex>
+#include <sstream>
+#include <stdexcept>
 #include <system_error>
 
 using namespace boost::program_options;
@@ -43,7 +48,16 @@ void ActsExamples::Options::addSequencerOptions(
       "skip", value<size_t>()->default_value(0),
       "The number of events to skip")("jobs,j", value<int>()->default_value(-1),
                                       "Number of parallel jobs, negative for "
-                                      "automatic.");
+                                      "automatic.")(
+      "dataflow", bool_switch(),
+      "Run independent algorithms of the same event in parallel.")(
+      "events-in-flight", value<size_t>()->default_value(0),
+      "Process events in a pipeline with at most this many events at the "
+      "same time; zero to disable.")(
+      "perf-counters", bool_switch(),
+      "Measure cycles, instructions, and cache misses of each algorithm. "
+      "Only the thread running an algorithm is measured, which misses work "
+      "on other threads and includes other algorithms it runs meanwhile.");
 }
 
 void ActsExamples::Options::addRandomNumbersOptions(
@@ -137,7 +151,9 @@ void ActsExamples::Options::addInputOptions(
       "input-json", value<bool>()->default_value(false),
       "Switch on to read '.json' file(s).")(
       "input-cbor", value<bool>()->default_value(false),
-      "Switch on to read '.cbor' file(s).");
+      "Switch on to read '.cbor' file(s).")(
+      "input-binary", value<bool>()->default_value(false),
+      "Switch on to read columnar '.bin' file(s).");
 }
 
 boost::program_options::variables_map ActsExamples::Options::parse(
@@ -195,6 +211,9 @@ ActsExamples::Sequencer::Config ActsExamples::Options::readSequencerConfig(
   }
   cfg.logLevel = readLogLevel(vm);
   cfg.numThreads = vm["jobs"].as<int>();
+  cfg.dataFlowScheduling = vm["dataflow"].as<bool>();
+  cfg.eventsInFlight = vm["events-in-flight"].as<size_t>();
+  cfg.hardwareCounters = vm["perf-counters"].as<bool>();
   if (not vm["output-dir"].empty()) {
     cfg.outputDir = vm["output-dir"].as<std::string>();
   }
@@ -209,3 +228,57 @@ ActsExamples::Options::readRandomNumbersConfig(
   cfg.seed = vm["rnd-seed"].as<uint64_t>();
   return cfg;
 }
+
+namespace {
+// write the value if it has one of the given types
+template <typename... value_ts>
+bool describeValue(std::ostream& os, const boost::any& value) {
+  auto describe = [&](auto* typed) {
+    if (typed == nullptr) {
+      return false;
+    }
+    os << *typed;
+    return true;
+  };
+  auto describeVector = [&](auto* typed) {
+    if (typed == nullptr) {
+      return false;
+    }
+    for (size_t i = 0; i < typed->size(); ++i) {
+      os << (0 < i ? " " : "") << (*typed)[i];
+    }
+    return true;
+  };
+  return (describe(boost::any_cast<value_ts>(&value)) or ...) or
+         (describeVector(boost::any_cast<std::vector<value_ts>>(&value)) or
+          ...);
+}
+}  // namespace
+
+std::string ActsExamples::Options::describeOptions(
+    const boost::program_options::variables_map& vm,
+    const std::vector<std::string>& ignoredPrefixes) {
+  std::ostringstream os;
+  // floating point values must be reproduced exactly
+  os << std::setprecision(std::numeric_limits<double>::max_digits10)
+     << std::boolalpha;
+  for (const auto& [name, variable] : vm) {
+    bool isIgnored = std::any_of(
+        ignoredPrefixes.begin(), ignoredPrefixes.end(),
+        [&](const std::string& prefix) { return name.rfind(prefix, 0) == 0; });
+    if (isIgnored or variable.empty()) {
+      continue;
+    }
+    os << name << '=';
+    if (not describeValue<std::string, bool, int, unsigned int, size_t,
+                          uint64_t, double, float, Interval, Reals<2>,
+                          Reals<3>, Reals<6>, Reals<15>, Integers<5>,
+                          VariableReals, VariableIntegers>(os,
+                                                           variable.value())) {
+      throw std::invalid_argument("Option '" + name +
+                                  "' has an unsupported type");
+    }
+    os << '\n';
+  }
+  return os.str();
+}
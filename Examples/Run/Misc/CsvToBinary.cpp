@@ -0,0 +1,102 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "ActsExamples/Framework/Sequencer.hpp"
+#include "ActsExamples/Io/Binary/BinaryMeasurementWriter.hpp"
+#include "ActsExamples/Io/Binary/BinaryParticleWriter.hpp"
+#include "ActsExamples/Io/Binary/BinarySimHitWriter.hpp"
+#include "ActsExamples/Io/Csv/CsvMeasurementReader.hpp"
+#include "ActsExamples/Io/Csv/CsvOptionsReader.hpp"
+#include "ActsExamples/Io/Csv/CsvParticleReader.hpp"
+#include "ActsExamples/Io/Csv/CsvSimHitReader.hpp"
+#include "ActsExamples/Options/CommonOptions.hpp"
+#include "ActsExamples/Utilities/Paths.hpp"
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+using namespace ActsExamples;
+
+// Convert the per-event CSV files of the simulation and digitization
+// examples into columnar binary files with all events.
+//
+// All particle, simulated hit, and measurement files found in the input
+// directory are converted.
+int main(int argc, char* argv[]) {
+  // setup and parse options
+  auto desc = Options::makeDefaultOptions();
+  Options::addSequencerOptions(desc);
+  Options::addInputOptions(desc);
+  Options::addOutputOptions(desc, OutputFormat::DirectoryOnly);
+  auto vm = Options::parse(desc, argc, argv);
+  if (vm.empty()) {
+    return EXIT_FAILURE;
+  }
+
+  Sequencer sequencer(Options::readSequencerConfig(vm));
+
+  Acts::Logging::Level logLevel = Options::readLogLevel(vm);
+  auto inputDir = vm["input-dir"].as<std::string>();
+  auto outputDir = ensureWritableDirectory(vm["output-dir"].as<std::string>());
+  auto hasFiles = [&](const std::string& name) {
+    auto range = determineEventFilesRange(inputDir, name);
+    return range.first < range.second;
+  };
+
+  for (std::string stem : {"particles_initial", "particles_final"}) {
+    if (not hasFiles(stem + ".csv")) {
+      continue;
+    }
+    auto particleReader = Options::readCsvParticleReaderConfig(vm);
+    particleReader.inputStem = stem;
+    particleReader.outputParticles = stem;
+    sequencer.addReader(
+        std::make_shared<CsvParticleReader>(particleReader, logLevel));
+
+    BinaryParticleWriter::Config particleWriter;
+    particleWriter.inputParticles = stem;
+    particleWriter.outputDir = outputDir;
+    particleWriter.outputStem = stem;
+    sequencer.addWriter(
+        std::make_shared<BinaryParticleWriter>(particleWriter, logLevel));
+  }
+
+  if (hasFiles("hits.csv")) {
+    auto simHitReader = Options::readCsvSimHitReaderConfig(vm);
+    simHitReader.inputStem = "hits";
+    simHitReader.outputSimHits = "hits";
+    sequencer.addReader(
+        std::make_shared<CsvSimHitReader>(simHitReader, logLevel));
+
+    BinarySimHitWriter::Config simHitWriter;
+    simHitWriter.inputSimHits = "hits";
+    simHitWriter.outputDir = outputDir;
+    simHitWriter.outputStem = "hits";
+    sequencer.addWriter(
+        std::make_shared<BinarySimHitWriter>(simHitWriter, logLevel));
+  }
+
+  if (hasFiles("measurements.csv")) {
+    auto measurementReader = Options::readCsvMeasurementReaderConfig(vm);
+    measurementReader.outputMeasurements = "measurements";
+    measurementReader.outputMeasurementSimHitsMap = "measurement_simhits_map";
+    measurementReader.outputSourceLinks = "sourcelinks";
+    sequencer.addReader(
+        std::make_shared<CsvMeasurementReader>(measurementReader, logLevel));
+
+    BinaryMeasurementWriter::Config measurementWriter;
+    measurementWriter.inputMeasurements = "measurements";
+    measurementWriter.inputMeasurementSimHitsMap = "measurement_simhits_map";
+    measurementWriter.outputDir = outputDir;
+    sequencer.addWriter(
+        std::make_shared<BinaryMeasurementWriter>(measurementWriter, logLevel));
+  }
+
+  return sequencer.run();
+}
@@ -14,6 +14,8 @@
 #include "ActsExamples/Framework/Sequencer.hpp"
 #include "ActsExamples/Framework/WhiteBoard.hpp"
 #include "ActsExamples/Geometry/CommonGeometry.hpp"
+#include "ActsExamples/Io/Binary/BinaryCheckpointReader.hpp"
+#include "ActsExamples/Io/Binary/BinaryCheckpointWriter.hpp"
 #include "ActsExamples/Io/Csv/CsvMultiTrajectoryWriter.hpp"
 #include "ActsExamples/Io/Csv/CsvOptionsReader.hpp"
 #include "ActsExamples/Io/Csv/CsvOptionsWriter.hpp"
@@ -25,6 +27,7 @@
 #include "ActsExamples/Io/Root/RootTrajectorySummaryWriter.hpp"
 #include "ActsExamples/MagneticField/MagneticFieldOptions.hpp"
 #include "ActsExamples/Options/CommonOptions.hpp"
+#include "ActsExamples/TrackFinding/AmbiguityResolutionAlgorithm.hpp"
 #include "ActsExamples/TrackFinding/SeedingAlgorithm.hpp"
 #include "ActsExamples/TrackFinding/SpacePointMaker.hpp"
 #include "ActsExamples/TrackFinding/SpacePointMakerOptions.hpp"
@@ -52,12 +55,19 @@ using namespace std::placeholders;
 void addRecCKFOptions(ActsExamples::Options::Description& desc) {
   using namespace ActsExamples;
   using boost::program_options::bool_switch;
+  using boost::program_options::value;
 
   auto opt = desc.add_options();
   opt("ckf-truth-smeared-seeds", bool_switch(),
       "Use track parameters smeared from truth particles for steering CKF");
   opt("ckf-truth-estimated-seeds", bool_switch(),
       "Use track parameters estimated from truth tracks for steering CKF");
+  opt("ckf-resolve-ambiguities", bool_switch(),
+      "Remove duplicated CKF track candidates with a greedy shared-hit "
+      "ambiguity resolution");
+  opt("checkpoint-dir", value<std::string>()->default_value(""),
+      "Store the event data up to the seeding in this directory and replay "
+      "it in later runs with the same configuration; empty to disable.");
 }
 
 int runRecCKFTracks(int argc, char* argv[],
@@ -84,6 +94,14 @@ int runRecCKFTracks(int argc, char* argv[],
   if (vm.empty()) {
     return EXIT_FAILURE;
   }
+  // options that do not change the event data up to the checkpoint; the
+  // choice of the seeds does and the ckf-truth-* options are kept. The
+  // events range is kept as well since the checkpoint only contains the
+  // events of the run that wrote it.
+  std::vector<std::string> ignoredOptions = {
+      "checkpoint-", "ckf-initial", "ckf-resolve", "ckf-seed",
+      "ckf-selection", "dataflow", "events-in-flight", "fit-", "jobs",
+      "loglevel", "output-", "perf-", "response-file"};
 
   Sequencer sequencer(Options::readSequencerConfig(vm));
 
@@ -96,6 +114,7 @@ int runRecCKFTracks(int argc, char* argv[],
   bool truthSmearedSeeded = vm["ckf-truth-smeared-seeds"].template as<bool>();
   bool truthEstimatedSeeded =
       vm["ckf-truth-estimated-seeds"].template as<bool>();
+  auto checkpointDir = vm["checkpoint-dir"].as<std::string>();
 
   // Setup detector geometry
   auto geometry = Geometry::build(vm, *detector);
@@ -107,6 +126,12 @@ int runRecCKFTracks(int argc, char* argv[],
   // Setup the magnetic field
   auto magneticField = Options::readMagneticField(vm);
 
+  // Event data stored in or replayed from the checkpoint
+  BinaryCheckpoint checkpoint;
+  checkpoint.cacheDir = checkpointDir;
+  checkpoint.name = "seeding";
+  checkpoint.configuration = Options::describeOptions(vm, ignoredOptions);
+
   // Read the sim hits
   auto simHitReaderCfg = setupSimHitReading(vm, sequencer);
   // Read the particles
@@ -115,6 +140,13 @@ int runRecCKFTracks(int argc, char* argv[],
   // Run the sim hits smearing
   auto digiCfg = setupDigitization(vm, sequencer, rnd, trackingGeometry,
                                    simHitReaderCfg.outputSimHits);
+  using Type = CheckpointCollectionType;
+  checkpoint.collections = {
+      {digiCfg.outputMeasurements, Type::Measurements},
+      {digiCfg.outputSourceLinks, Type::SourceLinks},
+      {digiCfg.outputMeasurementParticlesMap, Type::MeasurementParticlesMap},
+      {digiCfg.outputMeasurementSimHitsMap, Type::MeasurementSimHitsMap},
+  };
 
   // Run the particle selection
   // The pre-selection will select truth particles satisfying provided criteria
@@ -129,6 +161,8 @@ int runRecCKFTracks(int argc, char* argv[],
   particleSelectorCfg.nHitsMin = 9;
   sequencer.addAlgorithm(
       std::make_shared<TruthSeedSelector>(particleSelectorCfg, logLevel));
+  checkpoint.collections.push_back(
+      {particleSelectorCfg.outputParticles, Type::Particles});
 
   // The selected particles
   const auto& inputParticles = particleSelectorCfg.outputParticles;
@@ -149,6 +183,8 @@ int runRecCKFTracks(int argc, char* argv[],
     spCfg.outputSpacePoints = "spacepoints";
     spCfg.trackingGeometry = trackingGeometry;
     sequencer.addAlgorithm(std::make_shared<SpacePointMaker>(spCfg, logLevel));
+    checkpoint.collections.push_back(
+        {spCfg.outputSpacePoints, Type::SpacePoints});
 
     // Create seeds (i.e. proto tracks) using either truth track finding or seed
     // finding algorithm
@@ -164,6 +200,7 @@ int runRecCKFTracks(int argc, char* argv[],
       sequencer.addAlgorithm(
           std::make_shared<TruthTrackFinder>(trackFinderCfg, logLevel));
       inputProtoTracks = trackFinderCfg.outputProtoTracks;
+      checkpoint.collections.push_back({inputProtoTracks, Type::ProtoTracks});
     } else {
       // Seeding algorithm
       SeedingAlgorithm::Config seedingCfg;
@@ -191,6 +228,9 @@ int runRecCKFTracks(int argc, char* argv[],
           std::make_shared<SeedingAlgorithm>(seedingCfg, logLevel));
       inputProtoTracks = seedingCfg.outputProtoTracks;
       inputSeeds = seedingCfg.outputSeeds;
+      checkpoint.collections.push_back(
+          {inputSeeds, Type::Seeds, spCfg.outputSpacePoints});
+      checkpoint.collections.push_back({inputProtoTracks, Type::ProtoTracks});
     }
 
     // write track finding/seeding performance
@@ -235,6 +275,18 @@ int runRecCKFTracks(int argc, char* argv[],
     outputTrackParameters = paramsEstimationCfg.outputTrackParameters;
   }
 
+  // Replace the algorithms up to here by the stored event data if possible;
+  // the sequencer skips the algorithms whose outputs are read.
+  if (not checkpointDir.empty()) {
+    if (checkpoint.exists()) {
+      sequencer.addReader(
+          std::make_shared<BinaryCheckpointReader>(checkpoint, logLevel));
+    } else {
+      sequencer.addWriter(
+          std::make_shared<BinaryCheckpointWriter>(checkpoint, logLevel));
+    }
+  }
+
   // Setup the track finding algorithm with CKF
   // It takes all the source links created from truth hit smearing, seeds from
   // truth particle smearing and source link selection config
@@ -248,9 +300,24 @@ int runRecCKFTracks(int argc, char* argv[],
   sequencer.addAlgorithm(
       std::make_shared<TrackFindingAlgorithm>(trackFindingCfg, logLevel));
 
+  // Optionally remove duplicated track candidates before writing
+  auto outputTrajectories = trackFindingCfg.outputTrajectories;
+  if (vm["ckf-resolve-ambiguities"].template as<bool>()) {
+    AmbiguityResolutionAlgorithm::Config ambiguityResolutionCfg;
+    ambiguityResolutionCfg.inputMeasurements = digiCfg.outputMeasurements;
+    ambiguityResolutionCfg.inputTrajectories =
+        trackFindingCfg.outputTrajectories;
+    ambiguityResolutionCfg.outputTrajectories = "trajectories_resolved";
+    // The bottom seed could be the first, second or third hits on the track
+    ambiguityResolutionCfg.nMeasurementsMin = particleSelectorCfg.nHitsMin - 3;
+    sequencer.addAlgorithm(std::make_shared<AmbiguityResolutionAlgorithm>(
+        ambiguityResolutionCfg, logLevel));
+    outputTrajectories = ambiguityResolutionCfg.outputTrajectories;
+  }
+
   // write track states from CKF
   RootTrajectoryStatesWriter::Config trackStatesWriter;
-  trackStatesWriter.inputTrajectories = trackFindingCfg.outputTrajectories;
+  trackStatesWriter.inputTrajectories = outputTrajectories;
   // @note The full particles collection is used here to avoid lots of warnings
   // since the unselected CKF track might have a majority particle not in the
   // filtered particle collection. This could be avoided when a seperate track
@@ -269,7 +336,7 @@ int runRecCKFTracks(int argc, char* argv[],
 
   // write track summary from CKF
   RootTrajectorySummaryWriter::Config trackSummaryWriter;
-  trackSummaryWriter.inputTrajectories = trackFindingCfg.outputTrajectories;
+  trackSummaryWriter.inputTrajectories = outputTrajectories;
   // @note The full particles collection is used here to avoid lots of warnings
   // since the unselected CKF track might have a majority particle not in the
   // filtered particle collection. This could be avoided when a seperate track
@@ -286,7 +353,7 @@ int runRecCKFTracks(int argc, char* argv[],
   // Write CKF performance data
   CKFPerformanceWriter::Config perfWriterCfg;
   perfWriterCfg.inputParticles = inputParticles;
-  perfWriterCfg.inputTrajectories = trackFindingCfg.outputTrajectories;
+  perfWriterCfg.inputTrajectories = outputTrajectories;
   perfWriterCfg.inputMeasurementParticlesMap =
       digiCfg.outputMeasurementParticlesMap;
   // The bottom seed could be the first, second or third hits on the truth track
@@ -315,7 +382,7 @@ int runRecCKFTracks(int argc, char* argv[],
   if (vm["output-csv"].template as<bool>()) {
     // Write the CKF track as Csv
     CsvMultiTrajectoryWriter::Config trackWriterCsvConfig;
-    trackWriterCsvConfig.inputTrajectories = trackFindingCfg.outputTrajectories;
+    trackWriterCsvConfig.inputTrajectories = outputTrajectories;
     trackWriterCsvConfig.outputDir = outputDir;
     trackWriterCsvConfig.inputMeasurementParticlesMap =
         digiCfg.outputMeasurementParticlesMap;
@@ -13,6 +13,8 @@
 #include "ActsExamples/Digitization/DigitizationOptions.hpp"
 #include "ActsExamples/Digitization/SmearingAlgorithm.hpp"
 #include "ActsExamples/Geometry/CommonGeometry.hpp"
+#include "ActsExamples/Io/Binary/BinaryParticleReader.hpp"
+#include "ActsExamples/Io/Binary/BinarySimHitReader.hpp"
 #include "ActsExamples/Io/Json/JsonDigitizationConfig.hpp"
 #include "ActsExamples/Io/Performance/CKFPerformanceWriter.hpp"
 #include "ActsExamples/Io/Performance/SeedingPerformanceWriter.hpp"
@@ -41,12 +43,22 @@ ActsExamples::CsvSimHitReader::Config setupSimHitReading(
   // Read some standard options
   auto logLevel = Options::readLogLevel(vars);
 
-  // Read truth hits from CSV files
   auto simHitReaderCfg = Options::readCsvSimHitReaderConfig(vars);
   simHitReaderCfg.inputStem = "hits";
   simHitReaderCfg.outputSimHits = "hits";
-  sequencer.addReader(
-      std::make_shared<CsvSimHitReader>(simHitReaderCfg, logLevel));
+  if (vars["input-binary"].as<bool>()) {
+    // Read truth hits from the columnar binary file
+    BinarySimHitReader::Config binaryReaderCfg;
+    binaryReaderCfg.inputDir = simHitReaderCfg.inputDir;
+    binaryReaderCfg.inputStem = simHitReaderCfg.inputStem;
+    binaryReaderCfg.outputSimHits = simHitReaderCfg.outputSimHits;
+    sequencer.addReader(
+        std::make_shared<BinarySimHitReader>(binaryReaderCfg, logLevel));
+  } else {
+    // Read truth hits from CSV files
+    sequencer.addReader(
+        std::make_shared<CsvSimHitReader>(simHitReaderCfg, logLevel));
+  }
 
   return simHitReaderCfg;
 }
@@ -59,12 +71,22 @@ ActsExamples::CsvParticleReader::Config setupParticleReading(
   // Read some standard options
   auto logLevel = Options::readLogLevel(vars);
 
-  // Read particles (initial states) and clusters from CSV files
   auto particleReader = Options::readCsvParticleReaderConfig(vars);
   particleReader.inputStem = "particles_initial";
   particleReader.outputParticles = "particles_initial";
-  sequencer.addReader(
-      std::make_shared<CsvParticleReader>(particleReader, logLevel));
+  if (vars["input-binary"].as<bool>()) {
+    // Read particles (initial states) from the columnar binary file
+    BinaryParticleReader::Config binaryReaderCfg;
+    binaryReaderCfg.inputDir = particleReader.inputDir;
+    binaryReaderCfg.inputStem = particleReader.inputStem;
+    binaryReaderCfg.outputParticles = particleReader.outputParticles;
+    sequencer.addReader(
+        std::make_shared<BinaryParticleReader>(binaryReaderCfg, logLevel));
+  } else {
+    // Read particles (initial states) and clusters from CSV files
+    sequencer.addReader(
+        std::make_shared<CsvParticleReader>(particleReader, logLevel));
+  }
 
   return particleReader;
 }
@@ -23,22 +23,24 @@
 
 #include <boost/filesystem.hpp>
 
-/// Setup sim hit csv reader
+/// Setup sim hit csv reader, or the binary reader with `--input-binary`
 ///
 /// @param vars The configuration variables
 /// @param sequencer The framework sequencer
 ///
-/// @return config for sim hits csv reader
+/// @return config for sim hits csv reader, with the same output collection
+///         as the binary reader
 ActsExamples::CsvSimHitReader::Config setupSimHitReading(
     const ActsExamples::Options::Variables& vars,
     ActsExamples::Sequencer& sequencer);
 
-/// Setup sim particle csv reader
+/// Setup sim particle csv reader, or the binary reader with `--input-binary`
 ///
 /// @param vars The configuration variables
 /// @param sequencer The framework sequencer
 ///
-/// @return config for sim particles csv reader
+/// @return config for sim particles csv reader, with the same output
+///         collection as the binary reader
 ActsExamples::CsvParticleReader::Config setupParticleReading(
     const ActsExamples::Options::Variables& vars,
     ActsExamples::Sequencer& sequencer);
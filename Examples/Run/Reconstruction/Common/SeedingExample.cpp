@@ -15,6 +15,7 @@
 #include "ActsExamples/Io/Csv/CsvOptionsReader.hpp"
 #include "ActsExamples/Io/Csv/CsvParticleReader.hpp"
 #include "ActsExamples/Io/Csv/CsvSimHitReader.hpp"
+#include "ActsExamples/Io/Csv/CsvSpacePointWriter.hpp"
 #include "ActsExamples/Io/Performance/SeedingPerformanceWriter.hpp"
 #include "ActsExamples/Io/Performance/TrackFinderPerformanceWriter.hpp"
 #include "ActsExamples/Io/Root/RootTrackParameterWriter.hpp"
@@ -45,7 +46,7 @@ int runSeedingExample(int argc, char* argv[],
   Options::addRandomNumbersOptions(desc);
   Options::addGeometryOptions(desc);
   Options::addMaterialOptions(desc);
-  Options::addOutputOptions(desc, OutputFormat::DirectoryOnly);
+  Options::addOutputOptions(desc, OutputFormat::Csv);
   Options::addInputOptions(desc);
   Options::addMagneticFieldOptions(desc);
   Options::addSpacePointMakerOptions(desc);
@@ -114,6 +115,15 @@ int runSeedingExample(int argc, char* argv[],
   spCfg.trackingGeometry = tGeometry;
   sequencer.addAlgorithm(std::make_shared<SpacePointMaker>(spCfg, logLevel));
 
+  if (vm["output-csv"].template as<bool>()) {
+    // Write the space points as Csv, e.g. to replay them in benchmarks
+    CsvSpacePointWriter::Config spWriterCsvConfig;
+    spWriterCsvConfig.inputSpacePoints = spCfg.outputSpacePoints;
+    spWriterCsvConfig.outputDir = outputDir;
+    sequencer.addWriter(std::make_shared<CsvSpacePointWriter>(
+        spWriterCsvConfig, logLevel));
+  }
+
   // Seeding algorithm
   SeedingAlgorithm::Config seedingCfg;
   seedingCfg.inputSpacePoints = {
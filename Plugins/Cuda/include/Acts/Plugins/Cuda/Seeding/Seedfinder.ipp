@@ -256,8 +256,7 @@ Seedfinder<external_spacepoint_t, Acts::Cuda>::createSeedsForGroup(
 
     if (i_m > 0) {
       const auto m_experimentCuts = m_config.seedFilter->getExperimentCuts();
-      std::vector<std::pair<
-          float, std::unique_ptr<const InternalSeed<external_spacepoint_t>>>>
+      std::vector<std::pair<float, InternalSeed<external_spacepoint_t>>>
           seedsPerSpM;
 
       for (int i = 0; i < *nTrplPerSpM_cpu.get(i_m - 1); i++) {
@@ -283,10 +282,9 @@ Seedfinder<external_spacepoint_t, Acts::Cuda>::createSeedsForGroup(
         float Zob = 0;  // It is not used in the seed filter but needs to be
                         // fixed anyway...
 
-        seedsPerSpM.push_back(std::make_pair(
-            triplet.weight,
-            std::make_unique<const InternalSeed<external_spacepoint_t>>(
-                bottomSP, middleSP, topSP, Zob)));
+        seedsPerSpM.emplace_back(
+            triplet.weight, InternalSeed<external_spacepoint_t>(
+                                bottomSP, middleSP, topSP, Zob));
       }
 
       m_config.seedFilter->filterSeeds_1SpFixed(seedsPerSpM, outputVec);
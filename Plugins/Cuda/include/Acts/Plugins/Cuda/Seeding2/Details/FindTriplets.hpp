@@ -10,6 +10,7 @@
 
 // CUDA plugin include(s).
 #include "Acts/Plugins/Cuda/Seeding2/Details/Types.hpp"
+#include "Acts/Plugins/Cuda/Seeding2/TripletFilterConfig.hpp"
 #include "Acts/Plugins/Cuda/Utilities/Arrays.hpp"
 #include "Acts/Plugins/Cuda/Utilities/Info.hpp"
 
@@ -23,10 +24,6 @@ namespace Acts {
 struct SeedFilterConfig;
 
 namespace Cuda {
-
-// Forward declaration(s).
-struct TripletFilterConfig;
-
 namespace Details {
 
 /// Find all viable triplets from the provided spacepoint dublets
@@ -8,53 +8,27 @@
 
 #pragma once
 
+// Acts include(s).
+#include "Acts/Seeding/FlatSeedingTypes.hpp"
+
 namespace Acts {
 namespace Cuda {
 namespace Details {
 
+/// The flat data layout is shared with the host based
+/// @c Acts::SeedfinderFlat, such that results can be compared directly.
+
 /// Helper struct describing a spacepoint on the device
-struct SpacePoint {
-  float x = 0.0f;       ///< x-coordinate in beam system coordinates
-  float y = 0.0f;       ///< y-coordinate in beam system coordinates
-  float z = 0.0f;       ///< z-coordinate in beam system coordinates
-  float radius = 0.0f;  ///< radius in beam system coordinates
-  float varianceR = 0.0f;
-  float varianceZ = 0.0f;
-};  // struct SpacePoint
+using SpacePoint = Acts::FlatSeeding::SpacePoint;
 
 /// Helper struct summarising the results of the dublet search
-struct DubletCounts {
-  /// The total number of dublets (M-B and M-T) found
-  unsigned int nDublets = 0;
-  /// The total number of triplet candidates found
-  unsigned int nTriplets = 0;
-  /// The maximal number of middle-bottom dublets
-  unsigned int maxMBDublets = 0;
-  /// The maximal number of middle-top dublets
-  unsigned int maxMTDublets = 0;
-  /// The maximal number of triplets for any middle SP
-  unsigned int maxTriplets = 0;
-};  // struct DubletCounts
+using DubletCounts = Acts::FlatSeeding::DubletCounts;
 
 /// Helper struct holding the linearly transformed coordinates of spacepoints
-struct LinCircle {
-  float Zo = 0.0f;
-  float cotTheta = 0.0f;
-  float iDeltaR = 0.0f;
-  float Er = 0.0f;
-  float U = 0.0f;
-  float V = 0.0f;
-};  // struct LinCircle
+using LinCircle = Acts::FlatSeeding::LinCircle;
 
 /// Structure used in the CUDA-based triplet finding
-struct Triplet {
-  unsigned int bottomIndex = static_cast<unsigned int>(-1);
-  unsigned int middleIndex = static_cast<unsigned int>(-1);
-  unsigned int topIndex = static_cast<unsigned int>(-1);
-  float impactParameter = 0.0f;
-  float invHelixDiameter = 0.0f;
-  float weight = 0.0f;
-};  // struct Triplet
+using Triplet = Acts::FlatSeeding::Triplet;
 
 }  // namespace Details
 }  // namespace Cuda
@@ -190,8 +190,7 @@ SeedFinder<external_spacepoint_t>::createSeedsForGroup(
   auto triplet_itr = tripletCandidates.begin();
   auto triplet_end = tripletCandidates.end();
   for (; triplet_itr != triplet_end; ++triplet_itr, ++middleIndex) {
-    std::vector<std::pair<
-        float, std::unique_ptr<const InternalSeed<external_spacepoint_t>>>>
+    std::vector<std::pair<float, InternalSeed<external_spacepoint_t>>>
         seedsPerSPM;
     const auto& middleSP = *(middleSPVec[middleIndex]);
     for (const Details::Triplet& triplet : *triplet_itr) {
@@ -199,10 +198,9 @@ SeedFinder<external_spacepoint_t>::createSeedsForGroup(
       const auto& bottomSP = *(bottomSPVec[triplet.bottomIndex]);
       assert(triplet.topIndex < topSPVec.size());
       const auto& topSP = *(topSPVec[triplet.topIndex]);
-      seedsPerSPM.emplace_back(std::make_pair(
+      seedsPerSPM.emplace_back(
           triplet.weight,
-          std::make_unique<const InternalSeed<external_spacepoint_t>>(
-              bottomSP, middleSP, topSP, 0)));
+          InternalSeed<external_spacepoint_t>(bottomSP, middleSP, topSP, 0));
     }
     m_commonConfig.seedFilter->filterSeeds_1SpFixed(seedsPerSPM, outputVec);
   }
@@ -15,41 +15,12 @@ namespace Acts {
 namespace Cuda {
 
 /// Structure holding pointers to the user defined filter functions
-struct TripletFilterConfig {
-  /// Type for the seed weighting functions
-  typedef float (*seedWeightFunc_t)(const Details::SpacePoint&,
-                                    const Details::SpacePoint&,
-                                    const Details::SpacePoint&);
-
-  /// Pointer to a function assigning weights to seed candidates
-  ///
-  /// The function receives the bottom, middle and top spacepoints (in this
-  /// order), and needs to return a float weight for the combination.
-  ///
-  /// Note that you can not set this pointer directly. You must use
-  /// @c cudaMemcpyFromSymbol to set it from a global @c __device__ function
-  /// pointer.
-  ///
-  seedWeightFunc_t seedWeight = nullptr;
-
-  /// Type for the seed filtering functions
-  typedef bool (*singleSeedCutFunc_t)(float, const Details::SpacePoint&,
-                                      const Details::SpacePoint&,
-                                      const Details::SpacePoint&);
-
-  /// Pointer to a function filtering seed candidates
-  ///
-  /// The function receives a previously assigned "seed weight", and references
-  /// to the bottom, middle and top spacepoints (in this order). It needs to
-  /// return an accept/reject decision for the combination.
-  ///
-  /// Note that you can not set this pointer directly. You must use
-  /// @c cudaMemcpyFromSymbol to set it from a global @c __device__ function
-  /// pointer.
-  ///
-  singleSeedCutFunc_t singleSeedCut = nullptr;
-
-};  // struct TripletFinderConfig
+///
+/// Note that you can not set the function pointers directly. You must use
+/// @c cudaMemcpyFromSymbol to set them from global @c __device__ function
+/// pointers.
+///
+using TripletFilterConfig = Acts::FlatSeeding::TripletFilterConfig;
 
 }  // namespace Cuda
 }  // namespace Acts
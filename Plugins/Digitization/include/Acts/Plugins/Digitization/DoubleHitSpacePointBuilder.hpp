@@ -59,6 +59,9 @@ class SpacePointBuilder<SpacePoint<Cluster>> {
   /// @param clusterPairs storage of the cluster pairs
   /// @note The structure of @p clustersFront and @p clustersBack is meant to be
   /// clusters[Independent clusters on a single surface]
+  /// @note The clusters in @p clustersBack are sorted in phi once, such that
+  /// only the back clusters within the accepted phi difference are compared
+  /// with each front cluster.
   void makeClusterPairs(const GeometryContext& gctx,
                         const std::vector<const Cluster*>& clustersFront,
                         const std::vector<const Cluster*>& clustersBack,
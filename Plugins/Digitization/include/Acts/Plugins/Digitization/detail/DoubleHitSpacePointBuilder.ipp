@@ -8,8 +8,11 @@
 
 #include "Acts/Utilities/Helpers.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <utility>
+#include <vector>
 
 namespace Acts {
 namespace detail {
@@ -346,38 +349,60 @@ void Acts::SpacePointBuilder<Acts::SpacePoint<Cluster>>::makeClusterPairs(
     return;
   }
 
-  // Declare helper variables
-  double currentDiff;
-  double diffMin;
-  unsigned int clusterMinDist;
+  // Calculate the global positions of the back clusters once and sort them
+  // by their azimuthal angle around the vertex
+  std::vector<Vector3> positionsBack;
+  positionsBack.reserve(clustersBack.size());
+  std::vector<std::pair<double, unsigned int>> phiBack;
+  phiBack.reserve(clustersBack.size());
+  for (unsigned int iClustersBack = 0; iClustersBack < clustersBack.size();
+       iClustersBack++) {
+    positionsBack.push_back(globalCoords(gctx, *(clustersBack[iClustersBack])));
+    phiBack.emplace_back(
+        VectorHelpers::phi(positionsBack.back() - m_cfg.vertex), iClustersBack);
+  }
+  std::sort(phiBack.begin(), phiBack.end());
+
+  // Only back clusters within the accepted phi difference can be paired. The
+  // window is widened slightly against rounding, the exact check is done by
+  // the comparison of the clusters.
+  const double maxDeltaPhi = std::sqrt(m_cfg.diffPhi2) * (1. + 1e-9);
 
-  // Walk through all clusters on both surfaces
+  // Walk through all clusters on the front surface
   for (unsigned int iClustersFront = 0; iClustersFront < clustersFront.size();
        iClustersFront++) {
+    const Vector3 positionFront =
+        globalCoords(gctx, *(clustersFront[iClustersFront]));
+    const double phiFront = VectorHelpers::phi(positionFront - m_cfg.vertex);
     // Set the closest distance to the maximum of double
-    diffMin = std::numeric_limits<double>::max();
+    double diffMin = std::numeric_limits<double>::max();
     // Set the corresponding index to an element not in the list of clusters
-    clusterMinDist = clustersBack.size();
-    for (unsigned int iClustersBack = 0; iClustersBack < clustersBack.size();
-         iClustersBack++) {
+    unsigned int clusterMinDist = clustersBack.size();
+    auto itBack = std::lower_bound(
+        phiBack.begin(), phiBack.end(), phiFront - maxDeltaPhi,
+        [](const auto& lhs, double rhs) { return lhs.first < rhs; });
+    for (; itBack != phiBack.end() && itBack->first <= phiFront + maxDeltaPhi;
+         ++itBack) {
       // Calculate the distances between the hits
-      currentDiff = detail::differenceOfClustersChecked(
-          globalCoords(gctx, *(clustersFront[iClustersFront])),
-          globalCoords(gctx, *(clustersBack[iClustersBack])), m_cfg.vertex,
-          m_cfg.diffDist, m_cfg.diffPhi2, m_cfg.diffTheta2);
-      // Store the closest clusters (distance and index) calculated so far
-      if (currentDiff < diffMin && currentDiff >= 0.) {
+      double currentDiff = detail::differenceOfClustersChecked(
+          positionFront, positionsBack[itBack->second], m_cfg.vertex,
+          m_cfg.diffDist, m_cfg.diffTheta2, m_cfg.diffPhi2);
+      if (currentDiff < 0.) {
+        continue;
+      }
+      // Store the closest clusters (distance and index) calculated so far,
+      // preferring the first one in the input for equal distances
+      if (currentDiff < diffMin ||
+          (currentDiff == diffMin && itBack->second < clusterMinDist)) {
         diffMin = currentDiff;
-        clusterMinDist = iClustersBack;
+        clusterMinDist = itBack->second;
       }
     }
 
     // Store the best (=closest) result
     if (clusterMinDist < clustersBack.size()) {
-      std::pair<const Cluster*, const Cluster*> clusterPair;
-      clusterPair = std::make_pair(clustersFront[iClustersFront],
-                                   clustersBack[clusterMinDist]);
-      clusterPairs.push_back(clusterPair);
+      clusterPairs.emplace_back(clustersFront[iClustersFront],
+                                clustersBack[clusterMinDist]);
     }
   }
 }
@@ -112,8 +112,7 @@ Seedfinder<external_spacepoint_t>::createSeedsForGroup(
 
   // Iterate through seeds returned by the SYCL algorithm and perform the last
   // step of filtering for fixed middle SP.
-  std::vector<std::pair<
-      float, std::unique_ptr<const InternalSeed<external_spacepoint_t>>>>
+  std::vector<std::pair<float, InternalSeed<external_spacepoint_t>>>
       seedsPerSPM;
   for (size_t mi = 0; mi < seeds.size(); ++mi) {
     seedsPerSPM.clear();
@@ -123,9 +122,9 @@ Seedfinder<external_spacepoint_t>::createSeedsForGroup(
       auto& topSP = *(topSPvec[seeds[mi][j].top]);
       float weight = seeds[mi][j].weight;
 
-      seedsPerSPM.emplace_back(std::make_pair(
-          weight, std::make_unique<const InternalSeed<external_spacepoint_t>>(
-                      bottomSP, middleSP, topSP, 0)));
+      seedsPerSPM.emplace_back(
+          weight,
+          InternalSeed<external_spacepoint_t>(bottomSP, middleSP, topSP, 0));
     }
     m_config.seedFilter->filterSeeds_1SpFixed(seedsPerSPM, outputVec);
   }
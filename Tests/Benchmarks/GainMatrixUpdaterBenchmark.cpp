@@ -0,0 +1,100 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Definitions/TrackParametrization.hpp"
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/Geometry/GeometryContext.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+#include "Acts/Tests/CommonHelpers/TestSourceLink.hpp"
+#include "Acts/TrackFitting/GainMatrixUpdater.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <random>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+  using namespace Acts;
+  using namespace Acts::Test;
+
+  size_t states = 1000;
+  size_t runs = 1000;
+  if (argc >= 2) {
+    states = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    runs = std::stoi(argv[2]);
+  }
+
+  ACTS_LOCAL_LOGGER(
+      getDefaultLogger("GainMatrixUpdater", Acts::Logging::Level(0)));
+
+  GeometryContext gctx;
+  GainMatrixUpdater updater;
+  TestSourceLinkCalibrator calibrator;
+
+  std::minstd_rand rng;
+  std::normal_distribution<> normal(0., 1.);
+  std::uniform_real_distribution<> uniform(0.5, 1.5);
+
+  // one state per track, i.e. the states on the current surface of many
+  // tracks fitted in lockstep. every other state is a 1d strip measurement.
+  MultiTrajectory<TestSourceLink> traj;
+  std::vector<decltype(traj.getTrackState(0))> trackStates;
+  for (size_t i = 0; i < states; ++i) {
+    auto ts = traj.getTrackState(traj.addTrackState(TrackStatePropMask::All));
+    BoundVector predicted;
+    predicted << normal(rng), normal(rng), 0.5 * M_PI, 0.3 * M_PI, 0.01, 0.;
+    BoundSymMatrix predictedCovariance = BoundSymMatrix::Identity();
+    predictedCovariance.diagonal() *= uniform(rng);
+    predictedCovariance(eBoundLoc0, eBoundPhi) = 0.076;
+    predictedCovariance(eBoundPhi, eBoundLoc0) = 0.076;
+    predictedCovariance(eBoundLoc1, eBoundTheta) = -0.007;
+    predictedCovariance(eBoundTheta, eBoundLoc1) = -0.007;
+    ts.predicted() = predicted;
+    ts.predictedCovariance() = predictedCovariance;
+    if (i % 2 == 0) {
+      ts.uncalibrated() = TestSourceLink(eBoundLoc0, normal(rng), 0.01);
+    } else {
+      ts.uncalibrated() =
+          TestSourceLink(eBoundLoc0, eBoundLoc1,
+                         Vector2(normal(rng), normal(rng)),
+                         Vector2(0.01, 0.04).asDiagonal());
+    }
+    std::visit([&](const auto& m) { ts.setCalibrated(m); },
+               calibrator(ts.uncalibrated(), nullptr));
+    trackStates.push_back(ts);
+  }
+
+  unsigned int nFailed = 0;
+
+  const auto singleResult = Acts::Test::microBenchmark(
+      [&](const auto& input) {
+        // the proxy is a lightweight handle into the trajectory storage
+        auto ts = input;
+        if (not updater(gctx, ts).ok()) {
+          ++nFailed;
+        }
+      },
+      trackStates, runs);
+  ACTS_INFO("Single state update: " << singleResult);
+
+  const auto batchResult = Acts::Test::microBenchmark(
+      [&] {
+        for (const auto& result : updater(gctx, trackStates)) {
+          if (not result.ok()) {
+            ++nFailed;
+          }
+        }
+      },
+      1, runs);
+  ACTS_INFO("Batched update of " << states << " states: " << batchResult);
+
+  if (0 < nFailed) {
+    ACTS_WARNING("Failed updates: " << nFailed);
+  }
+}
@@ -0,0 +1,508 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "Acts/Seeding/BinFinder.hpp"
+#include "Acts/Seeding/BinnedSPGroup.hpp"
+#include "Acts/Seeding/Seed.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/Seedfinder.hpp"
+#include "Acts/Seeding/SeedfinderFlat.hpp"
+#include "Acts/Seeding/SeedfinderOrthogonal.hpp"
+#include "Acts/Seeding/SpacePointGrid.hpp"
+#include "Acts/Tests/CommonHelpers/BenchmarkTools.hpp"
+
+#ifdef ACTS_SEEDFINDER_BENCHMARK_CUDA
+#include "Acts/Plugins/Cuda/Seeding/Seedfinder.hpp"
+#endif
+#ifdef ACTS_SEEDFINDER_BENCHMARK_SYCL
+#include "Acts/Plugins/Sycl/Seeding/DeviceExperimentCuts.hpp"
+#include "Acts/Plugins/Sycl/Seeding/Seedfinder.hpp"
+#include "Acts/Plugins/Sycl/Utilities/QueueWrapper.hpp"
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+namespace po = boost::program_options;
+
+namespace {
+
+struct SpacePoint {
+  float m_x;
+  float m_y;
+  float m_z;
+  float varianceR;
+  float varianceZ;
+  float x() const { return m_x; }
+  float y() const { return m_y; }
+  float z() const { return m_z; }
+};
+
+using SpacePointGroup = Acts::BinnedSPGroup<SpacePoint>;
+using CovarianceTool = std::function<std::pair<Acts::Vector3, Acts::Vector2>(
+    const SpacePoint&, float, float, float)>;
+
+// Generate the space points of charged tracks from the beam line crossing
+// the barrel pixel layers. Each event has a hard-scatter vertex and mu
+// pile-up vertices spread along the beam line.
+std::vector<SpacePoint> generateSpacePoints(size_t mu, float bFieldInZ) {
+  const std::vector<float> radii = {33., 50.5, 88.5, 122.5};
+  const size_t nHardScatterTracks = 100;
+  const size_t nPileUpTracks = 25;
+  std::minstd_rand rng(1234 + mu);
+  std::uniform_real_distribution<float> pT(400., 10000.);
+  std::uniform_real_distribution<float> phi(-M_PI, M_PI);
+  std::uniform_real_distribution<float> eta(-2.5, 2.5);
+  std::normal_distribution<float> z0(0., 50.);
+  std::normal_distribution<float> noise(0., 0.01);
+  std::bernoulli_distribution charge(0.5);
+
+  std::vector<SpacePoint> spacePoints;
+  for (size_t v = 0; v <= mu; ++v) {
+    float z = z0(rng);
+    size_t nTracks = (v == 0) ? nHardScatterTracks : nPileUpTracks;
+    for (size_t i = 0; i < nTracks; ++i) {
+      // helix radius in mm for pT in MeV and the field in kT
+      float helixRadius = pT(rng) / (300. * bFieldInZ);
+      float phi0 = phi(rng);
+      float cotTheta = std::sinh(eta(rng));
+      float q = charge(rng) ? 1. : -1.;
+      for (float r : radii) {
+        float alpha = std::asin(r / (2 * helixRadius));
+        float phiR = phi0 + q * alpha;
+        spacePoints.push_back({r * std::cos(phiR) + noise(rng),
+                               r * std::sin(phiR) + noise(rng),
+                               z + cotTheta * 2 * helixRadius * alpha,
+                               0.0003f, 0.05f});
+      }
+    }
+  }
+  return spacePoints;
+}
+
+bool isBinaryFile(const std::string& path) {
+  return path.size() > 4 and path.compare(path.size() - 4, 4, ".bin") == 0;
+}
+
+// Read space points written by the CsvSpacePointWriter, i.e. with the
+// columns measurement_id,sp_x,sp_y,sp_z,sp_covr,sp_covz in mm.
+std::vector<SpacePoint> readCsv(const std::string& path) {
+  std::ifstream file(path);
+  if (not file) {
+    throw std::invalid_argument("Could not open '" + path + "'");
+  }
+  std::vector<SpacePoint> spacePoints;
+  std::string line;
+  // skip the header
+  std::getline(file, line);
+  while (std::getline(file, line)) {
+    if (line.empty()) {
+      continue;
+    }
+    std::replace(line.begin(), line.end(), ',', ' ');
+    std::istringstream columns(line);
+    uint64_t measurementId = 0;
+    SpacePoint sp{};
+    if (not(columns >> measurementId >> sp.m_x >> sp.m_y >> sp.m_z >>
+            sp.varianceR >> sp.varianceZ)) {
+      throw std::invalid_argument("Malformed line in '" + path + "': " + line);
+    }
+    spacePoints.push_back(sp);
+  }
+  return spacePoints;
+}
+
+// The compact binary dump stores x,y,z,varianceR,varianceZ as consecutive
+// native float32 values per space point.
+std::vector<SpacePoint> readBinary(const std::string& path) {
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (not file) {
+    throw std::invalid_argument("Could not open '" + path + "'");
+  }
+  size_t size = file.tellg();
+  if (size % (5 * sizeof(float)) != 0) {
+    throw std::invalid_argument("Truncated space point dump '" + path + "'");
+  }
+  std::vector<float> values(size / sizeof(float));
+  file.seekg(0);
+  file.read(reinterpret_cast<char*>(values.data()), size);
+  std::vector<SpacePoint> spacePoints;
+  spacePoints.reserve(values.size() / 5);
+  for (size_t i = 0; i < values.size(); i += 5) {
+    spacePoints.push_back({values[i], values[i + 1], values[i + 2],
+                           values[i + 3], values[i + 4]});
+  }
+  return spacePoints;
+}
+
+void writeBinary(const std::string& path,
+                 const std::vector<SpacePoint>& spacePoints) {
+  std::ofstream file(path, std::ios::binary);
+  if (not file) {
+    throw std::invalid_argument("Could not open '" + path + "'");
+  }
+  for (const auto& sp : spacePoints) {
+    const float values[5] = {sp.m_x, sp.m_y, sp.m_z, sp.varianceR,
+                             sp.varianceZ};
+    file.write(reinterpret_cast<const char*>(values), sizeof(values));
+  }
+}
+
+/// Time spent in the phases of the seed finding for one event.
+struct PhaseTimes {
+  // search structure built by the backend itself, i.e. not the grid
+  std::chrono::duration<double> index{0};
+  std::chrono::duration<double> doublet{0};
+  std::chrono::duration<double> triplet{0};
+  std::chrono::duration<double> filter{0};
+};
+
+/// Input of the seed finding for one event.
+struct Event {
+  std::vector<const SpacePoint*> spacePoints;
+  CovarianceTool covTool;
+  const SpacePointGroup* spGroup = nullptr;
+};
+
+/// Common interface of the seed finding implementations under test.
+class SeedingBackend {
+ public:
+  virtual ~SeedingBackend() = default;
+  virtual std::string name() const = 0;
+  /// Find the seeds of the event and return their number. Backends that
+  /// can not split the seed finding into phases leave the times untouched.
+  virtual size_t createSeeds(const Event& event, PhaseTimes& times) = 0;
+};
+
+class CpuBackend final : public SeedingBackend {
+ public:
+  CpuBackend(const Acts::SeedfinderConfig<SpacePoint>& config)
+      : m_seedfinder(config) {
+    m_state.measureTime = true;
+  }
+
+  std::string name() const final { return "cpu"; }
+
+  size_t createSeeds(const Event& event, PhaseTimes& times) final {
+    // scratch memory and output are reused between runs, as in an event loop
+    m_seeds.clear();
+    m_state.doubletTime = m_state.tripletTime = m_state.filterTime = {};
+    const SpacePointGroup& spGroup = *event.spGroup;
+    for (auto group = spGroup.begin(); group != spGroup.end(); ++group) {
+      m_seedfinder.createSeedsForGroup(m_state, m_seeds, group.bottom(),
+                                       group.middle(), group.top());
+    }
+    times.doublet = m_state.doubletTime;
+    times.triplet = m_state.tripletTime;
+    times.filter = m_state.filterTime;
+    return m_seeds.size();
+  }
+
+ private:
+  Acts::Seedfinder<SpacePoint> m_seedfinder;
+  Acts::Seedfinder<SpacePoint>::State m_state;
+  std::vector<Acts::Seed<SpacePoint>> m_seeds;
+};
+
+class OrthogonalBackend final : public SeedingBackend {
+ public:
+  OrthogonalBackend(const Acts::SeedfinderConfig<SpacePoint>& config)
+      : m_seedfinder(config) {
+    m_state.finderState.measureTime = true;
+  }
+
+  std::string name() const final { return "orthogonal"; }
+
+  size_t createSeeds(const Event& event, PhaseTimes& times) final {
+    auto& finderState = m_state.finderState;
+    m_seeds.clear();
+    m_state.treeTime = {};
+    finderState.doubletTime = finderState.tripletTime =
+        finderState.filterTime = {};
+    m_seedfinder.createSeeds(m_state, event.spacePoints.begin(),
+                             event.spacePoints.end(), event.covTool, m_seeds);
+    times.index = m_state.treeTime;
+    times.doublet = finderState.doubletTime;
+    times.triplet = finderState.tripletTime;
+    times.filter = finderState.filterTime;
+    return m_seeds.size();
+  }
+
+ private:
+  Acts::SeedfinderOrthogonal<SpacePoint> m_seedfinder;
+  Acts::SeedfinderOrthogonal<SpacePoint>::State m_state;
+  std::vector<Acts::Seed<SpacePoint>> m_seeds;
+};
+
+class FlatBackend final : public SeedingBackend {
+ public:
+  FlatBackend(const Acts::SeedfinderConfig<SpacePoint>& config)
+      : m_seedfinder(config, Acts::SeedFilterConfig(),
+                     Acts::FlatSeeding::TripletFilterConfig()) {}
+
+  std::string name() const final { return "flat"; }
+
+  size_t createSeeds(const Event& event, PhaseTimes& /*times*/) final {
+    m_seeds.clear();
+    const SpacePointGroup& spGroup = *event.spGroup;
+    for (auto group = spGroup.begin(); group != spGroup.end(); ++group) {
+      m_seedfinder.createSeedsForGroup(m_state, m_seeds, group.bottom(),
+                                       group.middle(), group.top());
+    }
+    return m_seeds.size();
+  }
+
+ private:
+  Acts::SeedfinderFlat<SpacePoint> m_seedfinder;
+  Acts::SeedfinderFlat<SpacePoint>::State m_state;
+  std::vector<Acts::Seed<SpacePoint>> m_seeds;
+};
+
+#ifdef ACTS_SEEDFINDER_BENCHMARK_CUDA
+class CudaBackend final : public SeedingBackend {
+ public:
+  CudaBackend(const Acts::SeedfinderConfig<SpacePoint>& config)
+      : m_seedfinder(config) {}
+
+  std::string name() const final { return "cuda"; }
+
+  size_t createSeeds(const Event& event, PhaseTimes& /*times*/) final {
+    size_t nSeeds = 0;
+    const SpacePointGroup& spGroup = *event.spGroup;
+    for (auto group = spGroup.begin(); group != spGroup.end(); ++group) {
+      nSeeds += m_seedfinder
+                    .createSeedsForGroup(group.bottom(), group.middle(),
+                                         group.top())
+                    .size();
+    }
+    return nSeeds;
+  }
+
+ private:
+  Acts::Seedfinder<SpacePoint, Acts::Cuda> m_seedfinder;
+};
+#endif
+
+#ifdef ACTS_SEEDFINDER_BENCHMARK_SYCL
+class SyclBackend final : public SeedingBackend {
+ public:
+  SyclBackend(const Acts::SeedfinderConfig<SpacePoint>& config)
+      : m_seedfinder(config, Acts::Sycl::DeviceExperimentCuts(),
+                     Acts::Sycl::QueueWrapper()) {}
+
+  std::string name() const final { return "sycl"; }
+
+  size_t createSeeds(const Event& event, PhaseTimes& /*times*/) final {
+    size_t nSeeds = 0;
+    const SpacePointGroup& spGroup = *event.spGroup;
+    for (auto group = spGroup.begin(); group != spGroup.end(); ++group) {
+      nSeeds += m_seedfinder
+                    .createSeedsForGroup(group.bottom(), group.middle(),
+                                         group.top())
+                    .size();
+    }
+    return nSeeds;
+  }
+
+ private:
+  Acts::Sycl::Seedfinder<SpacePoint> m_seedfinder;
+};
+#endif
+
+std::unique_ptr<SeedingBackend> makeBackend(
+    const std::string& name, const Acts::SeedfinderConfig<SpacePoint>& config) {
+  if (name == "cpu") {
+    return std::make_unique<CpuBackend>(config);
+  }
+  if (name == "orthogonal") {
+    return std::make_unique<OrthogonalBackend>(config);
+  }
+  if (name == "flat") {
+    return std::make_unique<FlatBackend>(config);
+  }
+#ifdef ACTS_SEEDFINDER_BENCHMARK_CUDA
+  if (name == "cuda") {
+    return std::make_unique<CudaBackend>(config);
+  }
+#endif
+#ifdef ACTS_SEEDFINDER_BENCHMARK_SYCL
+  if (name == "sycl") {
+    return std::make_unique<SyclBackend>(config);
+  }
+#endif
+  throw std::invalid_argument("Unknown or unavailable backend '" + name + "'");
+}
+
+double toMs(std::chrono::duration<double> duration) {
+  return 1000 * duration.count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  std::vector<std::string> inputs;
+  std::string binaryOutput;
+  std::vector<size_t> mus;
+  std::vector<std::string> backendNames;
+  size_t runs = 5;
+
+  try {
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+      ("help", "produce help message")
+      ("input",po::value<std::vector<std::string>>(&inputs)->multitoken(),"space point files to replay, csv as written by the CsvSpacePointWriter or a .bin dump; replaces the generated events")
+      ("write-binary",po::value<std::string>(&binaryOutput),"write the first event as a compact .bin dump")
+      ("mu",po::value<std::vector<size_t>>(&mus)->multitoken()->default_value({0, 60, 200}, "0 60 200"),"pile-up of the generated events")
+      ("backend",po::value<std::vector<std::string>>(&backendNames)->multitoken()->default_value({"cpu", "orthogonal", "flat"}, "cpu orthogonal flat"),"seeding backends: cpu, orthogonal, flat, cuda, sycl")
+      ("runs",po::value<size_t>(&runs)->default_value(5),"number of timed runs per event");
+    // clang-format on
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0u) {
+      std::cout << desc << std::endl;
+      return 0;
+    }
+    if (runs < 2) {
+      throw std::invalid_argument("At least two runs are needed");
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  Acts::SeedfinderConfig<SpacePoint> config;
+  config.rMax = 160.;
+  config.deltaRMin = 5.;
+  config.deltaRMax = 160.;
+  config.collisionRegionMin = -250.;
+  config.collisionRegionMax = 250.;
+  config.zMin = -2800.;
+  config.zMax = 2800.;
+  config.maxSeedsPerSpM = 5;
+  config.cotThetaMax = 7.40627;
+  config.sigmaScattering = 1.;
+  config.minPt = 500.;
+  config.bFieldInZ = 0.00199724;
+  config.beamPos = {0., 0.};
+  config.impactMax = 10.;
+  config.seedFilter = std::make_shared<Acts::SeedFilter<SpacePoint>>(
+      Acts::SeedFilterConfig());
+
+  Acts::SpacePointGridConfig gridConf;
+  gridConf.bFieldInZ = config.bFieldInZ;
+  gridConf.minPt = config.minPt;
+  gridConf.rMax = config.rMax;
+  gridConf.zMax = config.zMax;
+  gridConf.zMin = config.zMin;
+  gridConf.deltaRMax = config.deltaRMax;
+  gridConf.cotThetaMax = config.cotThetaMax;
+
+  // either replay the given files or generate one event per pile-up value
+  std::vector<std::pair<std::string, std::vector<SpacePoint>>> events;
+  try {
+    if (not inputs.empty()) {
+      for (const auto& input : inputs) {
+        events.emplace_back(input, isBinaryFile(input) ? readBinary(input)
+                                                       : readCsv(input));
+      }
+    } else {
+      for (size_t mu : mus) {
+        events.emplace_back("mu=" + std::to_string(mu),
+                            generateSpacePoints(mu, config.bFieldInZ));
+      }
+    }
+    if (not binaryOutput.empty() and not events.empty()) {
+      writeBinary(binaryOutput, events.front().second);
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  std::vector<std::unique_ptr<SeedingBackend>> backends;
+  try {
+    for (const auto& name : backendNames) {
+      backends.push_back(makeBackend(name, config));
+    }
+  } catch (std::exception& e) {
+    std::cerr << "error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  auto binFinder = std::make_shared<Acts::BinFinder<SpacePoint>>();
+  CovarianceTool ct = [](const SpacePoint& sp, float, float,
+                         float) -> std::pair<Acts::Vector3, Acts::Vector2> {
+    return {Acts::Vector3(sp.x(), sp.y(), sp.z()),
+            Acts::Vector2(sp.varianceR, sp.varianceZ)};
+  };
+
+  for (const auto& [label, spacePoints] : events) {
+    std::vector<const SpacePoint*> spPointers;
+    for (const auto& sp : spacePoints) {
+      spPointers.push_back(&sp);
+    }
+    std::cout << label << ": " << spacePoints.size() << " space points"
+              << std::endl;
+
+    // the grid is built once per event, time it separately
+    std::unique_ptr<SpacePointGroup> spGroup;
+    const auto gridResult = Acts::Test::microBenchmark(
+        [&] {
+          spGroup = std::make_unique<SpacePointGroup>(
+              spPointers.begin(), spPointers.end(), ct, binFinder, binFinder,
+              Acts::SpacePointGridCreator::createGrid<SpacePoint>(gridConf),
+              config);
+          return spGroup->numGroups();
+        },
+        1, runs);
+    std::cout << "  grid build: " << gridResult << std::endl;
+
+    Event event{spPointers, ct, spGroup.get()};
+    for (auto& backend : backends) {
+      PhaseTimes times;
+      size_t nSeeds = 0;
+      const auto result = Acts::Test::microBenchmark(
+          [&] {
+            nSeeds = backend->createSeeds(event, times);
+            return nSeeds;
+          },
+          1, runs);
+      std::chrono::duration<double> median = result.runTimeMedian();
+      std::cout << "  " << backend->name() << ": " << nSeeds
+                << " seeds: " << result << std::endl;
+      if (times.index.count() > 0) {
+        std::cout << "    index build " << toMs(times.index) << "ms"
+                  << std::endl;
+      }
+      if (times.doublet.count() > 0) {
+        // phase times of the last run
+        std::cout << "    doublet " << toMs(times.doublet) << "ms, triplet "
+                  << toMs(times.triplet) << "ms, filter "
+                  << toMs(times.filter) << "ms" << std::endl;
+      }
+      std::cout << "    seeds per second: " << nSeeds / median.count()
+                << std::endl;
+    }
+  }
+}
@@ -0,0 +1,171 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Seeding/BinFinder.hpp"
+#include "Acts/Seeding/BinnedSPGroup.hpp"
+#include "Acts/Seeding/SeedfinderConfig.hpp"
+#include "Acts/Seeding/SpacePointGrid.hpp"
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "SpacePoint.hpp"
+
+namespace {
+
+using namespace Acts;
+
+std::vector<SpacePoint> makeSpacePoints(size_t n) {
+  std::default_random_engine rng(42);
+  std::uniform_real_distribution<float> radius(25., 200.);
+  std::uniform_real_distribution<float> phi(-M_PI, M_PI);
+  std::uniform_real_distribution<float> z(-500., 500.);
+  std::vector<SpacePoint> spacePoints;
+  for (size_t i = 0; i < n; ++i) {
+    float r = radius(rng);
+    float p = phi(rng);
+    spacePoints.push_back(
+        {r * std::cos(p), r * std::sin(p), z(rng), r, 0, 0.01, 0.01});
+  }
+  return spacePoints;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(SeedingBinnedSPGroup)
+
+BOOST_AUTO_TEST_CASE(BinsSortedInRadius) {
+  auto spacePoints = makeSpacePoints(2000u);
+  std::vector<const SpacePoint*> spPointers;
+  for (const auto& sp : spacePoints) {
+    spPointers.push_back(&sp);
+  }
+
+  SeedfinderConfig<SpacePoint> config;
+  config.rMax = 160.;
+  config.zMin = -400.;
+  config.zMax = 400.;
+  config.beamPos = {0., 0.};
+
+  SpacePointGridConfig gridConf;
+  gridConf.bFieldInZ = 0.00199724;
+  gridConf.minPt = 500.;
+  gridConf.rMax = config.rMax;
+  gridConf.zMax = config.zMax;
+  gridConf.zMin = config.zMin;
+  gridConf.deltaRMax = 160.;
+  gridConf.cotThetaMax = config.cotThetaMax;
+
+  auto binFinder = std::make_shared<BinFinder<SpacePoint>>();
+  auto ct = [](const SpacePoint& sp, float, float,
+               float) -> std::pair<Vector3, Vector2> {
+    return {Vector3(sp.x(), sp.y(), sp.z()),
+            Vector2(sp.varianceR, sp.varianceZ)};
+  };
+  BinnedSPGroup<SpacePoint> spGroup(
+      spPointers.begin(), spPointers.end(), ct, binFinder, binFinder,
+      SpacePointGridCreator::createGrid<SpacePoint>(gridConf), config);
+
+  size_t nExpected = 0;
+  for (const auto& sp : spacePoints) {
+    nExpected += (sp.r() < config.rMax and config.zMin <= sp.z() and
+                  sp.z() <= config.zMax);
+  }
+
+  size_t nFound = 0;
+  for (auto groupIt = spGroup.begin(); groupIt != spGroup.end(); ++groupIt) {
+    float rPrevious = 0.;
+    for (auto sp : groupIt.middle()) {
+      BOOST_CHECK_LE(rPrevious, sp->radius());
+      rPrevious = sp->radius();
+      ++nFound;
+    }
+  }
+  BOOST_CHECK_EQUAL(nFound, nExpected);
+}
+
+BOOST_AUTO_TEST_CASE(GroupsMatchBinFinder) {
+  auto spacePoints = makeSpacePoints(500u);
+  std::vector<const SpacePoint*> spPointers;
+  for (const auto& sp : spacePoints) {
+    spPointers.push_back(&sp);
+  }
+
+  SeedfinderConfig<SpacePoint> config;
+  config.rMax = 160.;
+  config.zMin = -400.;
+  config.zMax = 400.;
+  config.beamPos = {0., 0.};
+
+  SpacePointGridConfig gridConf;
+  gridConf.bFieldInZ = 0.00199724;
+  gridConf.minPt = 500.;
+  gridConf.rMax = config.rMax;
+  gridConf.zMax = config.zMax;
+  gridConf.zMin = config.zMin;
+  gridConf.deltaRMax = 160.;
+  gridConf.cotThetaMax = config.cotThetaMax;
+
+  auto binFinder = std::make_shared<BinFinder<SpacePoint>>();
+  auto ct = [](const SpacePoint& sp, float, float,
+               float) -> std::pair<Vector3, Vector2> {
+    return {Vector3(sp.x(), sp.y(), sp.z()),
+            Vector2(sp.varianceR, sp.varianceZ)};
+  };
+  auto grid = SpacePointGridCreator::createGrid<SpacePoint>(gridConf);
+  auto phiZbins = grid->numLocalBins();
+  // an identical grid to query the bin finder independently
+  auto refGrid = SpacePointGridCreator::createGrid<SpacePoint>(gridConf);
+  BinnedSPGroup<SpacePoint> spGroup(spPointers.begin(), spPointers.end(), ct,
+                                    binFinder, binFinder, std::move(grid),
+                                    config);
+  BOOST_CHECK_EQUAL(spGroup.numGroups(), phiZbins[0] * phiZbins[1]);
+
+  auto collect = [](auto&& neighborhood) {
+    std::vector<const InternalSpacePoint<SpacePoint>*> sps;
+    for (auto sp : neighborhood) {
+      sps.push_back(sp);
+    }
+    return sps;
+  };
+
+  // groups are ordered in phi first and in z second
+  size_t index = 0;
+  for (auto groupIt = spGroup.begin(); groupIt != spGroup.end(); ++groupIt) {
+    size_t phiIndex = 1 + index / phiZbins[1];
+    size_t zIndex = 1 + index % phiZbins[1];
+    auto group = spGroup.group(index);
+    BOOST_CHECK(collect(groupIt.middle()) == collect(group.middle()));
+    BOOST_CHECK(collect(groupIt.bottom()) == collect(group.bottom()));
+    BOOST_CHECK(collect(groupIt.top()) == collect(group.top()));
+
+    // the bottom neighborhood visits the bins returned by the bin finder
+    size_t nExpected = 0;
+    for (size_t bin : binFinder->findBins(phiIndex, zIndex, refGrid.get())) {
+      for (const auto& sp : spacePoints) {
+        if (sp.r() >= config.rMax or sp.z() < config.zMin or
+            sp.z() > config.zMax) {
+          continue;
+        }
+        float phi = std::atan2(sp.y(), sp.x());
+        nExpected += (refGrid->globalBinFromPosition(Vector2(phi, sp.z())) ==
+                      bin);
+      }
+    }
+    BOOST_CHECK_EQUAL(collect(group.bottom()).size(), nExpected);
+    ++index;
+  }
+  BOOST_CHECK_EQUAL(index, spGroup.numGroups());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
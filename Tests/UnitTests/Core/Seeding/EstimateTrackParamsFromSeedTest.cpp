@@ -96,6 +96,10 @@ BOOST_AUTO_TEST_CASE(trackparameters_estimation_test) {
   std::array<double, 3> thetaArray = {80._degree, 90.0_degree, 100._degree};
   std::array<double, 2> qArray = {1, -1};
 
+  // All seeds are also estimated together at the end
+  SeedBatch batch;
+  std::vector<BoundVector> singleParams;
+
   for (const auto& p : pArray) {
     for (const auto& phi : phiArray) {
       for (const auto& theta : thetaArray) {
@@ -199,8 +203,37 @@ BOOST_AUTO_TEST_CASE(trackparameters_estimation_test) {
           CHECK_CLOSE_ABS(estFullParams[eBoundQOverP], expParams[eBoundQOverP],
                           1e-2);
           CHECK_CLOSE_ABS(estFullParams[eBoundTime], expParams[eBoundTime], 1.);
+
+          batch.push_back(spacePointPtrs.begin(), *bottomSurface,
+                          Vector3(0, 0, 2._T));
+          singleParams.push_back(estFullParams);
         }
       }
     }
   }
+
+  // A seed in a too small magnetic field is rejected
+  std::array<SpacePoint, 3> lowFieldSPs = {SpacePoint{30, 1, 0, 30, 0, 0, 0},
+                                           SpacePoint{60, 3, 1, 60, 1, 0, 0},
+                                           SpacePoint{90, 6, 2, 90, 2, 0, 0}};
+  std::array<const SpacePoint*, 3> lowFieldPtrs = {
+      &lowFieldSPs[0], &lowFieldSPs[1], &lowFieldSPs[2]};
+  batch.push_back(lowFieldPtrs.begin(), *batch.surfaces.front(),
+                  Vector3(0, 0, 0.01_T));
+
+  std::vector<BoundVector> batchParams;
+  std::vector<bool> valid;
+  size_t nValid =
+      estimateTrackParamsFromSeeds(geoCtx, batch, 0.1_T, batchParams, valid);
+  BOOST_REQUIRE_GT(singleParams.size(), 0u);
+  BOOST_CHECK_EQUAL(nValid, singleParams.size());
+  BOOST_REQUIRE_EQUAL(valid.size(), singleParams.size() + 1);
+  BOOST_CHECK(not valid.back());
+  for (size_t i = 0; i < singleParams.size(); ++i) {
+    BOOST_CHECK(valid[i]);
+    for (size_t j = 0; j < eBoundSize; ++j) {
+      CHECK_CLOSE_OR_SMALL(batchParams[i][j], singleParams[i][j], 1e-9,
+                           1e-9);
+    }
+  }
 }
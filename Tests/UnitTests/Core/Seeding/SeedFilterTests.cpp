@@ -0,0 +1,182 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Seeding/InternalSpacePoint.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/SeedFilterConfig.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "SpacePoint.hpp"
+
+namespace {
+
+using namespace Acts;
+
+std::vector<SpacePoint> makeSpacePoints(size_t n, float rMin, float rMax) {
+  std::default_random_engine rng(42);
+  std::uniform_real_distribution<float> radius(rMin, rMax);
+  std::uniform_real_distribution<float> phi(-0.1, 0.1);
+  std::uniform_real_distribution<float> z(-50., 50.);
+  std::vector<SpacePoint> spacePoints;
+  for (size_t i = 0; i < n; ++i) {
+    float r = radius(rng);
+    float p = phi(rng);
+    spacePoints.push_back(
+        {r * std::cos(p), r * std::sin(p), z(rng), r, 0, 0.01, 0.01});
+  }
+  return spacePoints;
+}
+
+std::vector<InternalSpacePoint<SpacePoint>> makeInternal(
+    const std::vector<SpacePoint>& spacePoints) {
+  std::vector<InternalSpacePoint<SpacePoint>> internal;
+  for (const auto& sp : spacePoints) {
+    internal.emplace_back(sp, Vector3(sp.x(), sp.y(), sp.z()), Vector2(0, 0),
+                          Vector2(sp.varianceR, sp.varianceZ));
+  }
+  return internal;
+}
+
+// straightforward compatible seed counting over all top space point pairs
+std::vector<float> referenceWeights(
+    const SeedFilterConfig& cfg,
+    const std::vector<const InternalSpacePoint<SpacePoint>*>& topSpVec,
+    const std::vector<float>& invHelixDiameterVec,
+    const std::vector<float>& impactParametersVec) {
+  std::vector<float> weights;
+  for (size_t i = 0; i < topSpVec.size(); i++) {
+    std::vector<float> compatibleSeedR;
+    float weight = -(impactParametersVec[i] * cfg.impactWeightFactor);
+    for (size_t j = 0; j < topSpVec.size(); j++) {
+      float otherTop_r = topSpVec[j]->radius();
+      if (i == j or std::abs(topSpVec[i]->radius() - otherTop_r) <
+                        cfg.deltaRMin) {
+        continue;
+      }
+      float lowerLimitCurv =
+          invHelixDiameterVec[i] - cfg.deltaInvHelixDiameter;
+      float upperLimitCurv =
+          invHelixDiameterVec[i] + cfg.deltaInvHelixDiameter;
+      if (invHelixDiameterVec[j] < lowerLimitCurv or
+          invHelixDiameterVec[j] > upperLimitCurv) {
+        continue;
+      }
+      bool newCompSeed = std::none_of(
+          compatibleSeedR.begin(), compatibleSeedR.end(),
+          [&](float r) { return std::abs(r - otherTop_r) < cfg.deltaRMin; });
+      if (newCompSeed) {
+        compatibleSeedR.push_back(otherTop_r);
+        weight += cfg.compatSeedWeight;
+      }
+      if (compatibleSeedR.size() >= cfg.compatSeedLimit) {
+        break;
+      }
+    }
+    weights.push_back(weight);
+  }
+  return weights;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(SeedingSeedFilter)
+
+BOOST_AUTO_TEST_CASE(CompatibleSeedWeights) {
+  auto bottomMiddle = makeSpacePoints(2u, 30., 60.);
+  auto tops = makeSpacePoints(200u, 70., 200.);
+  auto internalBottomMiddle = makeInternal(bottomMiddle);
+  auto internalTops = makeInternal(tops);
+
+  SeedFilterConfig cfg;
+  cfg.deltaInvHelixDiameter = 0.001;
+  cfg.compatSeedLimit = 3;
+  SeedFilter<SpacePoint> filter(cfg);
+
+  // curvatures clustered around a few values to get many compatible seeds
+  std::default_random_engine rng(1234);
+  std::uniform_int_distribution<int> cluster(0, 4);
+  std::normal_distribution<float> spread(0., 0.001);
+  std::uniform_real_distribution<float> impact(0., 2.);
+  std::vector<const InternalSpacePoint<SpacePoint>*> topSpVec;
+  std::vector<float> invHelixDiameterVec;
+  std::vector<float> impactParametersVec;
+  for (const auto& top : internalTops) {
+    topSpVec.push_back(&top);
+    invHelixDiameterVec.push_back(0.002 * cluster(rng) + spread(rng));
+    impactParametersVec.push_back(impact(rng));
+  }
+  // exactly equal curvatures must be handled as well
+  invHelixDiameterVec[7] = invHelixDiameterVec[3];
+
+  std::vector<std::pair<float, InternalSeed<SpacePoint>>> seeds;
+  filter.filterSeeds_2SpFixed(internalBottomMiddle[0], internalBottomMiddle[1],
+                              topSpVec, invHelixDiameterVec,
+                              impactParametersVec, 0., seeds);
+
+  auto expected = referenceWeights(cfg, topSpVec, invHelixDiameterVec,
+                                   impactParametersVec);
+  BOOST_REQUIRE_EQUAL(seeds.size(), topSpVec.size());
+  for (size_t i = 0; i < seeds.size(); ++i) {
+    BOOST_CHECK_EQUAL(seeds[i].second.sp[2], topSpVec[i]);
+    BOOST_CHECK_EQUAL(seeds[i].first, expected[i]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(KeepHeaviestSeeds) {
+  auto spacePoints = makeSpacePoints(300u, 30., 200.);
+  auto internal = makeInternal(spacePoints);
+
+  SeedFilterConfig cfg;
+  cfg.maxSeedsPerSpM = 4;
+  SeedFilter<SpacePoint> filter(cfg);
+
+  std::default_random_engine rng(4321);
+  std::uniform_int_distribution<int> weight(0, 20);
+  std::vector<std::pair<float, InternalSeed<SpacePoint>>> seedsPerSpM;
+  for (size_t i = 0; i + 2 < internal.size(); i += 3) {
+    // few distinct weights to exercise the tie-break
+    seedsPerSpM.emplace_back(
+        weight(rng), InternalSeed<SpacePoint>(internal[i], internal[i + 1],
+                                              internal[i + 2], 0.));
+  }
+  auto sumYZ = [](const InternalSeed<SpacePoint>& seed) {
+    float sum = 0;
+    for (int i = 0; i < 3; i++) {
+      sum += pow(seed.sp[i]->sp().y(), 2) + pow(seed.sp[i]->sp().z(), 2);
+    }
+    return sum;
+  };
+  auto reference = seedsPerSpM;
+  std::sort(reference.begin(), reference.end(),
+            [&](const auto& lhs, const auto& rhs) {
+              if (lhs.first != rhs.first) {
+                return lhs.first > rhs.first;
+              }
+              return sumYZ(lhs.second) > sumYZ(rhs.second);
+            });
+
+  std::vector<Seed<SpacePoint>> outVec;
+  filter.filterSeeds_1SpFixed(seedsPerSpM, outVec);
+
+  // the limit is exceeded by one, as in the default filter
+  BOOST_REQUIRE_EQUAL(outVec.size(), cfg.maxSeedsPerSpM + 1);
+  for (size_t i = 0; i < outVec.size(); ++i) {
+    for (size_t k = 0; k < 3; ++k) {
+      BOOST_CHECK_EQUAL(outVec[i].sp()[k], &reference[i].second.sp[k]->sp());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,190 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Seeding/IExperimentCuts.hpp"
+#include "Acts/Seeding/InternalSpacePoint.hpp"
+#include "Acts/Seeding/Seed.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/Seedfinder.hpp"
+#include "Acts/Seeding/SeedfinderFlat.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "SpacePoint.hpp"
+
+namespace {
+
+using namespace Acts;
+
+// space points of helices from the beam line on four barrel layers
+std::vector<SpacePoint> makeTracks(size_t nTracks, float bFieldInZ) {
+  const std::vector<float> radii = {33., 50.5, 88.5, 122.5};
+  std::default_random_engine rng(42);
+  std::uniform_real_distribution<float> pT(400., 5000.);
+  std::uniform_real_distribution<float> phi(-M_PI, M_PI);
+  std::uniform_real_distribution<float> eta(-2., 2.);
+  std::normal_distribution<float> z0(0., 50.);
+  std::normal_distribution<float> noise(0., 0.02);
+  std::bernoulli_distribution charge(0.5);
+  std::vector<SpacePoint> spacePoints;
+  for (size_t i = 0; i < nTracks; ++i) {
+    float helixRadius = pT(rng) / (300. * bFieldInZ);
+    float phi0 = phi(rng);
+    float cotTheta = std::sinh(eta(rng));
+    float z = z0(rng);
+    float q = charge(rng) ? 1. : -1.;
+    for (size_t l = 0; l < radii.size(); ++l) {
+      float r = radii[l];
+      float alpha = std::asin(r / (2 * helixRadius));
+      float phiR = phi0 + q * alpha;
+      float x = r * std::cos(phiR) + noise(rng);
+      float y = r * std::sin(phiR) + noise(rng);
+      spacePoints.push_back({x, y, z + cotTheta * 2 * helixRadius * alpha,
+                             std::hypot(x, y), int(l), 0.0003, 0.05});
+    }
+  }
+  return spacePoints;
+}
+
+// the same weight and cut, once for the flat and once for the internal
+// space points
+float flatSeedWeight(const FlatSeeding::SpacePoint& bottom,
+                     const FlatSeeding::SpacePoint&,
+                     const FlatSeeding::SpacePoint& top) {
+  return (bottom.radius < 40.f ? 50.f : 0.f) +
+         (top.radius > 100.f ? 20.f : 0.f);
+}
+
+bool flatSingleSeedCut(float weight, const FlatSeeding::SpacePoint& bottom,
+                       const FlatSeeding::SpacePoint&,
+                       const FlatSeeding::SpacePoint&) {
+  return bottom.radius < 40.f or weight > 0.f;
+}
+
+class HostCuts : public IExperimentCuts<SpacePoint> {
+ public:
+  float seedWeight(const InternalSpacePoint<SpacePoint>& bottom,
+                   const InternalSpacePoint<SpacePoint>&,
+                   const InternalSpacePoint<SpacePoint>& top) const final {
+    return (bottom.radius() < 40.f ? 50.f : 0.f) +
+           (top.radius() > 100.f ? 20.f : 0.f);
+  }
+  bool singleSeedCut(float weight, const InternalSpacePoint<SpacePoint>& bottom,
+                     const InternalSpacePoint<SpacePoint>&,
+                     const InternalSpacePoint<SpacePoint>&) const final {
+    return bottom.radius() < 40.f or weight > 0.f;
+  }
+  std::vector<std::pair<float, InternalSeed<SpacePoint>>> cutPerMiddleSP(
+      std::vector<std::pair<float, InternalSeed<SpacePoint>>> seeds)
+      const final {
+    return seeds;
+  }
+};
+
+struct SeedSps {
+  std::array<const SpacePoint*, 3> sps;
+  double z;
+  bool operator<(const SeedSps& other) const { return sps < other.sps; }
+  bool operator==(const SeedSps& other) const {
+    return sps == other.sps and z == other.z;
+  }
+};
+
+std::vector<SeedSps> sortedSeeds(const std::vector<Seed<SpacePoint>>& seeds) {
+  std::vector<SeedSps> result;
+  for (const auto& seed : seeds) {
+    result.push_back({{seed.sp()[0], seed.sp()[1], seed.sp()[2]}, seed.z()});
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+SeedfinderConfig<SpacePoint> makeConfig() {
+  SeedfinderConfig<SpacePoint> config;
+  config.rMax = 160.;
+  config.deltaRMin = 5.;
+  config.deltaRMax = 160.;
+  config.collisionRegionMin = -250.;
+  config.collisionRegionMax = 250.;
+  config.zMin = -2800.;
+  config.zMax = 2800.;
+  config.maxSeedsPerSpM = 5;
+  config.cotThetaMax = 7.40627;
+  config.sigmaScattering = 1.;
+  config.minPt = 500.;
+  config.bFieldInZ = 0.00199724;
+  config.beamPos = {0., 0.};
+  config.impactMax = 10.;
+  // the flat seed finder always uses the pT estimated from the curvature
+  config.maxPtScattering = std::numeric_limits<float>::max();
+  return config;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(SeedingSeedfinderFlat)
+
+BOOST_AUTO_TEST_CASE(MatchesSeedfinder) {
+  auto spacePoints = makeTracks(300u, 0.00199724);
+  std::vector<InternalSpacePoint<SpacePoint>> internal;
+  for (const auto& sp : spacePoints) {
+    internal.emplace_back(sp, Vector3(sp.x(), sp.y(), sp.z()), Vector2(0., 0.),
+                          Vector2(sp.varianceR, sp.varianceZ));
+  }
+  // both seed finders visit the top candidates in the same order if they are
+  // sorted in r
+  std::vector<const InternalSpacePoint<SpacePoint>*> group;
+  for (const auto& sp : internal) {
+    group.push_back(&sp);
+  }
+  std::stable_sort(group.begin(), group.end(), [](auto lhs, auto rhs) {
+    return lhs->radius() < rhs->radius();
+  });
+
+  HostCuts hostCuts;
+  FlatSeeding::TripletFilterConfig flatCuts;
+  flatCuts.seedWeight = flatSeedWeight;
+  flatCuts.singleSeedCut = flatSingleSeedCut;
+
+  for (bool withCuts : {false, true}) {
+    BOOST_TEST_CONTEXT("with cuts " << withCuts) {
+      SeedFilterConfig filterConfig;
+      auto config = makeConfig();
+      config.seedFilter = std::make_shared<SeedFilter<SpacePoint>>(
+          filterConfig, withCuts ? &hostCuts : nullptr);
+
+      Seedfinder<SpacePoint> seedfinder(config);
+      auto expected =
+          sortedSeeds(seedfinder.createSeedsForGroup(group, group, group));
+
+      SeedfinderFlat<SpacePoint> flat(
+          config, filterConfig,
+          withCuts ? flatCuts : FlatSeeding::TripletFilterConfig());
+      SeedfinderFlat<SpacePoint>::State state;
+      std::vector<Seed<SpacePoint>> seeds;
+      flat.createSeedsForGroup(state, seeds, group, group, group);
+
+      BOOST_CHECK_GT(expected.size(), 0u);
+      BOOST_CHECK_EQUAL(seeds.size(), expected.size());
+      BOOST_CHECK(sortedSeeds(seeds) == expected);
+      BOOST_CHECK_GT(state.dubletCounts.nDublets, 0u);
+      BOOST_CHECK_GE(state.dubletCounts.nTriplets,
+                     state.dubletCounts.maxTriplets);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
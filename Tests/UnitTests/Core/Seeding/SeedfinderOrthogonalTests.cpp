@@ -0,0 +1,153 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Seeding/InternalSpacePoint.hpp"
+#include "Acts/Seeding/Seed.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/Seedfinder.hpp"
+#include "Acts/Seeding/SeedfinderOrthogonal.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "SpacePoint.hpp"
+
+namespace {
+
+using namespace Acts;
+
+// space points of helices from the beam line on four barrel layers,
+// including tracks crossing phi = +-pi
+std::vector<SpacePoint> makeTracks(size_t nTracks, float bFieldInZ) {
+  const std::vector<float> radii = {33., 50.5, 88.5, 122.5};
+  std::default_random_engine rng(42);
+  std::uniform_real_distribution<float> pT(400., 5000.);
+  std::uniform_real_distribution<float> phi(-M_PI, M_PI);
+  std::uniform_real_distribution<float> eta(-2., 2.);
+  std::normal_distribution<float> z0(0., 50.);
+  std::normal_distribution<float> noise(0., 0.02);
+  std::bernoulli_distribution charge(0.5);
+  std::vector<SpacePoint> spacePoints;
+  for (size_t i = 0; i < nTracks; ++i) {
+    float helixRadius = pT(rng) / (300. * bFieldInZ);
+    float phi0 = (i % 10 == 0) ? M_PI - 0.01 : phi(rng);
+    float cotTheta = std::sinh(eta(rng));
+    float z = z0(rng);
+    float q = charge(rng) ? 1. : -1.;
+    for (size_t l = 0; l < radii.size(); ++l) {
+      float r = radii[l];
+      float alpha = std::asin(r / (2 * helixRadius));
+      float phiR = phi0 + q * alpha;
+      float x = r * std::cos(phiR) + noise(rng);
+      float y = r * std::sin(phiR) + noise(rng);
+      spacePoints.push_back({x, y, z + cotTheta * 2 * helixRadius * alpha,
+                             std::hypot(x, y), int(l), 0.0003, 0.05});
+    }
+  }
+  return spacePoints;
+}
+
+using SeedSps = std::array<const SpacePoint*, 3>;
+
+std::vector<SeedSps> sortedSeeds(const std::vector<Seed<SpacePoint>>& seeds) {
+  std::vector<SeedSps> result;
+  for (const auto& seed : seeds) {
+    result.push_back({seed.sp()[0], seed.sp()[1], seed.sp()[2]});
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(SeedingSeedfinderOrthogonal)
+
+BOOST_AUTO_TEST_CASE(MatchesExhaustiveSearch) {
+  SeedfinderConfig<SpacePoint> config;
+  config.rMax = 160.;
+  config.deltaRMin = 5.;
+  config.deltaRMax = 160.;
+  config.collisionRegionMin = -250.;
+  config.collisionRegionMax = 250.;
+  config.zMin = -2800.;
+  config.zMax = 2800.;
+  config.maxSeedsPerSpM = 5;
+  config.cotThetaMax = 7.40627;
+  config.sigmaScattering = 1.;
+  config.minPt = 500.;
+  config.bFieldInZ = 0.00199724;
+  config.beamPos = {0., 0.};
+  config.impactMax = 10.;
+  config.seedFilter =
+      std::make_shared<SeedFilter<SpacePoint>>(SeedFilterConfig());
+
+  auto spacePoints = makeTracks(300u, config.bFieldInZ);
+  std::vector<const SpacePoint*> spPointers;
+  for (const auto& sp : spacePoints) {
+    spPointers.push_back(&sp);
+  }
+  auto ct = [](const SpacePoint& sp, float, float,
+               float) -> std::pair<Vector3, Vector2> {
+    return {Vector3(sp.x(), sp.y(), sp.z()),
+            Vector2(sp.varianceR, sp.varianceZ)};
+  };
+
+  SeedfinderOrthogonal<SpacePoint> orthogonal(config);
+  auto seeds =
+      sortedSeeds(orthogonal.createSeeds(spPointers.begin(), spPointers.end(),
+                                         ct));
+
+  // every space point in the same hemisphere is a bottom and top candidate
+  // of a middle space point. the opposite hemisphere is excluded, since the
+  // conformal triplet cuts accept back-to-back combinations through the
+  // beam line, which no track can produce.
+  std::vector<InternalSpacePoint<SpacePoint>> internal;
+  for (const auto& sp : spacePoints) {
+    internal.emplace_back(sp, Vector3(sp.x(), sp.y(), sp.z()), config.beamPos,
+                          Vector2(sp.varianceR, sp.varianceZ));
+  }
+  Seedfinder<SpacePoint> exhaustive(config);
+  Seedfinder<SpacePoint>::State exhaustiveState;
+  std::vector<Seed<SpacePoint>> exhaustiveSeeds;
+  for (const auto& spM : internal) {
+    std::vector<const InternalSpacePoint<SpacePoint>*> middle = {&spM};
+    std::vector<const InternalSpacePoint<SpacePoint>*> hemisphere;
+    for (const auto& sp : internal) {
+      float deltaPhi = std::abs(sp.phi() - spM.phi());
+      if (std::min<float>(deltaPhi, 2 * M_PI - deltaPhi) < M_PI / 2) {
+        hemisphere.push_back(&sp);
+      }
+    }
+    exhaustive.createSeedsForGroup(exhaustiveState, exhaustiveSeeds,
+                                   hemisphere, middle, hemisphere);
+  }
+  auto expected = sortedSeeds(exhaustiveSeeds);
+
+  BOOST_CHECK_GT(expected.size(), 0u);
+  BOOST_CHECK_EQUAL(seeds.size(), expected.size());
+  BOOST_CHECK(seeds == expected);
+
+  // reusing the state gives the same seeds
+  SeedfinderOrthogonal<SpacePoint>::State state;
+  std::vector<Seed<SpacePoint>> output;
+  for (int i = 0; i < 2; ++i) {
+    output.clear();
+    orthogonal.createSeeds(state, spPointers.begin(), spPointers.end(), ct,
+                           output);
+    BOOST_CHECK(sortedSeeds(output) == expected);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,162 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Seeding/BinFinder.hpp"
+#include "Acts/Seeding/BinnedSPGroup.hpp"
+#include "Acts/Seeding/Seed.hpp"
+#include "Acts/Seeding/SeedFilter.hpp"
+#include "Acts/Seeding/Seedfinder.hpp"
+#include "Acts/Seeding/SpacePointGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "SpacePoint.hpp"
+
+namespace {
+
+using namespace Acts;
+
+using State = Seedfinder<SpacePoint>::State;
+
+// space points of helices from the beam line on four barrel layers. every
+// tenth track shares the layer radius exactly to have equal radii.
+std::vector<SpacePoint> makeTracks(size_t nTracks, float bFieldInZ) {
+  const std::vector<float> radii = {33., 50.5, 88.5, 122.5};
+  std::default_random_engine rng(42);
+  std::uniform_real_distribution<float> pT(400., 5000.);
+  std::uniform_real_distribution<float> phi(-M_PI, M_PI);
+  std::uniform_real_distribution<float> eta(-2., 2.);
+  std::normal_distribution<float> z0(0., 50.);
+  std::normal_distribution<float> noise(0., 0.02);
+  std::vector<SpacePoint> spacePoints;
+  for (size_t i = 0; i < nTracks; ++i) {
+    float helixRadius = pT(rng) / (300. * bFieldInZ);
+    float phi0 = phi(rng);
+    float cotTheta = std::sinh(eta(rng));
+    float z = z0(rng);
+    for (size_t l = 0; l < radii.size(); ++l) {
+      float alpha = std::asin(radii[l] / (2 * helixRadius));
+      float r = radii[l] + ((i % 10 == 0) ? 0.f : noise(rng));
+      float x = r * std::cos(phi0 + alpha);
+      float y = r * std::sin(phi0 + alpha);
+      spacePoints.push_back({x, y, z + cotTheta * 2 * helixRadius * alpha, r,
+                             int(l), 0.0003, 0.05});
+    }
+  }
+  return spacePoints;
+}
+
+// data pointer and capacity of every buffer in the state
+std::vector<std::pair<const void*, size_t>> buffers(const State& state) {
+  auto buffer = [](const auto& vec) {
+    return std::make_pair(static_cast<const void*>(vec.data()),
+                          vec.capacity());
+  };
+  return {buffer(state.bottomSPVec),     buffer(state.bottomRVec),
+          buffer(state.topSPVec),        buffer(state.topRVec),
+          buffer(state.rangeSPVec),      buffer(state.radiusOrder),
+          buffer(state.compatBottomSP),  buffer(state.compatTopSP),
+          buffer(state.linCircleBottom), buffer(state.linCircleTop),
+          buffer(state.topU),            buffer(state.topV),
+          buffer(state.selectedTop),     buffer(state.topSpVec),
+          buffer(state.curvatures),      buffer(state.impactParameters),
+          buffer(state.filterState.curvatureOrder),
+          buffer(state.filterState.isCompatible),
+          buffer(state.seedsPerSpM)};
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(SeedingSeedfinderState)
+
+BOOST_AUTO_TEST_CASE(ReuseWithoutAllocations) {
+  SeedfinderConfig<SpacePoint> config;
+  config.rMax = 160.;
+  config.deltaRMin = 5.;
+  config.deltaRMax = 160.;
+  config.collisionRegionMin = -250.;
+  config.collisionRegionMax = 250.;
+  config.zMin = -2800.;
+  config.zMax = 2800.;
+  config.maxSeedsPerSpM = 5;
+  config.cotThetaMax = 7.40627;
+  config.sigmaScattering = 1.;
+  config.minPt = 500.;
+  config.bFieldInZ = 0.00199724;
+  config.beamPos = {0., 0.};
+  config.impactMax = 10.;
+  config.seedFilter =
+      std::make_shared<SeedFilter<SpacePoint>>(SeedFilterConfig());
+
+  SpacePointGridConfig gridConf;
+  gridConf.bFieldInZ = config.bFieldInZ;
+  gridConf.minPt = config.minPt;
+  gridConf.rMax = config.rMax;
+  gridConf.zMax = config.zMax;
+  gridConf.zMin = config.zMin;
+  gridConf.deltaRMax = config.deltaRMax;
+  gridConf.cotThetaMax = config.cotThetaMax;
+
+  auto spacePoints = makeTracks(500u, config.bFieldInZ);
+  std::vector<const SpacePoint*> spPointers;
+  for (const auto& sp : spacePoints) {
+    spPointers.push_back(&sp);
+  }
+  auto ct = [](const SpacePoint& sp, float, float,
+               float) -> std::pair<Vector3, Vector2> {
+    return {Vector3(sp.x(), sp.y(), sp.z()),
+            Vector2(sp.varianceR, sp.varianceZ)};
+  };
+  auto binFinder = std::make_shared<BinFinder<SpacePoint>>();
+  BinnedSPGroup<SpacePoint> spGroup(
+      spPointers.begin(), spPointers.end(), ct, binFinder, binFinder,
+      SpacePointGridCreator::createGrid<SpacePoint>(gridConf), config);
+  Seedfinder<SpacePoint> finder(config);
+
+  // a fresh state for every group
+  std::vector<Seed<SpacePoint>> expected;
+  for (auto groupIt = spGroup.begin(); !(groupIt == spGroup.end());
+       ++groupIt) {
+    auto seeds = finder.createSeedsForGroup(groupIt.bottom(), groupIt.middle(),
+                                            groupIt.top());
+    expected.insert(expected.end(), seeds.begin(), seeds.end());
+  }
+  BOOST_CHECK_GT(expected.size(), 0u);
+
+  State state;
+  std::vector<Seed<SpacePoint>> seeds;
+  seeds.reserve(expected.size());
+  std::vector<std::pair<const void*, size_t>> firstPass;
+  for (int pass = 0; pass < 2; ++pass) {
+    seeds.clear();
+    for (auto groupIt = spGroup.begin(); !(groupIt == spGroup.end());
+         ++groupIt) {
+      finder.createSeedsForGroup(state, seeds, groupIt.bottom(),
+                                 groupIt.middle(), groupIt.top());
+    }
+    BOOST_CHECK_EQUAL(seeds.size(), expected.size());
+    for (size_t i = 0; i < std::min(seeds.size(), expected.size()); ++i) {
+      BOOST_CHECK(seeds[i].sp() == expected[i].sp());
+    }
+    if (pass == 0) {
+      firstPass = buffers(state);
+    }
+  }
+  // the second pass over the same groups neither grows nor moves any buffer
+  auto secondPass = buffers(state);
+  BOOST_CHECK(secondPass == firstPass);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,68 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Seeding/detail/TripletPreselection.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(SeedingTripletPreselection)
+
+BOOST_AUTO_TEST_CASE(SameAsScalarSelection) {
+  const float rM = 50.;
+  const float minHelixDiameter2 = 1e5;
+  const float impactMax = 10.;
+  const float Ub = 0.002;
+  const float Vb = 0.0001;
+
+  std::minstd_rand rng(42);
+  std::normal_distribution<float> U(0., 0.01);
+  std::normal_distribution<float> V(0., 0.001);
+  std::vector<float> topU;
+  std::vector<float> topV;
+  for (size_t i = 0; i < 1000; ++i) {
+    topU.push_back(U(rng));
+    topV.push_back(V(rng));
+  }
+  // a vanishing dU must not be selected
+  topU.push_back(Ub);
+  topV.push_back(0.);
+
+  std::vector<uint8_t> selected(topU.size());
+  Acts::detail::preselectTriplets(Ub, Vb, topU.data(), topV.data(),
+                                  topU.size(), rM, minHelixDiameter2,
+                                  impactMax, selected.data());
+
+  size_t nSelected = 0;
+  for (size_t t = 0; t < topU.size(); ++t) {
+    bool expected = true;
+    float dU = topU[t] - Ub;
+    if (dU == 0.) {
+      expected = false;
+    } else {
+      float A = (topV[t] - Vb) / dU;
+      float S2 = 1. + A * A;
+      float B = Vb - A * Ub;
+      float B2 = B * B;
+      float Im = std::abs((A - B * rM) * rM);
+      expected = not(S2 < B2 * minHelixDiameter2) and Im <= impactMax;
+    }
+    BOOST_CHECK_EQUAL(selected[t] != 0, expected);
+    nSelected += expected;
+  }
+  BOOST_CHECK(not selected.back());
+  // make sure the test covers both outcomes
+  BOOST_CHECK_LT(0u, nSelected);
+  BOOST_CHECK_LT(nSelected, topU.size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,97 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/EventData/MultiTrajectory.hpp"
+#include "Acts/EventData/TrackStatePropMask.hpp"
+#include "Acts/Tests/CommonHelpers/TestSourceLink.hpp"
+#include "Acts/TrackFinding/GreedyAmbiguityResolution.hpp"
+
+#include <vector>
+
+namespace {
+
+using namespace Acts;
+using namespace Acts::Test;
+
+using Resolution = GreedyAmbiguityResolution;
+using Candidate = Resolution::Candidate<TestSourceLink>;
+
+// Add a trajectory with measurements given by their source ids
+size_t addTrajectory(MultiTrajectory<TestSourceLink>& traj,
+                     const std::vector<size_t>& measurementIds,
+                     double chi2PerMeasurement = 1.) {
+  size_t tip = SIZE_MAX;
+  for (auto id : measurementIds) {
+    tip = traj.addTrackState(TrackStatePropMask::Uncalibrated, tip);
+    auto ts = traj.getTrackState(tip);
+    ts.uncalibrated() =
+        TestSourceLink(eBoundLoc0, 0., 1., GeometryIdentifier(), id);
+    ts.typeFlags().set(TrackStateFlag::MeasurementFlag);
+    ts.chi2() = chi2PerMeasurement;
+  }
+  // add a hole that must not count as a measurement
+  tip = traj.addTrackState(TrackStatePropMask::None, tip);
+  traj.getTrackState(tip).typeFlags().set(TrackStateFlag::HoleFlag);
+  return tip;
+}
+
+auto sourceId = [](const TestSourceLink& sl) { return sl.sourceId; };
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TrackFindingGreedyAmbiguityResolution)
+
+BOOST_AUTO_TEST_CASE(RemoveDuplicates) {
+  MultiTrajectory<TestSourceLink> traj;
+  std::vector<Candidate> candidates = {
+      // short duplicate of the next candidate
+      {&traj, addTrajectory(traj, {0, 1, 2, 3})},
+      {&traj, addTrajectory(traj, {0, 1, 2, 3, 4})},
+      // shares a single measurement and is kept
+      {&traj, addTrajectory(traj, {4, 5, 6, 7, 8})},
+      // too short
+      {&traj, addTrajectory(traj, {9, 10})},
+      // identical to the first long candidate but worse chi2
+      {&traj, addTrajectory(traj, {0, 1, 2, 3, 4}, 2.)},
+  };
+
+  Resolution::Config cfg;
+  cfg.maximumSharedHits = 1;
+  cfg.nMeasurementsMin = 3;
+  Resolution resolution(cfg);
+
+  auto accepted = resolution.solve(candidates, 11u, sourceId);
+  std::vector<size_t> expected = {1u, 2u};
+  BOOST_CHECK_EQUAL_COLLECTIONS(accepted.begin(), accepted.end(),
+                                expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(SeedOrderTieBreak) {
+  MultiTrajectory<TestSourceLink> traj;
+  // separate multi trajectories are supported as well
+  MultiTrajectory<TestSourceLink> other;
+  std::vector<Candidate> candidates = {
+      {&traj, addTrajectory(traj, {3, 4, 5})},
+      {&other, addTrajectory(other, {3, 4, 5})},
+      {&other, addTrajectory(other, {0, 1, 2})},
+  };
+
+  Resolution::Config cfg;
+  cfg.maximumSharedHits = 0;
+  cfg.nMeasurementsMin = 3;
+  Resolution resolution(cfg);
+
+  auto accepted = resolution.solve(candidates, 6u, sourceId);
+  std::vector<size_t> expected = {0u, 2u};
+  BOOST_CHECK_EQUAL_COLLECTIONS(accepted.begin(), accepted.end(),
+                                expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
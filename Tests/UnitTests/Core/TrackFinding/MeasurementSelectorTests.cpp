@@ -0,0 +1,223 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Definitions/Algebra.hpp"
+#include "Acts/Definitions/Units.hpp"
+#include "Acts/EventData/Measurement.hpp"
+#include "Acts/EventData/TrackParameters.hpp"
+#include "Acts/Geometry/GeometryIdentifier.hpp"
+#include "Acts/Surfaces/PlaneSurface.hpp"
+#include "Acts/Tests/CommonHelpers/FloatComparisons.hpp"
+#include "Acts/Tests/CommonHelpers/TestSourceLink.hpp"
+#include "Acts/TrackFinding/MeasurementSelector.hpp"
+#include "Acts/TrackFinding/detail/MeasurementChi2Batch.hpp"
+#include "Acts/Utilities/Logger.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using namespace Acts;
+using namespace Acts::Test;
+using namespace Acts::UnitLiterals;
+
+using Measurement = BoundVariantMeasurement<TestSourceLink>;
+
+// reference chi2 computed with the full projection matrix
+double referenceChi2(const BoundTrackParameters& params,
+                     const Measurement& measurement) {
+  return std::visit(
+      [&](const auto& meas) {
+        const auto& H = meas.projector();
+        const auto res = meas.residuals(params.parameters());
+        const auto cov = meas.covariance() +
+                         H * (*params.covariance()) * H.transpose();
+        return (res.transpose() * cov.inverse() * res).eval()(0, 0);
+      },
+      measurement);
+}
+
+struct Fixture {
+  std::default_random_engine rng{42u};
+  std::normal_distribution<double> normal{0.0, 1.0};
+
+  std::shared_ptr<PlaneSurface> surface = Surface::makeShared<PlaneSurface>(
+      Vector3(0, 0, 0), Vector3::UnitX());
+  BoundTrackParameters params;
+  std::vector<Measurement> measurements;
+  std::unique_ptr<const Logger> logger =
+      getDefaultLogger("MeasurementSelector", Logging::INFO);
+
+  Fixture() : params(makeParameters()) {
+    for (size_t i = 0; i < 24; ++i) {
+      const double loc0 = 100_um * normal(rng);
+      const double loc1 = 150_um * normal(rng);
+      switch (i % 4) {
+        case 0:
+          measurements.push_back(makeMeasurement(
+              TestSourceLink(), ActsVector<1>(loc0),
+              ActsSymMatrix<1>::Constant(40_um * 40_um), eBoundLoc0));
+          break;
+        case 1:
+          measurements.push_back(makeMeasurement(
+              TestSourceLink(), ActsVector<1>(loc1),
+              ActsSymMatrix<1>::Constant(60_um * 60_um), eBoundLoc1));
+          break;
+        case 2: {
+          ActsSymMatrix<2> cov;
+          cov << 25_um * 25_um, 100_um * 100_um * 0.1, 100_um * 100_um * 0.1,
+              50_um * 50_um;
+          measurements.push_back(makeMeasurement(TestSourceLink(),
+                                                 Vector2(loc0, loc1), cov,
+                                                 eBoundLoc0, eBoundLoc1));
+          break;
+        }
+        default: {
+          ActsSymMatrix<3> cov = ActsSymMatrix<3>::Zero();
+          cov.diagonal() << 25_um * 25_um, 50_um * 50_um, 1_ns * 1_ns;
+          Vector3 values(loc0, loc1, normal(rng));
+          measurements.push_back(makeMeasurement(TestSourceLink(), values, cov,
+                                                 eBoundLoc0, eBoundLoc1,
+                                                 eBoundTime));
+          break;
+        }
+      }
+    }
+  }
+
+  BoundTrackParameters makeParameters() {
+    BoundVector vector = BoundVector::Zero();
+    vector[eBoundLoc0] = 10_um;
+    vector[eBoundLoc1] = -20_um;
+    vector[eBoundPhi] = 0.1;
+    vector[eBoundTheta] = 1.2;
+    vector[eBoundQOverP] = 1 / 1_GeV;
+    // correlated covariance to exercise the subspace projection
+    BoundSymMatrix cov = BoundSymMatrix::Identity() * 0.01;
+    cov(eBoundLoc0, eBoundLoc0) = 30_um * 30_um;
+    cov(eBoundLoc1, eBoundLoc1) = 40_um * 40_um;
+    cov(eBoundLoc0, eBoundLoc1) = cov(eBoundLoc1, eBoundLoc0) =
+        0.2 * 30_um * 40_um;
+    cov(eBoundTime, eBoundTime) = 0.5_ns * 0.5_ns;
+    return BoundTrackParameters(surface, vector, cov);
+  }
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TrackFindingMeasurementSelector)
+
+BOOST_AUTO_TEST_CASE(Chi2Batch) {
+  Fixture f;
+
+  detail::MeasurementChi2Batch<1u> batch1;
+  detail::MeasurementChi2Batch<2u> batch2;
+  batch1.reset(f.measurements.size());
+  batch2.reset(f.measurements.size());
+  for (size_t i = 0; i < f.measurements.size(); ++i) {
+    std::visit(
+        [&](const auto& meas) {
+          const auto& H = meas.projector();
+          const auto res = meas.residuals(f.params.parameters());
+          const auto cov = (meas.covariance() +
+                            H * (*f.params.covariance()) * H.transpose())
+                               .eval();
+          if constexpr (std::decay_t<decltype(meas)>::size() == 1u) {
+            batch1.push_back(i, res, cov);
+          } else if constexpr (std::decay_t<decltype(meas)>::size() == 2u) {
+            batch2.push_back(i, res, cov);
+          }
+        },
+        f.measurements[i]);
+  }
+  BOOST_CHECK_EQUAL(batch1.size(), 12u);
+  BOOST_CHECK_EQUAL(batch2.size(), 6u);
+
+  batch1.computeChi2();
+  batch2.computeChi2();
+  for (size_t i = 0; i < batch1.size(); ++i) {
+    CHECK_CLOSE_REL(
+        batch1.chi2(i),
+        referenceChi2(f.params, f.measurements[batch1.index(i)]), 1e-9);
+  }
+  for (size_t i = 0; i < batch2.size(); ++i) {
+    CHECK_CLOSE_REL(
+        batch2.chi2(i),
+        referenceChi2(f.params, f.measurements[batch2.index(i)]), 1e-9);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SelectBestCandidates) {
+  Fixture f;
+
+  // reference selection from fully sorted chi2 values
+  std::vector<std::pair<size_t, double>> sorted;
+  for (size_t i = 0; i < f.measurements.size(); ++i) {
+    sorted.emplace_back(i, referenceChi2(f.params, f.measurements[i]));
+  }
+  std::sort(sorted.begin(), sorted.end(),
+            [](const auto& lhs, const auto& rhs) {
+              return lhs.second < rhs.second;
+            });
+
+  for (size_t k : {1u, 3u, 7u, 50u}) {
+    MeasurementSelector selector({
+        {GeometryIdentifier(), {std::numeric_limits<double>::max(), k}},
+    });
+    std::vector<std::pair<size_t, double>> measChi2;
+    std::vector<size_t> candidates;
+    bool isOutlier = true;
+    auto res = selector(f.params, f.measurements, measChi2, candidates,
+                        isOutlier, LoggerWrapper{*f.logger});
+    BOOST_REQUIRE(res.ok());
+    BOOST_CHECK(not isOutlier);
+    BOOST_REQUIRE_EQUAL(candidates.size(),
+                        std::min<size_t>(k, f.measurements.size()));
+    for (size_t i = 0; i < candidates.size(); ++i) {
+      BOOST_CHECK_EQUAL(candidates[i], sorted[i].first);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SelectOutlier) {
+  Fixture f;
+
+  // reference minimum chi2 measurement
+  size_t minIndex = 0;
+  double minChi2 = std::numeric_limits<double>::max();
+  for (size_t i = 0; i < f.measurements.size(); ++i) {
+    double chi2 = referenceChi2(f.params, f.measurements[i]);
+    if (chi2 < minChi2) {
+      minChi2 = chi2;
+      minIndex = i;
+    }
+  }
+
+  // chi2 cut that rejects all measurements
+  MeasurementSelector selector({
+      {GeometryIdentifier(), {0.5 * minChi2, 5u}},
+  });
+  std::vector<std::pair<size_t, double>> measChi2;
+  std::vector<size_t> candidates;
+  bool isOutlier = false;
+  auto res = selector(f.params, f.measurements, measChi2, candidates,
+                      isOutlier, LoggerWrapper{*f.logger});
+  BOOST_REQUIRE(res.ok());
+  BOOST_CHECK(isOutlier);
+  BOOST_REQUIRE_EQUAL(candidates.size(), 1u);
+  BOOST_CHECK_EQUAL(candidates[0], minIndex);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
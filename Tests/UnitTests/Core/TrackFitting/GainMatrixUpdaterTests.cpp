@@ -18,6 +18,8 @@
 #include "Acts/Tests/CommonHelpers/TestSourceLink.hpp"
 #include "Acts/TrackFitting/GainMatrixUpdater.hpp"
 
+#include <vector>
+
 namespace {
 
 using namespace Acts;
@@ -83,4 +85,56 @@ BOOST_AUTO_TEST_CASE(Update) {
   CHECK_CLOSE_ABS(ts.chi2(), 1.33958, 1e-4);
 }
 
+BOOST_AUTO_TEST_CASE(BatchUpdate) {
+  // Mixed 1d and 2d measurements
+  std::vector<TestSourceLink> sourceLinks = {
+      TestSourceLink(eBoundLoc0, eBoundLoc1, Vector2(-0.1, 0.45),
+                     Vector2(0.04, 0.1).asDiagonal()),
+      TestSourceLink(eBoundLoc0, 0.2, 0.05),
+      TestSourceLink(eBoundLoc1, -0.3, 0.02),
+      TestSourceLink(eBoundLoc0, eBoundLoc1, Vector2(0.25, 0.6),
+                     Vector2(0.01, 0.2).asDiagonal()),
+  };
+
+  ParametersVector trkPar;
+  trkPar << 0.3, 0.5, 0.5 * M_PI, 0.3 * M_PI, 0.01, 0.;
+  CovarianceMatrix trkCov = CovarianceMatrix::Zero();
+  trkCov.diagonal() << 0.08, 0.3, 1, 1, 1, 0;
+  trkCov(eBoundLoc0, eBoundLoc1) = trkCov(eBoundLoc1, eBoundLoc0) = 0.01;
+
+  // Each measurement is stored twice; once for the single-state update as
+  // reference and once for the batched update
+  MultiTrajectory<TestSourceLink> traj;
+  std::vector<size_t> singleIndices;
+  std::vector<decltype(traj.getTrackState(0))> batch;
+  for (const auto& sourceLink : sourceLinks) {
+    for (size_t i = 0; i < 2; ++i) {
+      auto ts = traj.getTrackState(traj.addTrackState(TrackStatePropMask::All));
+      ts.predicted() = trkPar;
+      ts.predictedCovariance() = trkCov;
+      ts.pathLength() = 0.;
+      ts.uncalibrated() = sourceLink;
+      std::visit([&](const auto& m) { ts.setCalibrated(m); },
+                 calibrator(sourceLink, nullptr));
+      if (i == 0) {
+        singleIndices.push_back(ts.index());
+      } else {
+        batch.push_back(ts);
+      }
+    }
+  }
+
+  auto results = GainMatrixUpdater()(tgContext, batch);
+  BOOST_REQUIRE_EQUAL(results.size(), sourceLinks.size());
+  for (size_t i = 0; i < sourceLinks.size(); ++i) {
+    auto single = traj.getTrackState(singleIndices[i]);
+    BOOST_CHECK(GainMatrixUpdater()(tgContext, single).ok());
+    BOOST_CHECK(results[i].ok());
+    CHECK_CLOSE_ABS(batch[i].filtered(), single.filtered(), tol);
+    CHECK_CLOSE_ABS(batch[i].filteredCovariance(), single.filteredCovariance(),
+                    tol);
+    CHECK_CLOSE_ABS(batch[i].chi2(), single.chi2(), tol);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
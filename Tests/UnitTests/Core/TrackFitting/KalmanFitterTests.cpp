@@ -16,6 +16,7 @@
 #include "Acts/Geometry/TrackingGeometry.hpp"
 #include "Acts/MagneticField/ConstantBField.hpp"
 #include "Acts/MagneticField/MagneticFieldContext.hpp"
+#include "Acts/Propagator/DirectNavigator.hpp"
 #include "Acts/Propagator/EigenStepper.hpp"
 #include "Acts/Propagator/Navigator.hpp"
 #include "Acts/Propagator/Propagator.hpp"
@@ -35,6 +36,7 @@
 #include <algorithm>
 #include <memory>
 #include <random>
+#include <vector>
 
 namespace {
 
@@ -47,11 +49,15 @@ using StraightPropagator =
 using ConstantFieldStepper = Acts::EigenStepper<>;
 using ConstantFieldPropagator =
     Acts::Propagator<ConstantFieldStepper, Acts::Navigator>;
+using ConstantFieldDirectPropagator =
+    Acts::Propagator<ConstantFieldStepper, Acts::DirectNavigator>;
 
 using KalmanUpdater = Acts::GainMatrixUpdater;
 using KalmanSmoother = Acts::GainMatrixSmoother;
 using KalmanFitter =
     Acts::KalmanFitter<ConstantFieldPropagator, KalmanUpdater, KalmanSmoother>;
+using KalmanDirectFitter = Acts::KalmanFitter<ConstantFieldDirectPropagator,
+                                              KalmanUpdater, KalmanSmoother>;
 
 /// Find outliers using plain distance for testing purposes.
 ///
@@ -106,6 +112,15 @@ ConstantFieldPropagator makeConstantFieldPropagator(
   return ConstantFieldPropagator(std::move(stepper), std::move(navigator));
 }
 
+// Construct a propagator along given surfaces using a constant magnetic field.
+ConstantFieldDirectPropagator makeConstantFieldDirectPropagator(double bz) {
+  auto field =
+      std::make_shared<Acts::ConstantBField>(Acts::Vector3(0.0, 0.0, bz));
+  ConstantFieldStepper stepper(std::move(field));
+  return ConstantFieldDirectPropagator(std::move(stepper),
+                                       Acts::DirectNavigator());
+}
+
 // Construct initial track parameters.
 Acts::CurvilinearTrackParameters makeParameters() {
   // create covariance matrix from reasonable standard deviations
@@ -153,6 +168,8 @@ const auto simPropagator = makeStraightPropagator(geometry);
 const auto kfLogger = getDefaultLogger("KalmanFilter", Logging::INFO);
 const auto kfZeroPropagator = makeConstantFieldPropagator(geometry, 0_T);
 const auto kfZero = KalmanFitter(kfZeroPropagator);
+const auto kfZeroDirect =
+    KalmanDirectFitter(makeConstantFieldDirectPropagator(0_T));
 
 std::default_random_engine rng(42);
 
@@ -466,6 +483,72 @@ BOOST_AUTO_TEST_CASE(ZeroFieldWithOutliers) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(ZeroFieldRefit) {
+  auto start = makeParameters();
+  auto measurements = createMeasurements(simPropagator, geoCtx, magCtx, start,
+                                         resolutions, rng);
+  const auto& sourceLinks = measurements.sourceLinks;
+  BOOST_REQUIRE_EQUAL(sourceLinks.size(), nMeasurements);
+
+  KalmanFitterOptions<TestSourceLinkCalibrator, VoidOutlierFinder> kfOptions(
+      geoCtx, magCtx, calCtx, TestSourceLinkCalibrator(), VoidOutlierFinder(),
+      LoggerWrapper{*kfLogger}, PropagatorPlainOptions());
+
+  auto res = kfZero.fit(sourceLinks, start, kfOptions);
+  BOOST_REQUIRE(res.ok());
+  const auto& first = res.value();
+
+  // remove one measurement as done e.g. by an outlier rejection
+  auto reduced = sourceLinks;
+  reduced.erase(reduced.begin() + 2);
+
+  // refit along the previous surfaces
+  auto refitRes = kfZeroDirect.refit(reduced, start, kfOptions,
+                                     first.fittedStates, first.lastTrackIndex);
+  BOOST_REQUIRE(refitRes.ok());
+  const auto& refitted = refitRes.value();
+  BOOST_CHECK_EQUAL(refitted.measurementStates, reduced.size());
+  BOOST_CHECK_EQUAL(refitted.missedActiveSurfaces.size(), 1u);
+  BOOST_CHECK(refitted.smoothed);
+  BOOST_CHECK(refitted.finished);
+
+  // refit reusing the previous transport jacobians
+  kfOptions.refitLinearizationChi2Max = 1e3;
+  auto linearizedRes = kfZeroDirect.refit(
+      reduced, start, kfOptions, first.fittedStates, first.lastTrackIndex);
+  BOOST_REQUIRE(linearizedRes.ok());
+  const auto& linearized = linearizedRes.value();
+  BOOST_CHECK_EQUAL(linearized.measurementStates, reduced.size());
+  BOOST_CHECK_EQUAL(linearized.missedActiveSurfaces.size(), 1u);
+  BOOST_CHECK(linearized.smoothed);
+  BOOST_CHECK(linearized.finished);
+
+  // both refits must agree on all states
+  std::vector<BoundVector> expected;
+  refitted.fittedStates.visitBackwards(
+      refitted.lastMeasurementIndex,
+      [&](const auto& state) { expected.push_back(state.smoothed()); });
+  std::vector<BoundVector> smoothed;
+  linearized.fittedStates.visitBackwards(
+      linearized.lastMeasurementIndex,
+      [&](const auto& state) { smoothed.push_back(state.smoothed()); });
+  BOOST_REQUIRE_EQUAL(smoothed.size(), expected.size());
+  for (size_t i = 0; i < smoothed.size(); ++i) {
+    CHECK_CLOSE_OR_SMALL(smoothed[i], expected[i], 1e-6, 1e-6);
+  }
+
+  // too large deviations fall back to a propagation
+  kfOptions.refitLinearizationChi2Max = 1e-12;
+  auto fallbackRes = kfZeroDirect.refit(
+      reduced, start, kfOptions, first.fittedStates, first.lastTrackIndex);
+  BOOST_REQUIRE(fallbackRes.ok());
+  const auto& fallback = fallbackRes.value();
+  BOOST_CHECK_EQUAL(fallback.measurementStates, reduced.size());
+  const auto fallbackState =
+      fallback.fittedStates.getTrackState(fallback.lastMeasurementIndex);
+  CHECK_CLOSE_ABS(fallbackState.smoothed(), expected.front(), 1e-12);
+}
+
 // TODO this is not really Kalman fitter specific. is probably better tested
 // with a synthetic trajectory.
 BOOST_AUTO_TEST_CASE(GlobalCovariance) {
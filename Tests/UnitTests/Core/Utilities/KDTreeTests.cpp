@@ -0,0 +1,78 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/Utilities/KDTree.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace Acts {
+namespace Test {
+
+using Tree = KDTree<3, int, double>;
+
+BOOST_AUTO_TEST_SUITE(Utilities)
+
+BOOST_AUTO_TEST_CASE(KDTreeEmpty) {
+  Tree tree({});
+  BOOST_CHECK_EQUAL(tree.size(), 0u);
+  std::vector<int> values;
+  tree.rangeSearch({{{-1., 1.}, {-1., 1.}, {-1., 1.}}}, values);
+  BOOST_CHECK(values.empty());
+}
+
+BOOST_AUTO_TEST_CASE(KDTreeRangeSearch) {
+  std::default_random_engine rng(42);
+  std::uniform_real_distribution<double> coordinate(-10., 10.);
+  // a coarse grid of values produces many identical coordinates
+  std::uniform_int_distribution<int> gridPoint(-5, 5);
+
+  std::vector<Tree::pair_t> elements;
+  for (int i = 0; i < 2000; ++i) {
+    Tree::coordinate_t point = {coordinate(rng), coordinate(rng),
+                                double(gridPoint(rng))};
+    elements.push_back({point, i});
+  }
+  auto reference = elements;
+  Tree tree(std::move(elements));
+  BOOST_CHECK_EQUAL(tree.size(), reference.size());
+
+  for (int q = 0; q < 100; ++q) {
+    Tree::range_t range;
+    for (auto& [min, max] : range) {
+      min = coordinate(rng);
+      max = min + std::abs(coordinate(rng));
+    }
+    // integer bounds on the grid dimension include points on the boundary
+    range[2] = {double(gridPoint(rng)), double(gridPoint(rng) + 2)};
+
+    std::vector<int> expected;
+    for (const auto& [point, value] : reference) {
+      if (Tree::contains(range, point)) {
+        expected.push_back(value);
+      }
+    }
+    std::vector<int> found;
+    tree.rangeSearch(range, found);
+    std::sort(found.begin(), found.end());
+    BOOST_CHECK(found == expected);
+  }
+
+  // the full space contains everything
+  std::vector<int> all;
+  tree.rangeSearch({{{-10., 10.}, {-10., 10.}, {-5., 5.}}}, all);
+  BOOST_CHECK_EQUAL(all.size(), reference.size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace Test
+}  // namespace Acts
@@ -0,0 +1,334 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "Acts/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/Index.hpp"
+#include "ActsExamples/EventData/IndexSourceLink.hpp"
+#include "ActsExamples/EventData/Measurement.hpp"
+#include "ActsExamples/EventData/ProtoTrack.hpp"
+#include "ActsExamples/EventData/SimHit.hpp"
+#include "ActsExamples/EventData/SimParticle.hpp"
+#include "ActsExamples/EventData/SimSeed.hpp"
+#include "ActsExamples/EventData/SimSpacePoint.hpp"
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+#include "ActsExamples/Io/Binary/BinaryCheckpoint.hpp"
+#include "ActsExamples/Io/Binary/BinaryCheckpointReader.hpp"
+#include "ActsExamples/Io/Binary/BinaryCheckpointWriter.hpp"
+#include "ActsFatras/EventData/Barcode.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <variant>
+
+using namespace ActsExamples;
+
+namespace {
+
+using Type = CheckpointCollectionType;
+
+constexpr size_t kEvents = 2;
+
+BinaryCheckpoint makeCheckpoint() {
+  return {"BinaryCheckpointTests",
+          "all",
+          "events=2\n",
+          {
+              {"particles", Type::Particles},
+              {"simhits", Type::SimHits},
+              {"measurements", Type::Measurements},
+              {"sourcelinks", Type::SourceLinks},
+              {"measurement_particles", Type::MeasurementParticlesMap},
+              {"measurement_simhits", Type::MeasurementSimHitsMap},
+              {"spacepoints", Type::SpacePoints},
+              {"seeds", Type::Seeds, "spacepoints"},
+              {"prototracks", Type::ProtoTracks},
+          }};
+}
+
+/// Remove all files of the checkpoint and its directories.
+void removeCheckpoint(const BinaryCheckpoint& checkpoint) {
+  auto directory = checkpoint.directory();
+  for (const auto& collection : checkpoint.collections) {
+    std::remove((directory + "/" + collection.name + ".bin").c_str());
+  }
+  std::remove((directory + "/configuration.txt").c_str());
+  std::remove(directory.c_str());
+  std::remove(checkpoint.cacheDir.c_str());
+}
+
+/// Add all collections of the checkpoint with event-dependent sizes.
+void fillEvent(size_t event, WhiteBoard& store) {
+  size_t n = 3 + 2 * event;
+
+  SimParticleContainer particles;
+  SimHitContainer simHits;
+  MeasurementContainer measurements;
+  IndexSourceLinkContainer sourceLinks;
+  IndexMultimap<ActsFatras::Barcode> measurementParticles;
+  IndexMultimap<Index> measurementSimHits;
+  SimSpacePointContainer spacePoints;
+  for (Index i = 0; i < n; ++i) {
+    ActsFatras::Barcode particleId(100 * (event + 1) + i);
+    Acts::GeometryIdentifier geometryId(1000 + 7 * i);
+
+    ActsFatras::Particle particle(particleId, Acts::PdgParticle::eMuon, -1,
+                                  0.105);
+    particle.setPosition4(i, 2 * i, 3 * i, 0.5 * i)
+        .setDirection(1, i, 2)
+        .setAbsoluteMomentum(10 + i)
+        .setProperTime(i)
+        .setMaterialPassed(0.1 * i, 0.2 * i);
+    particles.insert(particle);
+
+    simHits.emplace_hint(
+        simHits.end(), geometryId, particleId,
+        ActsFatras::Hit::Vector4(i, 1, 2, 3),
+        ActsFatras::Hit::Vector4(4, 5, 6, 7 + i),
+        ActsFatras::Hit::Vector4(4, 5, 6, 6 + i), i);
+
+    IndexSourceLink sourceLink(geometryId, i);
+    // alternate between one- and two-dimensional measurements
+    if (i % 2 == 0) {
+      Acts::ActsSymMatrix<2> cov = Acts::ActsSymMatrix<2>::Zero();
+      cov(0, 0) = 0.1;
+      cov(1, 1) = 0.2 * i;
+      measurements.emplace_back(
+          Acts::makeMeasurement(sourceLink, Acts::Vector2(0.5 * i, -1.5), cov,
+                                Acts::eBoundLoc0, Acts::eBoundLoc1));
+    } else {
+      measurements.emplace_back(Acts::makeMeasurement(
+          sourceLink, Acts::ActsVector<1>(2.5 * i),
+          Acts::ActsSymMatrix<1>::Constant(0.3), Acts::eBoundTime));
+    }
+    sourceLinks.insert(sourceLink);
+
+    measurementParticles.emplace_hint(measurementParticles.end(), i,
+                                      particleId);
+    measurementSimHits.emplace_hint(measurementSimHits.end(), i, i);
+    spacePoints.emplace_back(Acts::Vector3(i, 2. * i, -1. * i), 0.1 * i, 0.2,
+                             i);
+  }
+  store.add("particles", std::move(particles));
+  store.add("simhits", std::move(simHits));
+  store.add("measurements", std::move(measurements));
+  store.add("sourcelinks", std::move(sourceLinks));
+  store.add("measurement_particles", std::move(measurementParticles));
+  store.add("measurement_simhits", std::move(measurementSimHits));
+  store.add("spacepoints", std::move(spacePoints));
+
+  // the seeds must refer to the space points on the white board
+  const auto& sp = store.get<SimSpacePointContainer>("spacepoints");
+  SimSeedContainer seeds;
+  seeds.emplace_back(sp[0], sp[1], sp[2], 1.5f);
+  if (event == 1) {
+    seeds.emplace_back(sp[4], sp[2], sp[3], -2.f);
+  }
+  store.add("seeds", std::move(seeds));
+
+  // trailing empty tracks must not be lost
+  ProtoTrackContainer protoTracks;
+  if (event == 0) {
+    protoTracks = {{}, {}};
+  } else {
+    protoTracks = {{0, 2, 4}, {}, {1}, {}, {}};
+  }
+  store.add("prototracks", std::move(protoTracks));
+}
+
+void writeCheckpoint(const BinaryCheckpoint& checkpoint) {
+  BinaryCheckpointWriter writer(checkpoint, Acts::Logging::WARNING);
+  for (size_t event = 0; event < kEvents; ++event) {
+    WhiteBoard store;
+    fillEvent(event, store);
+    BOOST_CHECK(writer.write(AlgorithmContext(0, event, store)) ==
+                ProcessCode::SUCCESS);
+  }
+  BOOST_CHECK(writer.endRun() == ProcessCode::SUCCESS);
+}
+
+template <typename measurement_t>
+Acts::BoundVector expandedParameters(const measurement_t& m) {
+  return m.expander() * m.parameters();
+}
+
+template <typename measurement_t>
+Acts::BoundVector expandedVariances(const measurement_t& m) {
+  return (m.expander() * m.covariance() * m.expander().transpose()).diagonal();
+}
+
+void checkMeasurements(const MeasurementContainer& decoded,
+                       const MeasurementContainer& expected) {
+  BOOST_REQUIRE_EQUAL(decoded.size(), expected.size());
+  for (size_t i = 0; i < decoded.size(); ++i) {
+    std::visit(
+        [](const auto& a, const auto& b) {
+          BOOST_CHECK_EQUAL(a.size(), b.size());
+          BOOST_CHECK_EQUAL(a.sourceLink().geometryId(),
+                            b.sourceLink().geometryId());
+          BOOST_CHECK_EQUAL(a.sourceLink().index(), b.sourceLink().index());
+          BOOST_CHECK_EQUAL(expandedParameters(a), expandedParameters(b));
+          BOOST_CHECK_EQUAL(expandedVariances(a), expandedVariances(b));
+        },
+        decoded[i], expected[i]);
+  }
+}
+
+void checkEvent(size_t event, const WhiteBoard& decoded) {
+  WhiteBoard expected;
+  fillEvent(event, expected);
+
+  const auto& particles = decoded.get<SimParticleContainer>("particles");
+  const auto& expectedParticles =
+      expected.get<SimParticleContainer>("particles");
+  BOOST_REQUIRE_EQUAL(particles.size(), expectedParticles.size());
+  for (auto a = particles.begin(), b = expectedParticles.begin();
+       a != particles.end(); ++a, ++b) {
+    BOOST_CHECK_EQUAL(a->particleId(), b->particleId());
+    BOOST_CHECK_EQUAL(a->pdg(), b->pdg());
+    BOOST_CHECK_EQUAL(a->charge(), b->charge());
+    BOOST_CHECK_EQUAL(a->mass(), b->mass());
+    BOOST_CHECK_EQUAL(a->fourPosition(), b->fourPosition());
+    BOOST_CHECK(a->unitDirection().isApprox(b->unitDirection()));
+    BOOST_CHECK_EQUAL(a->absoluteMomentum(), b->absoluteMomentum());
+    BOOST_CHECK_EQUAL(a->properTime(), b->properTime());
+    BOOST_CHECK_EQUAL(a->pathInX0(), b->pathInX0());
+    BOOST_CHECK_EQUAL(a->pathInL0(), b->pathInL0());
+  }
+
+  const auto& simHits = decoded.get<SimHitContainer>("simhits");
+  const auto& expectedSimHits = expected.get<SimHitContainer>("simhits");
+  BOOST_REQUIRE_EQUAL(simHits.size(), expectedSimHits.size());
+  for (auto a = simHits.begin(), b = expectedSimHits.begin();
+       a != simHits.end(); ++a, ++b) {
+    BOOST_CHECK_EQUAL(a->geometryId(), b->geometryId());
+    BOOST_CHECK_EQUAL(a->particleId(), b->particleId());
+    BOOST_CHECK_EQUAL(a->index(), b->index());
+    BOOST_CHECK_EQUAL(a->fourPosition(), b->fourPosition());
+    BOOST_CHECK_EQUAL(a->momentum4Before(), b->momentum4Before());
+    BOOST_CHECK_EQUAL(a->momentum4After(), b->momentum4After());
+  }
+
+  checkMeasurements(decoded.get<MeasurementContainer>("measurements"),
+                    expected.get<MeasurementContainer>("measurements"));
+
+  const auto& sourceLinks =
+      decoded.get<IndexSourceLinkContainer>("sourcelinks");
+  const auto& expectedSourceLinks =
+      expected.get<IndexSourceLinkContainer>("sourcelinks");
+  BOOST_CHECK(sourceLinks == expectedSourceLinks);
+
+  BOOST_CHECK(decoded.get<IndexMultimap<ActsFatras::Barcode>>(
+                  "measurement_particles") ==
+              expected.get<IndexMultimap<ActsFatras::Barcode>>(
+                  "measurement_particles"));
+  BOOST_CHECK(
+      decoded.get<IndexMultimap<Index>>("measurement_simhits") ==
+      expected.get<IndexMultimap<Index>>("measurement_simhits"));
+
+  const auto& spacePoints = decoded.get<SimSpacePointContainer>("spacepoints");
+  const auto& expectedSpacePoints =
+      expected.get<SimSpacePointContainer>("spacepoints");
+  BOOST_REQUIRE_EQUAL(spacePoints.size(), expectedSpacePoints.size());
+  for (size_t i = 0; i < spacePoints.size(); ++i) {
+    const auto& a = spacePoints[i];
+    const auto& b = expectedSpacePoints[i];
+    BOOST_CHECK_EQUAL(a.x(), b.x());
+    BOOST_CHECK_EQUAL(a.y(), b.y());
+    BOOST_CHECK_EQUAL(a.z(), b.z());
+    BOOST_CHECK_EQUAL(a.r(), b.r());
+    BOOST_CHECK_EQUAL(a.varianceR(), b.varianceR());
+    BOOST_CHECK_EQUAL(a.varianceZ(), b.varianceZ());
+    BOOST_CHECK_EQUAL(a.measurementIndex(), b.measurementIndex());
+  }
+
+  // the decoded seeds must point into the decoded space points
+  const auto& seeds = decoded.get<SimSeedContainer>("seeds");
+  const auto& expectedSeeds = expected.get<SimSeedContainer>("seeds");
+  BOOST_REQUIRE_EQUAL(seeds.size(), expectedSeeds.size());
+  for (size_t i = 0; i < seeds.size(); ++i) {
+    BOOST_CHECK_EQUAL(seeds[i].z(), expectedSeeds[i].z());
+    for (size_t j = 0; j < 3; ++j) {
+      BOOST_CHECK_EQUAL(seeds[i].sp()[j] - spacePoints.data(),
+                        expectedSeeds[i].sp()[j] - expectedSpacePoints.data());
+    }
+  }
+
+  const auto& protoTracks = decoded.get<ProtoTrackContainer>("prototracks");
+  const auto& expectedProtoTracks =
+      expected.get<ProtoTrackContainer>("prototracks");
+  BOOST_CHECK(protoTracks == expectedProtoTracks);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(BinaryCheckpointTests)
+
+BOOST_AUTO_TEST_CASE(RoundTrip) {
+  auto checkpoint = makeCheckpoint();
+  removeCheckpoint(checkpoint);
+  writeCheckpoint(checkpoint);
+  BOOST_CHECK(checkpoint.exists());
+
+  BinaryCheckpointReader reader(checkpoint, Acts::Logging::WARNING);
+  BOOST_CHECK_EQUAL(reader.availableEvents().first, 0u);
+  BOOST_CHECK_EQUAL(reader.availableEvents().second, kEvents);
+  // read in reverse to check that the events are independent
+  for (size_t event = kEvents; 0 < event--;) {
+    WhiteBoard store;
+    BOOST_CHECK(reader.read(AlgorithmContext(0, event, store)) ==
+                ProcessCode::SUCCESS);
+    checkEvent(event, store);
+  }
+  removeCheckpoint(checkpoint);
+}
+
+BOOST_AUTO_TEST_CASE(IncompleteIsNotReplayed) {
+  auto checkpoint = makeCheckpoint();
+  removeCheckpoint(checkpoint);
+  writeCheckpoint(checkpoint);
+  BOOST_CHECK(checkpoint.exists());
+
+  // a run that fails before the end leaves no configuration.txt behind
+  {
+    BinaryCheckpointWriter writer(checkpoint, Acts::Logging::WARNING);
+    WhiteBoard store;
+    fillEvent(0, store);
+    writer.write(AlgorithmContext(0, 0, store));
+  }
+  BOOST_CHECK(not checkpoint.exists());
+  BOOST_CHECK_THROW(
+      BinaryCheckpointReader(checkpoint, Acts::Logging::WARNING),
+      std::runtime_error);
+  removeCheckpoint(checkpoint);
+}
+
+BOOST_AUTO_TEST_CASE(ChangedConfigurationIsRejected) {
+  auto checkpoint = makeCheckpoint();
+  removeCheckpoint(checkpoint);
+  writeCheckpoint(checkpoint);
+  BOOST_CHECK(checkpoint.exists());
+
+  auto changed = checkpoint;
+  changed.configuration = "events=3\n";
+  BOOST_CHECK(not changed.exists());
+
+  // a hash collision must not replay the checkpoint of another configuration
+  {
+    std::ofstream configuration(checkpoint.directory() + "/configuration.txt");
+    configuration << changed.configuration;
+  }
+  BOOST_CHECK(not checkpoint.exists());
+  removeCheckpoint(checkpoint);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
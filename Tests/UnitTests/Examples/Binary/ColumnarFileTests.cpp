@@ -0,0 +1,142 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Io/Binary/ColumnarFile.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace ActsExamples;
+
+namespace {
+
+const std::string kPath = "ColumnarFileTests.bin";
+const std::vector<ColumnSpec> kColumns = {
+    {"id", ColumnType::UInt64},
+    {"flag", ColumnType::UInt8},
+    {"value", ColumnType::Float32},
+    {"weight", ColumnType::Float64},
+};
+
+struct EventData {
+  std::vector<uint64_t> ids;
+  std::vector<uint8_t> flags;
+  std::vector<float> values;
+  std::vector<double> weights;
+
+  explicit EventData(size_t event) {
+    // odd sizes to check the column alignment
+    for (size_t i = 0; i < 3 * event; ++i) {
+      ids.push_back(1000 * event + i);
+      flags.push_back(i % 3);
+      values.push_back(0.5f * i);
+      weights.push_back(-1.25 * i);
+    }
+  }
+
+  std::vector<ColumnData> columns() const {
+    return {ids, flags, values, weights};
+  }
+};
+
+template <typename T>
+std::vector<T> toVector(const Range<const T*>& range) {
+  return {range.begin(), range.end()};
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ColumnarFile)
+
+BOOST_AUTO_TEST_CASE(RoundTrip) {
+  // events out of order, one of them empty, and event 3 missing
+  const std::vector<size_t> events = {2, 0, 5, 1, 4};
+  {
+    ColumnarFileWriter writer(kPath, kColumns);
+    for (auto event : events) {
+      writer.writeEvent(event, EventData(event).columns());
+    }
+  }
+
+  ColumnarFileReader reader(kPath, kColumns);
+  BOOST_CHECK_EQUAL(reader.availableEvents().first, 0u);
+  BOOST_CHECK_EQUAL(reader.availableEvents().second, 6u);
+  for (auto event : events) {
+    EventData expected(event);
+    auto view = reader.event(event);
+    BOOST_CHECK_EQUAL(view.size(), expected.ids.size());
+    auto ids = toVector(view.column<uint64_t>(0));
+    auto flags = toVector(view.column<uint8_t>(1));
+    auto values = toVector(view.column<float>(2));
+    auto weights = toVector(view.column<double>(3));
+    BOOST_CHECK_EQUAL_COLLECTIONS(ids.begin(), ids.end(),
+                                  expected.ids.begin(), expected.ids.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(flags.begin(), flags.end(),
+                                  expected.flags.begin(),
+                                  expected.flags.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(values.begin(), values.end(),
+                                  expected.values.begin(),
+                                  expected.values.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(weights.begin(), weights.end(),
+                                  expected.weights.begin(),
+                                  expected.weights.end());
+  }
+  BOOST_CHECK_THROW(reader.event(3), std::out_of_range);
+  BOOST_CHECK_THROW(reader.event(6), std::out_of_range);
+  BOOST_CHECK_THROW(reader.event(1).column<float>(0), std::invalid_argument);
+
+  std::remove(kPath.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(InvalidWrite) {
+  ColumnarFileWriter writer(kPath, kColumns);
+  EventData data(1);
+  writer.writeEvent(1, data.columns());
+  // the same event again
+  BOOST_CHECK_THROW(writer.writeEvent(1, data.columns()),
+                    std::invalid_argument);
+  // missing column
+  BOOST_CHECK_THROW(writer.writeEvent(2, {data.ids, data.flags, data.values}),
+                    std::invalid_argument);
+  // wrong column type
+  BOOST_CHECK_THROW(
+      writer.writeEvent(2, {data.ids, data.flags, data.weights, data.weights}),
+      std::invalid_argument);
+  // inconsistent column size
+  std::vector<double> weights = {1.0};
+  BOOST_CHECK_THROW(
+      writer.writeEvent(2, {data.ids, data.flags, data.values, weights}),
+      std::invalid_argument);
+  writer.close();
+
+  std::remove(kPath.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(InvalidRead) {
+  BOOST_CHECK_THROW(ColumnarFileReader("does-not-exist.bin", kColumns),
+                    std::runtime_error);
+  {
+    ColumnarFileWriter writer(kPath, kColumns);
+    writer.writeEvent(0, EventData(0).columns());
+  }
+  // different column declarations
+  auto columns = kColumns;
+  columns.back().type = ColumnType::Float32;
+  BOOST_CHECK_THROW(ColumnarFileReader(kPath, columns), std::runtime_error);
+  columns.pop_back();
+  BOOST_CHECK_THROW(ColumnarFileReader(kPath, columns), std::runtime_error);
+
+  std::remove(kPath.c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
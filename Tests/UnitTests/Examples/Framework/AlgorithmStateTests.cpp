@@ -0,0 +1,123 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/AlgorithmState.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace ActsExamples;
+
+namespace {
+
+/// Counts how often it is constructed and destroyed.
+struct Counted {
+  static size_t constructed;
+  static size_t destroyed;
+
+  std::vector<int> buffer;
+
+  Counted() { ++constructed; }
+  ~Counted() { ++destroyed; }
+};
+
+size_t Counted::constructed = 0;
+size_t Counted::destroyed = 0;
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(AlgorithmStateTests)
+
+BOOST_AUTO_TEST_CASE(ConstructOnce) {
+  Counted::constructed = 0;
+  Counted::destroyed = 0;
+  {
+    AlgorithmState state;
+    BOOST_CHECK_EQUAL(Counted::constructed, 0u);
+
+    auto& first = state.get<Counted>();
+    first.buffer.assign(16, 1);
+    auto& second = state.get<Counted>();
+    BOOST_CHECK_EQUAL(&first, &second);
+    BOOST_CHECK_EQUAL(second.buffer.size(), 16u);
+    BOOST_CHECK_EQUAL(Counted::constructed, 1u);
+
+    // the object moves with the state
+    AlgorithmState moved = std::move(state);
+    BOOST_CHECK_EQUAL(&moved.get<Counted>(), &first);
+    BOOST_CHECK_EQUAL(Counted::constructed, 1u);
+    BOOST_CHECK_EQUAL(Counted::destroyed, 0u);
+  }
+  BOOST_CHECK_EQUAL(Counted::destroyed, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(TypeMismatch) {
+  AlgorithmState state;
+  state.get<int>() = 3;
+  BOOST_CHECK_THROW(state.get<double>(), std::logic_error);
+  // the stored object is unchanged
+  BOOST_CHECK_EQUAL(state.get<int>(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(LocalState) {
+  WhiteBoard store;
+  AlgorithmContext ctx(0, 0, store);
+  BOOST_CHECK_THROW(ctx.localState<int>(), std::logic_error);
+
+  AlgorithmState state;
+  ctx.algorithmState = &state;
+  ctx.localState<int>() = 5;
+  BOOST_CHECK_EQUAL(state.get<int>(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(LeaseReusesState) {
+  WorkerStates states(2);
+  AlgorithmState* first = nullptr;
+  {
+    WorkerStates::Lease lease(states, 0);
+    first = lease.get();
+    first->get<int>() = 7;
+  }
+  WorkerStates::Lease lease(states, 0);
+  BOOST_CHECK_EQUAL(lease.get(), first);
+  BOOST_CHECK_EQUAL(lease.get()->get<int>(), 7);
+  // other algorithms have their own state
+  WorkerStates::Lease other(states, 1);
+  BOOST_CHECK_NE(other.get(), first);
+}
+
+BOOST_AUTO_TEST_CASE(LeaseNestedExecution) {
+  WorkerStates states(1);
+  AlgorithmState* kept = nullptr;
+  {
+    WorkerStates::Lease outer(states, 0);
+    kept = outer.get();
+    kept->get<int>() = 7;
+    {
+      // the same algorithm is executed again while the state is in use
+      WorkerStates::Lease nested(states, 0);
+      BOOST_CHECK_NE(nested.get(), kept);
+      BOOST_CHECK_EQUAL(nested.get()->get<int>(), 0);
+      nested.get()->get<int>() = 9;
+    }
+    // the temporary state does not replace the one in use
+    BOOST_CHECK_EQUAL(outer.get(), kept);
+    BOOST_CHECK_EQUAL(kept->get<int>(), 7);
+  }
+  // the state is handed out again once the outer execution is done
+  WorkerStates::Lease next(states, 0);
+  BOOST_CHECK_EQUAL(next.get(), kept);
+  BOOST_CHECK_EQUAL(next.get()->get<int>(), 7);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,164 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Framework/AlgorithmContext.hpp"
+#include "ActsExamples/Framework/AsyncWriter.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace ActsExamples;
+
+namespace {
+
+/// Records the written events and can be blocked or made to fail.
+class TestWriter : public IWriter {
+ public:
+  std::vector<size_t> written;
+  bool hasEnded = false;
+  // return ABORT for this event
+  size_t abortEvent = SIZE_MAX;
+  // throw for this event
+  size_t throwEvent = SIZE_MAX;
+
+  std::string name() const final override { return "TestWriter"; }
+
+  ProcessCode write(const AlgorithmContext& ctx) final override {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_isBlockedChanged.wait(lock, [this] { return not m_isBlocked; });
+    }
+    if (ctx.eventNumber == abortEvent) {
+      return ProcessCode::ABORT;
+    }
+    if (ctx.eventNumber == throwEvent) {
+      throw std::runtime_error("Test failure");
+    }
+    // the event data must still be available
+    if (ctx.eventStore.get<size_t>("number") != ctx.eventNumber) {
+      throw std::runtime_error("Inconsistent event data");
+    }
+    written.push_back(ctx.eventNumber);
+    return ProcessCode::SUCCESS;
+  }
+
+  ProcessCode endRun() final override {
+    hasEnded = true;
+    return ProcessCode::SUCCESS;
+  }
+
+  void setBlocked(bool isBlocked) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_isBlocked = isBlocked;
+    }
+    m_isBlockedChanged.notify_all();
+  }
+
+ private:
+  std::mutex m_mutex;
+  std::condition_variable m_isBlockedChanged;
+  bool m_isBlocked = false;
+};
+
+ProcessCode writeEvent(AsyncWriter& writer, size_t event) {
+  WhiteBoard store;
+  store.add("number", size_t(event));
+  AlgorithmContext ctx(0, event, store);
+  // the store is gone before the event is written
+  return writer.write(ctx);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(AsyncWriterTests)
+
+BOOST_AUTO_TEST_CASE(Ordering) {
+  auto testWriter = std::make_shared<TestWriter>();
+  AsyncWriter writer({testWriter, 4}, Acts::Logging::ERROR);
+  BOOST_CHECK_EQUAL(writer.name(), "TestWriter");
+
+  std::vector<size_t> expected;
+  for (size_t event = 0; event < 100; ++event) {
+    BOOST_CHECK(writeEvent(writer, event) == ProcessCode::SUCCESS);
+    expected.push_back(event);
+  }
+  BOOST_CHECK(writer.endRun() == ProcessCode::SUCCESS);
+  BOOST_CHECK(testWriter->hasEnded);
+  BOOST_CHECK_EQUAL_COLLECTIONS(testWriter->written.begin(),
+                                testWriter->written.end(), expected.begin(),
+                                expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(BackPressure) {
+  const size_t maxQueuedEvents = 2;
+  const size_t numEvents = 8;
+  auto testWriter = std::make_shared<TestWriter>();
+  testWriter->setBlocked(true);
+  AsyncWriter writer({testWriter, maxQueuedEvents}, Acts::Logging::ERROR);
+
+  std::atomic<size_t> numQueued = 0;
+  std::thread producer([&] {
+    for (size_t event = 0; event < numEvents; ++event) {
+      if (writeEvent(writer, event) == ProcessCode::SUCCESS) {
+        ++numQueued;
+      }
+    }
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  // the queued events plus the one blocked in the wrapped writer
+  BOOST_CHECK_LE(numQueued.load(), maxQueuedEvents + 1);
+  BOOST_CHECK(testWriter->written.empty());
+
+  testWriter->setBlocked(false);
+  producer.join();
+  BOOST_CHECK_EQUAL(numQueued.load(), numEvents);
+  BOOST_CHECK(writer.endRun() == ProcessCode::SUCCESS);
+  BOOST_CHECK_EQUAL(testWriter->written.size(), numEvents);
+}
+
+BOOST_AUTO_TEST_CASE(FailurePropagation) {
+  auto testWriter = std::make_shared<TestWriter>();
+  testWriter->abortEvent = 2;
+  // hold back the failure until all events are queued
+  testWriter->setBlocked(true);
+  AsyncWriter writer({testWriter, 4}, Acts::Logging::FATAL);
+
+  for (size_t event = 0; event < 4; ++event) {
+    BOOST_CHECK(writeEvent(writer, event) == ProcessCode::SUCCESS);
+  }
+  testWriter->setBlocked(false);
+  BOOST_CHECK(writer.endRun() == ProcessCode::ABORT);
+  // later events are dropped and the run of the wrapped writer is not ended
+  BOOST_CHECK_EQUAL(testWriter->written.size(), 2u);
+  BOOST_CHECK(not testWriter->hasEnded);
+  // further events are refused
+  BOOST_CHECK(writeEvent(writer, 4) == ProcessCode::ABORT);
+}
+
+BOOST_AUTO_TEST_CASE(ExceptionPropagation) {
+  auto testWriter = std::make_shared<TestWriter>();
+  testWriter->throwEvent = 0;
+  AsyncWriter writer({testWriter, 4}, Acts::Logging::FATAL);
+
+  BOOST_CHECK(writeEvent(writer, 0) == ProcessCode::SUCCESS);
+  BOOST_CHECK(writer.endRun() == ProcessCode::ABORT);
+  BOOST_CHECK(testWriter->written.empty());
+  BOOST_CHECK(writeEvent(writer, 1) == ProcessCode::ABORT);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,91 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Framework/PhiloxEngine.hpp"
+
+#include <array>
+#include <cstdint>
+
+using ActsExamples::PhiloxEngine;
+
+namespace {
+
+void checkBlock(const std::array<uint32_t, 4>& block,
+                const std::array<uint32_t, 4>& expected) {
+  BOOST_CHECK_EQUAL_COLLECTIONS(block.begin(), block.end(), expected.begin(),
+                                expected.end());
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(PhiloxEngineTests)
+
+// Known-answer vectors of the Random123 reference implementation.
+BOOST_AUTO_TEST_CASE(KnownAnswers) {
+  checkBlock(PhiloxEngine::philox({0u, 0u}, {0u, 0u, 0u, 0u}),
+             {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+  checkBlock(PhiloxEngine::philox(
+                 {0xffffffff, 0xffffffff},
+                 {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}),
+             {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+  checkBlock(PhiloxEngine::philox(
+                 {0xa4093822, 0x299f31d0},
+                 {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}),
+             {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+}
+
+BOOST_AUTO_TEST_CASE(Output) {
+  // two values per block, the block index is the first counter word
+  PhiloxEngine engine(0x299f31d0a4093822u, 0x0370734413198a2eu, 0x85a308d3);
+  for (uint32_t block = 0; block < 3; ++block) {
+    auto words = PhiloxEngine::philox(
+        {0xa4093822, 0x299f31d0},
+        {block, 0x85a308d3, 0x13198a2e, 0x03707344});
+    BOOST_CHECK_EQUAL(engine(), words[0] | (uint64_t(words[1]) << 32));
+    BOOST_CHECK_EQUAL(engine(), words[2] | (uint64_t(words[3]) << 32));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Discard) {
+  // start within and at the end of a block, skip within and across blocks
+  for (unsigned long long drawn : {0u, 1u, 2u, 3u}) {
+    for (unsigned long long skipped : {0u, 1u, 2u, 3u, 4u, 5u, 10u, 101u}) {
+      PhiloxEngine engine(42u, 7u, 3u);
+      PhiloxEngine reference(42u, 7u, 3u);
+      for (unsigned long long i = 0; i < drawn; ++i) {
+        engine();
+        reference();
+      }
+      engine.discard(skipped);
+      for (unsigned long long i = 0; i < skipped; ++i) {
+        reference();
+      }
+      BOOST_CHECK(engine == reference);
+      BOOST_CHECK_EQUAL(engine(), reference());
+      BOOST_CHECK_EQUAL(engine(), reference());
+      BOOST_CHECK_EQUAL(engine(), reference());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Streams) {
+  PhiloxEngine engine(1u, 2u, 3u);
+  BOOST_CHECK(engine == PhiloxEngine(1u, 2u, 3u));
+  BOOST_CHECK(engine != PhiloxEngine(2u, 2u, 3u));
+  BOOST_CHECK(engine != PhiloxEngine(1u, 3u, 3u));
+  BOOST_CHECK(engine != PhiloxEngine(1u, 2u, 4u));
+  // the same stream is reproduced independent of other streams
+  PhiloxEngine other(1u, 2u, 4u);
+  auto value = engine();
+  BOOST_CHECK_NE(value, other());
+  BOOST_CHECK_EQUAL(value, PhiloxEngine(1u, 2u, 3u)());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
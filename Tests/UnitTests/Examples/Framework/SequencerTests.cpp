@@ -0,0 +1,212 @@
+// This file is part of the Acts project.
+//
+// Copyright (C) 2021 CERN for the benefit of the Acts project
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/test/unit_test.hpp>
+
+#include "ActsExamples/Framework/BareAlgorithm.hpp"
+#include "ActsExamples/Framework/IReader.hpp"
+#include "ActsExamples/Framework/IWriter.hpp"
+#include "ActsExamples/Framework/Sequencer.hpp"
+#include "ActsExamples/Framework/WhiteBoard.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace ActsExamples;
+
+namespace {
+
+constexpr size_t kEvents = 3;
+
+/// Adds its declared outputs and counts its executions.
+class TestAlgorithm : public BareAlgorithm {
+ public:
+  mutable std::atomic<size_t> executed{0};
+
+  TestAlgorithm(std::string name, std::vector<std::string> inputs,
+                std::vector<std::string> outputs)
+      : BareAlgorithm(std::move(name)), m_outputs(std::move(outputs)) {
+    for (auto& input : inputs) {
+      declareInput(std::move(input));
+    }
+    for (const auto& output : m_outputs) {
+      declareOutput(output);
+    }
+  }
+
+  ProcessCode execute(const AlgorithmContext& ctx) const final override {
+    for (const auto& output : m_outputs) {
+      ctx.eventStore.add(output, int(1));
+    }
+    ++executed;
+    return ProcessCode::SUCCESS;
+  }
+
+ private:
+  std::vector<std::string> m_outputs;
+};
+
+/// Does not declare what it reads and adds.
+class UndeclaredAlgorithm : public BareAlgorithm {
+ public:
+  mutable std::atomic<size_t> executed{0};
+
+  UndeclaredAlgorithm() : BareAlgorithm("Undeclared") {}
+
+  ProcessCode execute(const AlgorithmContext&) const final override {
+    ++executed;
+    return ProcessCode::SUCCESS;
+  }
+};
+
+/// Adds the objects that would otherwise be added by the algorithms.
+class TestReader : public IReader {
+ public:
+  TestReader(std::vector<std::string> outputs)
+      : m_outputs(std::move(outputs)) {}
+
+  std::string name() const final override { return "TestReader"; }
+
+  std::pair<size_t, size_t> availableEvents() const final override {
+    return {0u, kEvents};
+  }
+
+  ProcessCode read(const AlgorithmContext& ctx) final override {
+    for (const auto& output : m_outputs) {
+      ctx.eventStore.add(output, int(2));
+    }
+    return ProcessCode::SUCCESS;
+  }
+
+  std::optional<DataDependencies> dataDependencies() const final override {
+    return DataDependencies{{}, m_outputs};
+  }
+
+ private:
+  std::vector<std::string> m_outputs;
+};
+
+/// Reads the declared inputs and checks where they come from.
+class TestWriter : public IWriter {
+ public:
+  std::atomic<size_t> fromReader{0};
+
+  TestWriter(std::vector<std::string> inputs) : m_inputs(std::move(inputs)) {}
+
+  std::string name() const final override { return "TestWriter"; }
+
+  ProcessCode write(const AlgorithmContext& ctx) final override {
+    for (const auto& input : m_inputs) {
+      if (ctx.eventStore.get<int>(input) == 2) {
+        ++fromReader;
+      }
+    }
+    return ProcessCode::SUCCESS;
+  }
+
+  ProcessCode endRun() final override { return ProcessCode::SUCCESS; }
+
+  std::optional<DataDependencies> dataDependencies() const final override {
+    return DataDependencies{m_inputs, {}};
+  }
+
+ private:
+  std::vector<std::string> m_inputs;
+};
+
+Sequencer::Config makeConfig() {
+  Sequencer::Config cfg;
+  cfg.numThreads = 1;
+  cfg.logLevel = Acts::Logging::WARNING;
+  return cfg;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(SequencerTests)
+
+// the truth is only used to create the replaced hits
+BOOST_AUTO_TEST_CASE(SkipUpstreamFeeder) {
+  auto truth = std::make_shared<TestAlgorithm>(
+      "Truth", std::vector<std::string>{}, std::vector<std::string>{"truth"});
+  auto hits = std::make_shared<TestAlgorithm>(
+      "Hits", std::vector<std::string>{"truth"},
+      std::vector<std::string>{"hits"});
+  auto tracks = std::make_shared<TestAlgorithm>(
+      "Tracks", std::vector<std::string>{"hits"},
+      std::vector<std::string>{"tracks"});
+  auto writer = std::make_shared<TestWriter>(
+      std::vector<std::string>{"hits", "tracks"});
+
+  Sequencer sequencer(makeConfig());
+  sequencer.addReader(
+      std::make_shared<TestReader>(std::vector<std::string>{"hits"}));
+  sequencer.addAlgorithm(truth);
+  sequencer.addAlgorithm(hits);
+  sequencer.addAlgorithm(tracks);
+  sequencer.addWriter(writer);
+  BOOST_CHECK_EQUAL(sequencer.run(), EXIT_SUCCESS);
+
+  BOOST_CHECK_EQUAL(truth->executed, 0u);
+  BOOST_CHECK_EQUAL(hits->executed, 0u);
+  BOOST_CHECK_EQUAL(tracks->executed, kEvents);
+  BOOST_CHECK_EQUAL(writer->fromReader, kEvents);
+}
+
+// the truth is still written even though the hits are replaced
+BOOST_AUTO_TEST_CASE(KeepNeededProducer) {
+  auto truth = std::make_shared<TestAlgorithm>(
+      "Truth", std::vector<std::string>{}, std::vector<std::string>{"truth"});
+  auto hits = std::make_shared<TestAlgorithm>(
+      "Hits", std::vector<std::string>{"truth"},
+      std::vector<std::string>{"hits"});
+  auto writer = std::make_shared<TestWriter>(
+      std::vector<std::string>{"truth", "hits"});
+
+  Sequencer sequencer(makeConfig());
+  sequencer.addReader(
+      std::make_shared<TestReader>(std::vector<std::string>{"hits"}));
+  sequencer.addAlgorithm(truth);
+  sequencer.addAlgorithm(hits);
+  sequencer.addWriter(writer);
+  BOOST_CHECK_EQUAL(sequencer.run(), EXIT_SUCCESS);
+
+  BOOST_CHECK_EQUAL(truth->executed, kEvents);
+  BOOST_CHECK_EQUAL(hits->executed, 0u);
+  BOOST_CHECK_EQUAL(writer->fromReader, kEvents);
+}
+
+// the undeclared algorithm could read the truth
+BOOST_AUTO_TEST_CASE(StopAtUndeclaredAlgorithm) {
+  auto truth = std::make_shared<TestAlgorithm>(
+      "Truth", std::vector<std::string>{}, std::vector<std::string>{"truth"});
+  auto undeclared = std::make_shared<UndeclaredAlgorithm>();
+  auto hits = std::make_shared<TestAlgorithm>(
+      "Hits", std::vector<std::string>{"truth"},
+      std::vector<std::string>{"hits"});
+  auto writer = std::make_shared<TestWriter>(std::vector<std::string>{"hits"});
+
+  Sequencer sequencer(makeConfig());
+  sequencer.addReader(
+      std::make_shared<TestReader>(std::vector<std::string>{"hits"}));
+  sequencer.addAlgorithm(truth);
+  sequencer.addAlgorithm(undeclared);
+  sequencer.addAlgorithm(hits);
+  sequencer.addWriter(writer);
+  BOOST_CHECK_EQUAL(sequencer.run(), EXIT_SUCCESS);
+
+  BOOST_CHECK_EQUAL(truth->executed, kEvents);
+  BOOST_CHECK_EQUAL(undeclared->executed, kEvents);
+  BOOST_CHECK_EQUAL(hits->executed, 0u);
+  BOOST_CHECK_EQUAL(writer->fromReader, kEvents);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
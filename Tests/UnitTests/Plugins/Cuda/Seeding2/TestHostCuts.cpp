@@ -30,21 +30,18 @@ bool TestHostCuts::singleSeedCut(
   return !(b.radius() > 150. && weight < 380.);
 }
 
-std::vector<
-    std::pair<float, std::unique_ptr<const Acts::InternalSeed<TestSpacePoint>>>>
+std::vector<std::pair<float, Acts::InternalSeed<TestSpacePoint>>>
 TestHostCuts::cutPerMiddleSP(
-    std::vector<std::pair<
-        float, std::unique_ptr<const Acts::InternalSeed<TestSpacePoint>>>>
-        seeds) const {
-  std::vector<std::pair<
-      float, std::unique_ptr<const Acts::InternalSeed<TestSpacePoint>>>>
+    std::vector<std::pair<float, Acts::InternalSeed<TestSpacePoint>>> seeds)
+    const {
+  std::vector<std::pair<float, Acts::InternalSeed<TestSpacePoint>>>
       newSeedsVector;
   if (seeds.size() > 1) {
     newSeedsVector.push_back(std::move(seeds[0]));
     size_t itLength = std::min(seeds.size(), size_t(5));
     // don't cut first element
     for (size_t i = 1; i < itLength; i++) {
-      if (seeds[i].first > 200. || seeds[i].second->sp[0]->radius() > 43.) {
+      if (seeds[i].first > 200. || seeds[i].second.sp[0]->radius() > 43.) {
         newSeedsVector.push_back(std::move(seeds[i]));
       }
     }
@@ -41,11 +41,9 @@ class TestHostCuts : public Acts::IExperimentCuts<TestSpacePoint> {
   /// space
   /// point
   /// @return vector of seeds that pass the cut
-  std::vector<std::pair<
-      float, std::unique_ptr<const Acts::InternalSeed<TestSpacePoint>>>>
+  std::vector<std::pair<float, Acts::InternalSeed<TestSpacePoint>>>
   cutPerMiddleSP(
-      std::vector<std::pair<
-          float, std::unique_ptr<const Acts::InternalSeed<TestSpacePoint>>>>
-          seeds) const;
+      std::vector<std::pair<float, Acts::InternalSeed<TestSpacePoint>>> seeds)
+      const;
 
 };  // struct TestHostCuts
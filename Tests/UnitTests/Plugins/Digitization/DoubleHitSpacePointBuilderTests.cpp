@@ -16,6 +16,9 @@
 #include "Acts/Surfaces/RectangleBounds.hpp"
 #include "Acts/Tests/CommonHelpers/DetectorElementStub.hpp"
 
+#include <limits>
+#include <random>
+
 namespace bdata = boost::unit_test::data;
 namespace tt = boost::test_tools;
 using namespace Acts::UnitLiterals;
@@ -145,5 +148,96 @@ BOOST_DATA_TEST_CASE(DoubleHitsSpacePointBuilder_basic, bdata::xrange(1),
   BOOST_CHECK_EQUAL(resultSP.size(), 1u);
 }
 
+/// Unit test comparing the cluster pairing with an exhaustive search over all
+/// combinations of clusters on two modules
+BOOST_AUTO_TEST_CASE(DoubleHitsSpacePointBuilder_pairing) {
+  auto recBounds = std::make_shared<RectangleBounds>(10_mm, 25_mm);
+  std::vector<float> boundariesX = {-10_mm, 10_mm};
+  std::vector<float> boundariesY = {-25_mm, 25_mm};
+  BinningData binDataX(BinningOption::open, BinningValue::binX, boundariesX);
+  auto binUtility = std::make_shared<BinUtility>(binDataX);
+  BinningData binDataY(BinningOption::open, BinningValue::binY, boundariesY);
+  (*binUtility) += BinUtility(binDataY);
+  auto segmentation =
+      std::make_shared<CartesianSegmentation>(binUtility, recBounds);
+  const DigitizationModule digMod(segmentation, 1., 1., 0.);
+
+  Transform3 frontTransform(AngleAxis3(0.026, Vector3::UnitZ()));
+  frontTransform.translation() = Vector3(0., 0., 10_m);
+  Transform3 backTransform(AngleAxis3(-0.026, Vector3::UnitZ()));
+  backTransform.translation() = Vector3(0., 0., 10.005_m);
+  DetectorElementStub frontElement(frontTransform);
+  DetectorElementStub backElement(backTransform);
+  auto frontSurface =
+      Surface::makeShared<PlaneSurface>(recBounds, frontElement);
+  auto backSurface = Surface::makeShared<PlaneSurface>(recBounds, backElement);
+
+  // clusters spread over the modules, with identical positions on the back
+  // module to check the choice between equally close clusters
+  std::default_random_engine rng(42);
+  std::uniform_real_distribution<double> loc0(-10_mm, 10_mm);
+  std::uniform_real_distribution<double> loc1(-25_mm, 25_mm);
+  SymMatrix3 cov = SymMatrix3::Zero();
+  std::vector<PlanarModuleCluster> frontClusters;
+  std::vector<PlanarModuleCluster> backClusters;
+  for (size_t i = 0; i < 100; ++i) {
+    frontClusters.emplace_back(
+        frontSurface, DigitizationSourceLink(frontSurface->geometryId(), {}),
+        cov, loc0(rng), loc1(rng), 0., std::vector<DigitizationCell>{},
+        &digMod);
+    double backLoc0 = (i % 10 == 1) ? backClusters.back().parameters()[0]
+                                    : loc0(rng);
+    double backLoc1 = (i % 10 == 1) ? backClusters.back().parameters()[1]
+                                    : loc1(rng);
+    backClusters.emplace_back(
+        backSurface, DigitizationSourceLink(backSurface->geometryId(), {}), cov,
+        backLoc0, backLoc1, 0., std::vector<DigitizationCell>{}, &digMod);
+  }
+  std::vector<const PlanarModuleCluster*> front;
+  std::vector<const PlanarModuleCluster*> back;
+  for (size_t i = 0; i < frontClusters.size(); ++i) {
+    front.push_back(&frontClusters[i]);
+    back.push_back(&backClusters[i]);
+  }
+
+  DoubleHitSpacePointConfig cfg;
+  cfg.diffDist = 10_mm;
+  cfg.diffPhi2 = 0.01;
+  cfg.diffTheta2 = 0.0001;
+  SpacePointBuilder<SpacePoint<PlanarModuleCluster>> builder(cfg);
+  std::vector<std::pair<const PlanarModuleCluster*, const PlanarModuleCluster*>>
+      pairs;
+  builder.makeClusterPairs(tgContext, front, back, pairs);
+
+  // the first closest back cluster for each front cluster
+  std::vector<std::pair<const PlanarModuleCluster*, const PlanarModuleCluster*>>
+      expected;
+  Vector3 mom(1., 1., 1.);
+  for (const auto* f : front) {
+    Vector3 frontPos = frontSurface->localToGlobal(
+        tgContext, {f->parameters()[0], f->parameters()[1]}, mom);
+    double diffMin = std::numeric_limits<double>::max();
+    const PlanarModuleCluster* best = nullptr;
+    for (const auto* b : back) {
+      Vector3 backPos = backSurface->localToGlobal(
+          tgContext, {b->parameters()[0], b->parameters()[1]}, mom);
+      double diff = detail::differenceOfClustersChecked(
+          frontPos, backPos, cfg.vertex, cfg.diffDist, cfg.diffTheta2,
+          cfg.diffPhi2);
+      if (diff >= 0. and diff < diffMin) {
+        diffMin = diff;
+        best = b;
+      }
+    }
+    if (best != nullptr) {
+      expected.emplace_back(f, best);
+    }
+  }
+
+  BOOST_CHECK_GT(expected.size(), 0u);
+  BOOST_CHECK_LT(expected.size(), front.size());
+  BOOST_CHECK(pairs == expected);
+}
+
 }  // end of namespace Test
 }  // end of namespace Acts
@@ -36,11 +36,8 @@ class ATLASCuts : public IExperimentCuts<SpacePoint> {
   /// space
   /// point
   /// @return vector of seeds that pass the cut
-  std::vector<std::pair<float, std::unique_ptr<const InternalSeed<SpacePoint>>>>
-  cutPerMiddleSP(
-      std::vector<
-          std::pair<float, std::unique_ptr<const InternalSeed<SpacePoint>>>>
-          seeds) const;
+  std::vector<std::pair<float, InternalSeed<SpacePoint>>> cutPerMiddleSP(
+      std::vector<std::pair<float, InternalSeed<SpacePoint>>> seeds) const;
 };
 
 template <typename SpacePoint>
@@ -67,19 +64,16 @@ bool ATLASCuts<SpacePoint>::singleSeedCut(
 }
 
 template <typename SpacePoint>
-std::vector<std::pair<float, std::unique_ptr<const InternalSeed<SpacePoint>>>>
+std::vector<std::pair<float, InternalSeed<SpacePoint>>>
 ATLASCuts<SpacePoint>::cutPerMiddleSP(
-    std::vector<
-        std::pair<float, std::unique_ptr<const InternalSeed<SpacePoint>>>>
-        seeds) const {
-  std::vector<std::pair<float, std::unique_ptr<const InternalSeed<SpacePoint>>>>
-      newSeedsVector;
+    std::vector<std::pair<float, InternalSeed<SpacePoint>>> seeds) const {
+  std::vector<std::pair<float, InternalSeed<SpacePoint>>> newSeedsVector;
   if (seeds.size() > 1) {
     newSeedsVector.push_back(std::move(seeds[0]));
     size_t itLength = std::min(seeds.size(), size_t(5));
     // don't cut first element
     for (size_t i = 1; i < itLength; i++) {
-      if (seeds[i].first > 200. || seeds[i].second->sp[0]->radius() > 43.) {
+      if (seeds[i].first > 200. || seeds[i].second.sp[0]->radius() > 43.) {
         newSeedsVector.push_back(std::move(seeds[i]));
       }
     }